@@ -0,0 +1,29 @@
+#ifndef _SGL_ARRAYCACHE_H_
+#define _SGL_ARRAYCACHE_H_
+
+#include <commongl.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * client side arrays which are drawn from again and again are kept in
+ * buffers on the server, so that unchanged arrays aren't sent twice.
+ * entries are known by their pointer, size and a hash of their contents
+ * and are evicted least recently used first once budget is exceeded
+ */
+void arraycache_init(size_t budget);
+
+/*
+ * returns true if the array is resident on the server, in which case id
+ * names its entry. otherwise id names the entry the array should be
+ * stored in after uploading it, or 0 if it shouldn't be cached
+ */
+bool arraycache_find(const void *data, size_t size, GLuint *id);
+
+/*
+ * entries evicted since the last call, one per call and 0 once there are
+ * none left. their buffers on the server should be released
+ */
+GLuint arraycache_next_released(void);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef _SGL_INDICES_H_
+#define _SGL_INDICES_H_
+
+#include <commongl.h>
+#include <stddef.h>
+
+/*
+ * the smallest and largest of count indices of the given type, both
+ * are 0 if count is 0 or the type isn't an index type
+ */
+void indices_range(GLenum type, const void *indices, size_t count, GLuint *min, GLuint *max);
+
+/*
+ * size of a single index of the given type in bytes
+ */
+size_t indices_type_size(GLenum type);
+
+#endif
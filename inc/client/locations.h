@@ -0,0 +1,27 @@
+#ifndef _SGL_LOCATIONS_H_
+#define _SGL_LOCATIONS_H_
+
+#include <commongl.h>
+#include <stdbool.h>
+
+/*
+ * locations looked up by name stay the same until the program is linked
+ * again, so they are remembered per program and only asked for once
+ */
+enum location_kind {
+    LOCATION_UNIFORM,
+    LOCATION_ATTRIB,
+    LOCATION_FRAG_DATA,
+    LOCATION_FRAG_DATA_INDEX,
+    LOCATION_UNIFORM_BLOCK
+};
+
+bool locations_find(GLuint program, enum location_kind kind, const char *name, GLint *location);
+void locations_add(GLuint program, enum location_kind kind, const char *name, GLint location);
+
+/*
+ * drops every location of the program, on linking and deleting it
+ */
+void locations_forget(GLuint program);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef _SGL_CLIENT_NAMES_H_
+#define _SGL_CLIENT_NAMES_H_
+
+#include <commongl.h>
+
+/*
+ * object names are handed out by the client, the server translates
+ * them to the real names of its context (see server/names.h)
+ */
+enum names_type {
+    NAMES_BUFFER,
+    NAMES_TEXTURE,
+    NAMES_QUERY,
+    NAMES_FRAMEBUFFER,
+    NAMES_RENDERBUFFER,
+    NAMES_VERTEX_ARRAY,
+    NAMES_TYPE_COUNT
+};
+
+GLuint names_alloc(enum names_type type);
+void names_free(enum names_type type, GLuint name);
+
+/*
+ * marks a name the application picked itself as used, so that
+ * bind-to-create names are never handed out again
+ */
+void names_reserve(enum names_type type, GLuint name);
+
+#endif
\ No newline at end of file
@@ -18,21 +18,30 @@ struct pb_net_hooks {
     void(*_pb_memcpy)(void *src, size_t length);
     void*(*_pb_ptr)(size_t offs);
     void(*_pb_copy_to_shared)();
+    void(*_pb_download)(void *dst, size_t length);
 };
 
-void pb_set_net(struct pb_net_hooks hooks, size_t internal_alloc_size);
+void pb_set_net(struct pb_net_hooks hooks, size_t internal_alloc_size, size_t download_alloc_size);
 
 #ifndef _WIN32
-/*
- * to-do: determine if direct_access is really unneeded
- */
-void pb_set(int pb, bool direct_access);
+void pb_set(int pb);
 #else
-void pb_set(bool direct_access);
+void pb_set(void);
 void pb_unset(void);
 #endif
 
+/*
+ * moves the push buffer and client registers
+ * over to the given slot in shared memory
+ */
+void pb_claim_slot(int index);
+
 void pb_reset();
+
+/*
+ * drops everything pushed past the first size bytes
+ */
+void pb_truncate(size_t size);
 void pb_push(int c);
 void pb_pushf(float c);
 
@@ -55,6 +64,39 @@ void *pb_iptr(size_t offs);
 
 size_t pb_size();
 
+/*
+ * the largest batch that can be submitted at once
+ */
+size_t pb_capacity();
+
+/*
+ * the largest amount of data a single SGL_CMD_VP_DOWNLOAD returns
+ */
+size_t pb_download_capacity();
+
+/*
+ * the region of the slot persistent buffer mappings are placed in, only
+ * available with shared memory. the size is 0 otherwise
+ */
+void *pb_map_region();
+size_t pb_map_region_size();
+
+/*
+ * copies the result of the last submitted SGL_CMD_VP_DOWNLOAD into dst,
+ * waiting for the server to get to it first
+ */
+void pb_download(void *dst, size_t length);
+
+/*
+ * copies the internal buffer into the ring as a single batch, only
+ * blocks for as long as the ring has no room for it
+ */
 void pb_copy_to_shared();
 
+/*
+ * blocks until the server has executed every published batch, done
+ * implicitly when reading a client register (RETVAL, RETVAL_V)
+ */
+void pb_wait_idle();
+
 #endif
\ No newline at end of file
@@ -4,5 +4,6 @@
 #include <stddef.h>
 
 void *scratch_buffer_get(size_t size);
+void scratch_buffer_release(void);
 
 #endif
\ No newline at end of file
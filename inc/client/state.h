@@ -0,0 +1,84 @@
+#ifndef _SGL_STATE_H_
+#define _SGL_STATE_H_
+
+#include <commongl.h>
+#include <stdbool.h>
+
+/*
+ * client-side shadow of server state, used to answer glGet* and glIsEnabled
+ * without a round trip. every value starts out unknown and becomes known
+ * once the client sets it or the server has been asked for it
+ */
+
+/*
+ * forget everything that isn't immutable, for when state changes in
+ * ways we can't follow (display lists, attribute stacks)
+ */
+void state_invalidate(void);
+
+void state_new_list(GLenum mode);
+void state_end_list(void);
+
+/*
+ * queries; these return false if the value isn't known, in
+ * which case the server must be asked instead
+ */
+bool state_is_enabled(GLenum cap, GLboolean *enabled);
+bool state_get_integers(GLenum pname, GLint *data);
+bool state_get_floats(GLenum pname, GLfloat *data);
+bool state_get_booleans(GLenum pname, GLboolean *data);
+bool state_get_doubles(GLenum pname, GLdouble *data);
+
+/*
+ * remember the server's answer to a query
+ */
+void state_cache_integers(GLenum pname, const GLint *data);
+void state_cache_floats(GLenum pname, const GLfloat *data);
+void state_cache_enabled(GLenum cap, GLboolean enabled);
+
+/*
+ * state changes
+ */
+void state_enable(GLenum cap, bool enabled);
+void state_enable_indexed(GLenum cap);
+void state_set_integers(GLenum pname, const GLint *data);
+void state_set_floats(GLenum pname, const GLfloat *data);
+void state_forget(GLenum pname);
+
+/*
+ * the pname querying the buffer bound to target, 0 if there is none
+ */
+GLenum state_buffer_binding_pname(GLenum target);
+
+void state_bind_buffer(GLenum target, GLuint buffer);
+void state_bind_texture(GLenum target, GLuint texture);
+void state_bind_textures_unknown(void);
+void state_bind_framebuffer(GLenum target, GLuint framebuffer);
+void state_bind_renderbuffer(GLuint renderbuffer);
+void state_bind_vertex_array(GLuint array);
+void state_active_texture(GLenum texture);
+
+void state_delete_buffers(GLsizei n, const GLuint *buffers);
+void state_delete_textures(GLsizei n, const GLuint *textures);
+void state_delete_framebuffers(GLsizei n, const GLuint *framebuffers);
+void state_delete_renderbuffers(GLsizei n, const GLuint *renderbuffers);
+void state_delete_vertex_arrays(GLsizei n, const GLuint *arrays);
+
+/*
+ * matrices, only the modelview and projection stacks are followed
+ */
+void state_matrix_mode(GLenum mode);
+void state_load_matrix(const GLfloat *m);
+void state_load_identity(void);
+void state_mult_matrix(const GLfloat *m);
+void state_load_transpose_matrix(const GLfloat *m);
+void state_mult_transpose_matrix(const GLfloat *m);
+void state_translate(GLfloat x, GLfloat y, GLfloat z);
+void state_scale(GLfloat x, GLfloat y, GLfloat z);
+void state_rotate(GLfloat angle, GLfloat x, GLfloat y, GLfloat z);
+void state_ortho(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near_val, GLfloat far_val);
+void state_frustum(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near_val, GLfloat far_val);
+void state_push_matrix(void);
+void state_pop_matrix(void);
+
+#endif
\ No newline at end of file
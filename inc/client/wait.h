@@ -0,0 +1,21 @@
+#ifndef _WAIT_H_
+#define _WAIT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * waits until *word no longer holds value. spins for a little while,
+ * then sleeps with *sleeping set so that the other side knows to call
+ * wait_wake. sleeps time out, as the other side may live in another
+ * kernel (a vm) and be unable to wake us
+ */
+void wait_change(volatile uint32_t *word, uint32_t value, volatile int *sleeping);
+
+/*
+ * gives up after timeout_us, returns whether *word changed
+ */
+bool wait_change_timeout(volatile uint32_t *word, uint32_t value, volatile int *sleeping, uint64_t timeout_us);
+void wait_wake(volatile uint32_t *word);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef _SGL_FBCODEC_H_
+#define _SGL_FBCODEC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * frames are split into square tiles, only tiles that changed since the
+ * previous frame are sent. tiles are at most this large so that a single
+ * tile always fits into one swapbuffers result packet
+ */
+#define FB_CODEC_MIN_TILE_SIZE 16
+#define FB_CODEC_MAX_TILE_SIZE 112
+#define FB_CODEC_DEFAULT_TILE_SIZE 64
+
+/*
+ * 0: dirty tiles are sent as is
+ * 1: runs of equal pixels are compressed
+ * 2: runs of pixels equal to the row above are compressed too
+ */
+#define FB_CODEC_MAX_LEVEL 2
+#define FB_CODEC_DEFAULT_LEVEL 2
+
+/*
+ * every so many frames all tiles are sent, so that a client
+ * which lost a tile eventually catches up. 0 disables this
+ */
+#define FB_CODEC_DEFAULT_KEYFRAME_INTERVAL 0
+
+/*
+ * called whenever a payload is full, or at the end of a frame
+ */
+typedef void (*fb_encoder_emit_fn)(const void *data, size_t size, int tile_count, void *user);
+
+struct fb_encoder {
+    uint32_t *previous;
+    uint32_t *tile;
+    uint32_t *encoded;
+    uint8_t *payload;
+    size_t payload_capacity;
+    size_t max_pixels;
+
+    unsigned int width, height, stride;
+    int frames_since_keyframe;
+
+    int tile_size;
+    int level;
+    int keyframe_interval;
+};
+
+bool fb_encoder_init(struct fb_encoder *enc, unsigned int max_width, unsigned int max_height, size_t payload_capacity, int tile_size, int level, int keyframe_interval);
+void fb_encoder_free(struct fb_encoder *enc);
+
+/*
+ * forget the previous frame, so that the next frame sends every tile
+ */
+void fb_encoder_invalidate(struct fb_encoder *enc);
+
+/*
+ * encodes the tiles of frame that differ from the previous frame, payloads
+ * are handed to emit as they fill up. returns the amount of payloads.
+ * stride is the distance between rows in pixels
+ */
+int fb_encoder_encode(struct fb_encoder *enc, const uint32_t *frame, unsigned int width, unsigned int height, unsigned int stride, fb_encoder_emit_fn emit, void *user);
+
+/*
+ * patches frame with the tiles from a payload, returns false
+ * if the payload is malformed
+ */
+bool fb_decode(const void *data, size_t size, int tile_size, int tile_count, uint32_t *frame, unsigned int width, unsigned int height, unsigned int stride);
+
+#endif
\ No newline at end of file
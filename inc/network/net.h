@@ -11,11 +11,30 @@
  */
 struct net_context;
 
+/*
+ * on the server, sockets of clients are their file descriptors
+ */
 #define NET_SOCKET_SERVER -1
 #define NET_SOCKET_NONE -2
-#define NET_SOCKET_FIRST_FD 2
 typedef int net_socket;
 
+/*
+ * opaque; large enough to hold the address of a udp peer
+ */
+struct net_address {
+    uint64_t storage[4];
+};
+
+/*
+ * one of the buffers of a gathered send
+ */
+struct net_buffer {
+    const void *data;
+    size_t size;
+};
+
+#define NET_MAX_BUFFERS 8
+
 enum net_poll_reason {
     NET_POLL_FAILED                 = 0,
     NET_POLL_INCOMING_CONNECTION    = (1 << 0),
@@ -35,10 +54,20 @@ char *net_init_client(struct net_context **ctx, char *hostname, int port);
  * hide from windows, need WSAPoll support first
  */
 #ifndef _WIN32
-enum net_poll_reason net_poll(struct net_context *ctx);
+/*
+ * blocks for up to timeout_ms, forever if it is -1
+ */
+enum net_poll_reason net_poll(struct net_context *ctx, int timeout_ms);
 net_socket net_accept(struct net_context *ctx);
-int net_fd_count(struct net_context *ctx);
-bool net_did_event_happen_here(struct net_context *ctx, int fd);
+
+/*
+ * after NET_POLL_INCOMING_TCP, returns the clients with data to read
+ * one at a time and NET_SOCKET_NONE once there are none left. once a
+ * message has been read, net_tcp_done queues the socket again if more
+ * is waiting behind it
+ */
+net_socket net_next_tcp(struct net_context *ctx);
+void net_tcp_done(struct net_context *ctx, net_socket fd);
 #endif
 
 // SERVER
@@ -52,9 +81,28 @@ long net_recv_udp(struct net_context *ctx, void *__restrict __buf, size_t __n, i
 long net_send_udp(struct net_context *ctx, const void *__buf, size_t __n, int __flags);
 long net_recv_udp_timeout(struct net_context *ctx, void *__restrict __buf, size_t __n, int __flags, size_t timeout_ms);
 
+/*
+ * like net_recv_udp and net_send_udp, but with an explicit peer so that
+ * packets meant for one client can't end up at another
+ */
+long net_recv_udp_from(struct net_context *ctx, void *__restrict __buf, size_t __n, int __flags, struct net_address *from);
+long net_send_udp_to(struct net_context *ctx, const struct net_address *to, const void *__buf, size_t __n, int __flags);
+
 // TCP
 bool net_recv_tcp(struct net_context *ctx, int fd, void *__restrict __buf, size_t __n);
 bool net_send_tcp(struct net_context *ctx, int fd, const void *__buf, size_t __n);
+
+/*
+ * sends up to NET_MAX_BUFFERS buffers back to back without
+ * copying them together first
+ */
+bool net_send_tcp_buffers(struct net_context *ctx, int fd, const struct net_buffer *buffers, int count);
 bool net_recv_tcp_timeout(struct net_context *ctx, int fd, void *__restrict __buf, size_t __n, size_t timeout_ms);
 
+/*
+ * waits until data can be read from a tcp socket without consuming
+ * any of it, returns false on timeout
+ */
+bool net_wait_tcp(struct net_context *ctx, int fd, size_t timeout_ms);
+
 #endif
\ No newline at end of file
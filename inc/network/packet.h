@@ -5,15 +5,24 @@
 #include <stdint.h>
 #include <inttypes.h>
 
+#define SGL_SWAPBUFFERS_RESULT_SIZE 60000
+
 /*
- * 256: safe, keeps packet size under 1400 bytes
- * 512: default
- * 15360: largest, may result in fragmentation
+ * upper bound on packets per frame, enough for a raw 8k frame
  */
-#define SGL_FIFO_UPLOAD_COMMAND_BLOCK_COUNT 512
-#define SGL_FIFO_UPLOAD_COMMAND_BLOCK_SIZE (SGL_FIFO_UPLOAD_COMMAND_BLOCK_COUNT * sizeof(uint32_t))
+#define SGL_SWAPBUFFERS_MAX_CHUNKS 4096
 
-#define SGL_SWAPBUFFERS_RESULT_SIZE 60000
+enum sgl_swapbuffers_request_type {
+    /*
+     * asks for the next frame
+     */
+    SGL_SWAPBUFFERS_REQUEST_FRAME,
+
+    /*
+     * asks for the packets of the current frame that never arrived
+     */
+    SGL_SWAPBUFFERS_REQUEST_RETRANSMIT
+};
 
 #ifndef _WIN32
 #define PACKED __attribute__((packed))
@@ -28,6 +37,7 @@ struct PACKED sgl_packet_connect {
     uint32_t client_id;
     uint64_t framebuffer_size;
     uint64_t fifo_size;
+    uint64_t download_size;
     uint32_t gl_major;
     uint32_t gl_minor;
     uint32_t max_width;
@@ -36,25 +46,47 @@ struct PACKED sgl_packet_connect {
 
 struct PACKED sgl_packet_swapbuffers_request {
     uint32_t client_id;
+    uint32_t type;
+    uint32_t frame;
     uint32_t width;
     uint32_t height;
     uint32_t vflip;
     uint32_t format;
+
+    /*
+     * frame requests only; false if the client gave up on the previous
+     * frame, in which case every tile is sent again
+     */
+    uint32_t previous_complete;
+
+    /*
+     * retransmit requests only; bitmap of the missing packets, only
+     * as many bytes as the frame has packets are sent
+     */
+    uint8_t missing[SGL_SWAPBUFFERS_MAX_CHUNKS / 8];
 };
 
+/*
+ * holds tile_count encoded tiles of the framebuffer, see fbcodec.h
+ */
 struct PACKED sgl_packet_swapbuffers_result {
     uint32_t client_id;
-    uint32_t index;
+    uint32_t frame;
+    uint16_t index;
+    uint16_t tile_size;
+    uint16_t tile_count;
     uint32_t size;
     uint8_t result[SGL_SWAPBUFFERS_RESULT_SIZE];
 };
 
+/*
+ * sent over tcp ahead of the words of a submitted fifo, which the
+ * client sends straight from its push buffer and the server receives
+ * straight into the client's fifo
+ */
 struct PACKED sgl_packet_fifo_upload {
     uint32_t client_id;
-    uint32_t expected_chunks;
-    uint32_t index;
-    uint32_t count;
-    uint32_t commands[SGL_FIFO_UPLOAD_COMMAND_BLOCK_COUNT];
+    uint32_t size;      /* bytes following the header */
 };
 
 struct PACKED sgl_packet_retval {
@@ -65,8 +97,12 @@ struct PACKED sgl_packet_retval {
     uint32_t retval_v[256 / sizeof(uint32_t)];
 };
 
+/*
+ * sent over tcp before the packets of a frame
+ */
 struct PACKED sgl_packet_sync {
-    uint32_t sync;
+    uint32_t frame;
+    uint32_t chunks;
 };
 #ifdef _WIN32
 __pragma( pack(pop))
@@ -0,0 +1,842 @@
+/*
+ * generated by scripts/gencmdtable.py from src/server/processor.c, do not edit
+ */
+#ifndef _SGL_CMDHANDLERS_H_
+#define _SGL_CMDHANDLERS_H_
+
+#define SGL_HANDLED_COMMANDS(X) \
+    X(SGL_CMD_VP_UPLOAD) \
+    X(SGL_CMD_VP_NULL) \
+    X(SGL_CMD_VP_UPLOAD_STAY) \
+    X(SGL_CMD_VP_DOWNLOAD) \
+    X(SGL_CMD_CREATE_CONTEXT) \
+    X(SGL_CMD_REPORT_DIMS) \
+    X(SGL_CMD_GOODBYE_WORLD) \
+    X(SGL_CMD_SWAP_BUFFERS) \
+    X(SGL_CMD_VP_UPLOAD_CHUNK) \
+    X(SGL_CMD_VP_MAP_WINDOW) \
+    X(SGL_CMD_VP_FLUSH_WINDOW) \
+    X(SGL_CMD_VP_UNMAP_WINDOW) \
+    X(SGL_CMD_VP_CACHE_STORE) \
+    X(SGL_CMD_VP_CACHE_BIND) \
+    X(SGL_CMD_VP_CACHE_RELEASE) \
+    X(SGL_CMD_VP_DRAW_IMMEDIATE) \
+    X(SGL_CMD_CULLFACE) \
+    X(SGL_CMD_FRONTFACE) \
+    X(SGL_CMD_HINT) \
+    X(SGL_CMD_LINEWIDTH) \
+    X(SGL_CMD_POINTSIZE) \
+    X(SGL_CMD_POLYGONMODE) \
+    X(SGL_CMD_SCISSOR) \
+    X(SGL_CMD_TEXPARAMETERF) \
+    X(SGL_CMD_TEXPARAMETERFV) \
+    X(SGL_CMD_TEXPARAMETERI) \
+    X(SGL_CMD_TEXPARAMETERIV) \
+    X(SGL_CMD_TEXIMAGE1D) \
+    X(SGL_CMD_TEXIMAGE2D) \
+    X(SGL_CMD_DRAWBUFFER) \
+    X(SGL_CMD_CLEAR) \
+    X(SGL_CMD_CLEARCOLOR) \
+    X(SGL_CMD_CLEARSTENCIL) \
+    X(SGL_CMD_CLEARDEPTH) \
+    X(SGL_CMD_STENCILMASK) \
+    X(SGL_CMD_COLORMASK) \
+    X(SGL_CMD_DEPTHMASK) \
+    X(SGL_CMD_DISABLE) \
+    X(SGL_CMD_ENABLE) \
+    X(SGL_CMD_FINISH) \
+    X(SGL_CMD_FLUSH) \
+    X(SGL_CMD_BLENDFUNC) \
+    X(SGL_CMD_LOGICOP) \
+    X(SGL_CMD_STENCILFUNC) \
+    X(SGL_CMD_STENCILOP) \
+    X(SGL_CMD_DEPTHFUNC) \
+    X(SGL_CMD_PIXELSTOREF) \
+    X(SGL_CMD_PIXELSTOREI) \
+    X(SGL_CMD_READBUFFER) \
+    X(SGL_CMD_GETBOOLEANV) \
+    X(SGL_CMD_GETDOUBLEV) \
+    X(SGL_CMD_GETERROR) \
+    X(SGL_CMD_GETFLOATV) \
+    X(SGL_CMD_GETINTEGERV) \
+    X(SGL_CMD_GETSTRING) \
+    X(SGL_CMD_GETTEXIMAGE) \
+    X(SGL_CMD_GETTEXPARAMETERFV) \
+    X(SGL_CMD_GETTEXPARAMETERIV) \
+    X(SGL_CMD_GETTEXLEVELPARAMETERFV) \
+    X(SGL_CMD_GETTEXLEVELPARAMETERIV) \
+    X(SGL_CMD_ISENABLED) \
+    X(SGL_CMD_DEPTHRANGE) \
+    X(SGL_CMD_VIEWPORT) \
+    X(SGL_CMD_NEWLIST) \
+    X(SGL_CMD_ENDLIST) \
+    X(SGL_CMD_CALLLIST) \
+    X(SGL_CMD_DELETELISTS) \
+    X(SGL_CMD_GENLISTS) \
+    X(SGL_CMD_LISTBASE) \
+    X(SGL_CMD_BEGIN) \
+    X(SGL_CMD_BITMAP) \
+    X(SGL_CMD_COLOR3B) \
+    X(SGL_CMD_COLOR3D) \
+    X(SGL_CMD_COLOR3F) \
+    X(SGL_CMD_COLOR3I) \
+    X(SGL_CMD_COLOR3S) \
+    X(SGL_CMD_COLOR3UB) \
+    X(SGL_CMD_COLOR3UI) \
+    X(SGL_CMD_COLOR3US) \
+    X(SGL_CMD_COLOR4B) \
+    X(SGL_CMD_COLOR4D) \
+    X(SGL_CMD_COLOR4F) \
+    X(SGL_CMD_COLOR4I) \
+    X(SGL_CMD_COLOR4S) \
+    X(SGL_CMD_COLOR4UB) \
+    X(SGL_CMD_COLOR4UI) \
+    X(SGL_CMD_COLOR4US) \
+    X(SGL_CMD_EDGEFLAG) \
+    X(SGL_CMD_END) \
+    X(SGL_CMD_INDEXD) \
+    X(SGL_CMD_INDEXF) \
+    X(SGL_CMD_INDEXI) \
+    X(SGL_CMD_INDEXS) \
+    X(SGL_CMD_NORMAL3B) \
+    X(SGL_CMD_NORMAL3D) \
+    X(SGL_CMD_NORMAL3F) \
+    X(SGL_CMD_NORMAL3I) \
+    X(SGL_CMD_NORMAL3S) \
+    X(SGL_CMD_RASTERPOS2D) \
+    X(SGL_CMD_RASTERPOS2F) \
+    X(SGL_CMD_RASTERPOS2I) \
+    X(SGL_CMD_RASTERPOS2S) \
+    X(SGL_CMD_RASTERPOS3D) \
+    X(SGL_CMD_RASTERPOS3F) \
+    X(SGL_CMD_RASTERPOS3I) \
+    X(SGL_CMD_RASTERPOS3S) \
+    X(SGL_CMD_RASTERPOS4D) \
+    X(SGL_CMD_RASTERPOS4F) \
+    X(SGL_CMD_RASTERPOS4I) \
+    X(SGL_CMD_RASTERPOS4S) \
+    X(SGL_CMD_RECTD) \
+    X(SGL_CMD_RECTF) \
+    X(SGL_CMD_RECTI) \
+    X(SGL_CMD_RECTS) \
+    X(SGL_CMD_TEXCOORD1D) \
+    X(SGL_CMD_TEXCOORD1F) \
+    X(SGL_CMD_TEXCOORD1I) \
+    X(SGL_CMD_TEXCOORD1S) \
+    X(SGL_CMD_TEXCOORD2D) \
+    X(SGL_CMD_TEXCOORD2F) \
+    X(SGL_CMD_TEXCOORD2I) \
+    X(SGL_CMD_TEXCOORD2S) \
+    X(SGL_CMD_TEXCOORD3D) \
+    X(SGL_CMD_TEXCOORD3F) \
+    X(SGL_CMD_TEXCOORD3I) \
+    X(SGL_CMD_TEXCOORD3S) \
+    X(SGL_CMD_TEXCOORD4D) \
+    X(SGL_CMD_TEXCOORD4F) \
+    X(SGL_CMD_TEXCOORD4I) \
+    X(SGL_CMD_TEXCOORD4S) \
+    X(SGL_CMD_VERTEX2D) \
+    X(SGL_CMD_VERTEX2F) \
+    X(SGL_CMD_VERTEX2I) \
+    X(SGL_CMD_VERTEX2S) \
+    X(SGL_CMD_VERTEX3D) \
+    X(SGL_CMD_VERTEX3F) \
+    X(SGL_CMD_VERTEX3I) \
+    X(SGL_CMD_VERTEX3S) \
+    X(SGL_CMD_VERTEX4D) \
+    X(SGL_CMD_VERTEX4F) \
+    X(SGL_CMD_VERTEX4I) \
+    X(SGL_CMD_VERTEX4S) \
+    X(SGL_CMD_CLIPPLANE) \
+    X(SGL_CMD_COLORMATERIAL) \
+    X(SGL_CMD_FOGF) \
+    X(SGL_CMD_FOGFV) \
+    X(SGL_CMD_FOGI) \
+    X(SGL_CMD_LIGHTF) \
+    X(SGL_CMD_LIGHTFV) \
+    X(SGL_CMD_LIGHTI) \
+    X(SGL_CMD_LIGHTMODELF) \
+    X(SGL_CMD_LIGHTMODELFV) \
+    X(SGL_CMD_LIGHTMODELI) \
+    X(SGL_CMD_LINESTIPPLE) \
+    X(SGL_CMD_MATERIALF) \
+    X(SGL_CMD_MATERIALFV) \
+    X(SGL_CMD_MATERIALI) \
+    X(SGL_CMD_POLYGONSTIPPLE) \
+    X(SGL_CMD_SHADEMODEL) \
+    X(SGL_CMD_TEXENVF) \
+    X(SGL_CMD_TEXENVFV) \
+    X(SGL_CMD_TEXENVI) \
+    X(SGL_CMD_TEXENVIV) \
+    X(SGL_CMD_TEXGEND) \
+    X(SGL_CMD_TEXGENF) \
+    X(SGL_CMD_TEXGENI) \
+    X(SGL_CMD_FEEDBACKBUFFER) \
+    X(SGL_CMD_SELECTBUFFER) \
+    X(SGL_CMD_RENDERMODE) \
+    X(SGL_CMD_INITNAMES) \
+    X(SGL_CMD_LOADNAME) \
+    X(SGL_CMD_PASSTHROUGH) \
+    X(SGL_CMD_POPNAME) \
+    X(SGL_CMD_PUSHNAME) \
+    X(SGL_CMD_CLEARACCUM) \
+    X(SGL_CMD_CLEARINDEX) \
+    X(SGL_CMD_INDEXMASK) \
+    X(SGL_CMD_ACCUM) \
+    X(SGL_CMD_POPATTRIB) \
+    X(SGL_CMD_PUSHATTRIB) \
+    X(SGL_CMD_MAP1F) \
+    X(SGL_CMD_MAPGRID1D) \
+    X(SGL_CMD_MAPGRID1F) \
+    X(SGL_CMD_MAPGRID2D) \
+    X(SGL_CMD_MAPGRID2F) \
+    X(SGL_CMD_EVALCOORD1D) \
+    X(SGL_CMD_EVALCOORD1F) \
+    X(SGL_CMD_EVALCOORD2D) \
+    X(SGL_CMD_EVALCOORD2F) \
+    X(SGL_CMD_EVALMESH1) \
+    X(SGL_CMD_EVALPOINT1) \
+    X(SGL_CMD_EVALMESH2) \
+    X(SGL_CMD_EVALPOINT2) \
+    X(SGL_CMD_ALPHAFUNC) \
+    X(SGL_CMD_PIXELZOOM) \
+    X(SGL_CMD_PIXELTRANSFERF) \
+    X(SGL_CMD_PIXELTRANSFERI) \
+    X(SGL_CMD_PIXELMAPFV) \
+    X(SGL_CMD_PIXELMAPUIV) \
+    X(SGL_CMD_COPYPIXELS) \
+    X(SGL_CMD_GETCLIPPLANE) \
+    X(SGL_CMD_GETLIGHTFV) \
+    X(SGL_CMD_GETLIGHTIV) \
+    X(SGL_CMD_GETMATERIALFV) \
+    X(SGL_CMD_GETMATERIALIV) \
+    X(SGL_CMD_GETTEXENVFV) \
+    X(SGL_CMD_GETTEXENVIV) \
+    X(SGL_CMD_GETTEXGENDV) \
+    X(SGL_CMD_GETTEXGENFV) \
+    X(SGL_CMD_GETTEXGENIV) \
+    X(SGL_CMD_ISLIST) \
+    X(SGL_CMD_FRUSTUM) \
+    X(SGL_CMD_LOADIDENTITY) \
+    X(SGL_CMD_LOADMATRIXF) \
+    X(SGL_CMD_LOADMATRIXD) \
+    X(SGL_CMD_MATRIXMODE) \
+    X(SGL_CMD_MULTMATRIXF) \
+    X(SGL_CMD_MULTMATRIXD) \
+    X(SGL_CMD_ORTHO) \
+    X(SGL_CMD_POPMATRIX) \
+    X(SGL_CMD_PUSHMATRIX) \
+    X(SGL_CMD_ROTATED) \
+    X(SGL_CMD_ROTATEF) \
+    X(SGL_CMD_SCALED) \
+    X(SGL_CMD_SCALEF) \
+    X(SGL_CMD_TRANSLATED) \
+    X(SGL_CMD_TRANSLATEF) \
+    X(SGL_CMD_DRAWARRAYS) \
+    X(SGL_CMD_DRAWELEMENTS) \
+    X(SGL_CMD_POLYGONOFFSET) \
+    X(SGL_CMD_COPYTEXIMAGE1D) \
+    X(SGL_CMD_COPYTEXIMAGE2D) \
+    X(SGL_CMD_COPYTEXSUBIMAGE1D) \
+    X(SGL_CMD_COPYTEXSUBIMAGE2D) \
+    X(SGL_CMD_TEXSUBIMAGE1D) \
+    X(SGL_CMD_TEXSUBIMAGE2D) \
+    X(SGL_CMD_BINDTEXTURE) \
+    X(SGL_CMD_DELETETEXTURES) \
+    X(SGL_CMD_GENTEXTURES) \
+    X(SGL_CMD_ISTEXTURE) \
+    X(SGL_CMD_ARRAYELEMENT) \
+    X(SGL_CMD_COLORPOINTER) \
+    X(SGL_CMD_DISABLECLIENTSTATE) \
+    X(SGL_CMD_ENABLECLIENTSTATE) \
+    X(SGL_CMD_NORMALPOINTER) \
+    X(SGL_CMD_TEXCOORDPOINTER) \
+    X(SGL_CMD_VERTEXPOINTER) \
+    X(SGL_CMD_ARETEXTURESRESIDENT) \
+    X(SGL_CMD_PRIORITIZETEXTURES) \
+    X(SGL_CMD_INDEXUB) \
+    X(SGL_CMD_POPCLIENTATTRIB) \
+    X(SGL_CMD_PUSHCLIENTATTRIB) \
+    X(SGL_CMD_TEXIMAGE3D) \
+    X(SGL_CMD_TEXSUBIMAGE3D) \
+    X(SGL_CMD_COPYTEXSUBIMAGE3D) \
+    X(SGL_CMD_ACTIVETEXTURE) \
+    X(SGL_CMD_SAMPLECOVERAGE) \
+    X(SGL_CMD_COMPRESSEDTEXIMAGE3D) \
+    X(SGL_CMD_COMPRESSEDTEXIMAGE2D) \
+    X(SGL_CMD_COMPRESSEDTEXIMAGE1D) \
+    X(SGL_CMD_COMPRESSEDTEXSUBIMAGE3D) \
+    X(SGL_CMD_COMPRESSEDTEXSUBIMAGE2D) \
+    X(SGL_CMD_COMPRESSEDTEXSUBIMAGE1D) \
+    X(SGL_CMD_CLIENTACTIVETEXTURE) \
+    X(SGL_CMD_MULTITEXCOORD1D) \
+    X(SGL_CMD_MULTITEXCOORD1F) \
+    X(SGL_CMD_MULTITEXCOORD1I) \
+    X(SGL_CMD_MULTITEXCOORD1S) \
+    X(SGL_CMD_MULTITEXCOORD2D) \
+    X(SGL_CMD_MULTITEXCOORD2F) \
+    X(SGL_CMD_MULTITEXCOORD2I) \
+    X(SGL_CMD_MULTITEXCOORD2S) \
+    X(SGL_CMD_MULTITEXCOORD3D) \
+    X(SGL_CMD_MULTITEXCOORD3F) \
+    X(SGL_CMD_MULTITEXCOORD3I) \
+    X(SGL_CMD_MULTITEXCOORD3S) \
+    X(SGL_CMD_MULTITEXCOORD4D) \
+    X(SGL_CMD_MULTITEXCOORD4F) \
+    X(SGL_CMD_MULTITEXCOORD4I) \
+    X(SGL_CMD_MULTITEXCOORD4S) \
+    X(SGL_CMD_LOADTRANSPOSEMATRIXF) \
+    X(SGL_CMD_MULTTRANSPOSEMATRIXF) \
+    X(SGL_CMD_BLENDFUNCSEPARATE) \
+    X(SGL_CMD_POINTPARAMETERF) \
+    X(SGL_CMD_POINTPARAMETERI) \
+    X(SGL_CMD_FOGCOORDF) \
+    X(SGL_CMD_FOGCOORDD) \
+    X(SGL_CMD_SECONDARYCOLOR3B) \
+    X(SGL_CMD_SECONDARYCOLOR3D) \
+    X(SGL_CMD_SECONDARYCOLOR3F) \
+    X(SGL_CMD_SECONDARYCOLOR3I) \
+    X(SGL_CMD_SECONDARYCOLOR3S) \
+    X(SGL_CMD_SECONDARYCOLOR3UB) \
+    X(SGL_CMD_SECONDARYCOLOR3UI) \
+    X(SGL_CMD_SECONDARYCOLOR3US) \
+    X(SGL_CMD_WINDOWPOS2D) \
+    X(SGL_CMD_WINDOWPOS2F) \
+    X(SGL_CMD_WINDOWPOS2I) \
+    X(SGL_CMD_WINDOWPOS2S) \
+    X(SGL_CMD_WINDOWPOS3D) \
+    X(SGL_CMD_WINDOWPOS3F) \
+    X(SGL_CMD_WINDOWPOS3I) \
+    X(SGL_CMD_WINDOWPOS3S) \
+    X(SGL_CMD_BLENDCOLOR) \
+    X(SGL_CMD_BLENDEQUATION) \
+    X(SGL_CMD_GENQUERIES) \
+    X(SGL_CMD_DELETEQUERIES) \
+    X(SGL_CMD_ISQUERY) \
+    X(SGL_CMD_BEGINQUERY) \
+    X(SGL_CMD_ENDQUERY) \
+    X(SGL_CMD_GETQUERYIV) \
+    X(SGL_CMD_GETQUERYOBJECTIV) \
+    X(SGL_CMD_GETQUERYOBJECTUIV) \
+    X(SGL_CMD_BINDBUFFER) \
+    X(SGL_CMD_DELETEBUFFERS) \
+    X(SGL_CMD_GENBUFFERS) \
+    X(SGL_CMD_ISBUFFER) \
+    X(SGL_CMD_BUFFERDATA) \
+    X(SGL_CMD_BUFFERSUBDATA) \
+    X(SGL_CMD_MAPBUFFER) \
+    X(SGL_CMD_UNMAPBUFFER) \
+    X(SGL_CMD_GETBUFFERPARAMETERIV) \
+    X(SGL_CMD_BLENDEQUATIONSEPARATE) \
+    X(SGL_CMD_DRAWBUFFERS) \
+    X(SGL_CMD_STENCILOPSEPARATE) \
+    X(SGL_CMD_STENCILFUNCSEPARATE) \
+    X(SGL_CMD_STENCILMASKSEPARATE) \
+    X(SGL_CMD_ATTACHSHADER) \
+    X(SGL_CMD_BINDATTRIBLOCATION) \
+    X(SGL_CMD_COMPILESHADER) \
+    X(SGL_CMD_CREATEPROGRAM) \
+    X(SGL_CMD_CREATESHADER) \
+    X(SGL_CMD_DELETEPROGRAM) \
+    X(SGL_CMD_DELETESHADER) \
+    X(SGL_CMD_DETACHSHADER) \
+    X(SGL_CMD_DISABLEVERTEXATTRIBARRAY) \
+    X(SGL_CMD_ENABLEVERTEXATTRIBARRAY) \
+    X(SGL_CMD_GETACTIVEATTRIB) \
+    X(SGL_CMD_GETACTIVEUNIFORM) \
+    X(SGL_CMD_GETATTACHEDSHADERS) \
+    X(SGL_CMD_GETATTRIBLOCATION) \
+    X(SGL_CMD_GETPROGRAMIV) \
+    X(SGL_CMD_GETPROGRAMINFOLOG) \
+    X(SGL_CMD_GETSHADERIV) \
+    X(SGL_CMD_GETSHADERINFOLOG) \
+    X(SGL_CMD_GETSHADERSOURCE) \
+    X(SGL_CMD_GETUNIFORMLOCATION) \
+    X(SGL_CMD_GETUNIFORMFV) \
+    X(SGL_CMD_GETUNIFORMIV) \
+    X(SGL_CMD_GETVERTEXATTRIBDV) \
+    X(SGL_CMD_GETVERTEXATTRIBFV) \
+    X(SGL_CMD_GETVERTEXATTRIBIV) \
+    X(SGL_CMD_ISPROGRAM) \
+    X(SGL_CMD_ISSHADER) \
+    X(SGL_CMD_LINKPROGRAM) \
+    X(SGL_CMD_SHADERSOURCE) \
+    X(SGL_CMD_USEPROGRAM) \
+    X(SGL_CMD_UNIFORM1F) \
+    X(SGL_CMD_UNIFORM2F) \
+    X(SGL_CMD_UNIFORM3F) \
+    X(SGL_CMD_UNIFORM4F) \
+    X(SGL_CMD_UNIFORM1I) \
+    X(SGL_CMD_UNIFORM2I) \
+    X(SGL_CMD_UNIFORM3I) \
+    X(SGL_CMD_UNIFORM4I) \
+    X(SGL_CMD_UNIFORMMATRIX2FV) \
+    X(SGL_CMD_UNIFORMMATRIX3FV) \
+    X(SGL_CMD_UNIFORMMATRIX4FV) \
+    X(SGL_CMD_VALIDATEPROGRAM) \
+    X(SGL_CMD_VERTEXATTRIB1D) \
+    X(SGL_CMD_VERTEXATTRIB1F) \
+    X(SGL_CMD_VERTEXATTRIB1S) \
+    X(SGL_CMD_VERTEXATTRIB2D) \
+    X(SGL_CMD_VERTEXATTRIB2F) \
+    X(SGL_CMD_VERTEXATTRIB2S) \
+    X(SGL_CMD_VERTEXATTRIB3D) \
+    X(SGL_CMD_VERTEXATTRIB3F) \
+    X(SGL_CMD_VERTEXATTRIB3S) \
+    X(SGL_CMD_VERTEXATTRIB4NBV) \
+    X(SGL_CMD_VERTEXATTRIB4NIV) \
+    X(SGL_CMD_VERTEXATTRIB4NSV) \
+    X(SGL_CMD_VERTEXATTRIB4NUB) \
+    X(SGL_CMD_VERTEXATTRIB4NUIV) \
+    X(SGL_CMD_VERTEXATTRIB4NUSV) \
+    X(SGL_CMD_VERTEXATTRIB4BV) \
+    X(SGL_CMD_VERTEXATTRIB4D) \
+    X(SGL_CMD_VERTEXATTRIB4F) \
+    X(SGL_CMD_VERTEXATTRIB4IV) \
+    X(SGL_CMD_VERTEXATTRIB4S) \
+    X(SGL_CMD_VERTEXATTRIB4SV) \
+    X(SGL_CMD_VERTEXATTRIB4UIV) \
+    X(SGL_CMD_VERTEXATTRIB4USV) \
+    X(SGL_CMD_VERTEXATTRIBPOINTER) \
+    X(SGL_CMD_UNIFORMMATRIX2X3FV) \
+    X(SGL_CMD_UNIFORMMATRIX3X2FV) \
+    X(SGL_CMD_UNIFORMMATRIX2X4FV) \
+    X(SGL_CMD_UNIFORMMATRIX4X2FV) \
+    X(SGL_CMD_UNIFORMMATRIX3X4FV) \
+    X(SGL_CMD_UNIFORMMATRIX4X3FV) \
+    X(SGL_CMD_COLORMASKI) \
+    X(SGL_CMD_GETBOOLEANI_V) \
+    X(SGL_CMD_GETINTEGERI_V) \
+    X(SGL_CMD_ENABLEI) \
+    X(SGL_CMD_DISABLEI) \
+    X(SGL_CMD_ISENABLEDI) \
+    X(SGL_CMD_BEGINTRANSFORMFEEDBACK) \
+    X(SGL_CMD_ENDTRANSFORMFEEDBACK) \
+    X(SGL_CMD_BINDBUFFERRANGE) \
+    X(SGL_CMD_BINDBUFFERBASE) \
+    X(SGL_CMD_TRANSFORMFEEDBACKVARYINGS) \
+    X(SGL_CMD_GETTRANSFORMFEEDBACKVARYING) \
+    X(SGL_CMD_CLAMPCOLOR) \
+    X(SGL_CMD_BEGINCONDITIONALRENDER) \
+    X(SGL_CMD_ENDCONDITIONALRENDER) \
+    X(SGL_CMD_VERTEXATTRIBIPOINTER) \
+    X(SGL_CMD_VERTEXATTRIBI1I) \
+    X(SGL_CMD_VERTEXATTRIBI2I) \
+    X(SGL_CMD_VERTEXATTRIBI3I) \
+    X(SGL_CMD_VERTEXATTRIBI4I) \
+    X(SGL_CMD_VERTEXATTRIBI1UI) \
+    X(SGL_CMD_VERTEXATTRIBI2UI) \
+    X(SGL_CMD_VERTEXATTRIBI3UI) \
+    X(SGL_CMD_VERTEXATTRIBI4UI) \
+    X(SGL_CMD_BINDFRAGDATALOCATION) \
+    X(SGL_CMD_GETFRAGDATALOCATION) \
+    X(SGL_CMD_UNIFORM1UI) \
+    X(SGL_CMD_UNIFORM2UI) \
+    X(SGL_CMD_UNIFORM3UI) \
+    X(SGL_CMD_UNIFORM4UI) \
+    X(SGL_CMD_CLEARBUFFERIV) \
+    X(SGL_CMD_CLEARBUFFERUIV) \
+    X(SGL_CMD_CLEARBUFFERFV) \
+    X(SGL_CMD_CLEARBUFFERFI) \
+    X(SGL_CMD_ISRENDERBUFFER) \
+    X(SGL_CMD_BINDRENDERBUFFER) \
+    X(SGL_CMD_DELETERENDERBUFFERS) \
+    X(SGL_CMD_GENRENDERBUFFERS) \
+    X(SGL_CMD_RENDERBUFFERSTORAGE) \
+    X(SGL_CMD_GETRENDERBUFFERPARAMETERIV) \
+    X(SGL_CMD_ISFRAMEBUFFER) \
+    X(SGL_CMD_BINDFRAMEBUFFER) \
+    X(SGL_CMD_DELETEFRAMEBUFFERS) \
+    X(SGL_CMD_GENFRAMEBUFFERS) \
+    X(SGL_CMD_CHECKFRAMEBUFFERSTATUS) \
+    X(SGL_CMD_FRAMEBUFFERTEXTURE1D) \
+    X(SGL_CMD_FRAMEBUFFERTEXTURE2D) \
+    X(SGL_CMD_FRAMEBUFFERTEXTURE3D) \
+    X(SGL_CMD_FRAMEBUFFERRENDERBUFFER) \
+    X(SGL_CMD_GETFRAMEBUFFERATTACHMENTPARAMETERIV) \
+    X(SGL_CMD_GENERATEMIPMAP) \
+    X(SGL_CMD_BLITFRAMEBUFFER) \
+    X(SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE) \
+    X(SGL_CMD_FRAMEBUFFERTEXTURELAYER) \
+    X(SGL_CMD_MAPBUFFERRANGE) \
+    X(SGL_CMD_FLUSHMAPPEDBUFFERRANGE) \
+    X(SGL_CMD_BINDVERTEXARRAY) \
+    X(SGL_CMD_DELETEVERTEXARRAYS) \
+    X(SGL_CMD_GENVERTEXARRAYS) \
+    X(SGL_CMD_ISVERTEXARRAY) \
+    X(SGL_CMD_DRAWARRAYSINSTANCED) \
+    X(SGL_CMD_DRAWELEMENTSINSTANCED) \
+    X(SGL_CMD_TEXBUFFER) \
+    X(SGL_CMD_PRIMITIVERESTARTINDEX) \
+    X(SGL_CMD_COPYBUFFERSUBDATA) \
+    X(SGL_CMD_GETUNIFORMINDICES) \
+    X(SGL_CMD_GETACTIVEUNIFORMSIV) \
+    X(SGL_CMD_GETACTIVEUNIFORMNAME) \
+    X(SGL_CMD_GETUNIFORMBLOCKINDEX) \
+    X(SGL_CMD_GETACTIVEUNIFORMBLOCKIV) \
+    X(SGL_CMD_GETACTIVEUNIFORMBLOCKNAME) \
+    X(SGL_CMD_UNIFORMBLOCKBINDING) \
+    X(SGL_CMD_DRAWELEMENTSBASEVERTEX) \
+    X(SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX) \
+    X(SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEX) \
+    X(SGL_CMD_PROVOKINGVERTEX) \
+    X(SGL_CMD_FENCESYNC) \
+    X(SGL_CMD_DELETESYNC) \
+    X(SGL_CMD_CLIENTWAITSYNC) \
+    X(SGL_CMD_FRAMEBUFFERTEXTURE) \
+    X(SGL_CMD_TEXIMAGE2DMULTISAMPLE) \
+    X(SGL_CMD_TEXIMAGE3DMULTISAMPLE) \
+    X(SGL_CMD_GETMULTISAMPLEFV) \
+    X(SGL_CMD_SAMPLEMASKI) \
+    X(SGL_CMD_BINDFRAGDATALOCATIONINDEXED) \
+    X(SGL_CMD_GETFRAGDATAINDEX) \
+    X(SGL_CMD_GENSAMPLERS) \
+    X(SGL_CMD_DELETESAMPLERS) \
+    X(SGL_CMD_ISSAMPLER) \
+    X(SGL_CMD_BINDSAMPLER) \
+    X(SGL_CMD_SAMPLERPARAMETERI) \
+    X(SGL_CMD_SAMPLERPARAMETERF) \
+    X(SGL_CMD_QUERYCOUNTER) \
+    X(SGL_CMD_GETQUERYOBJECTUI64V) \
+    X(SGL_CMD_VERTEXATTRIBDIVISOR) \
+    X(SGL_CMD_VERTEXATTRIBP1UI) \
+    X(SGL_CMD_VERTEXATTRIBP2UI) \
+    X(SGL_CMD_VERTEXATTRIBP3UI) \
+    X(SGL_CMD_VERTEXATTRIBP4UI) \
+    X(SGL_CMD_VERTEXP2UI) \
+    X(SGL_CMD_VERTEXP3UI) \
+    X(SGL_CMD_VERTEXP4UI) \
+    X(SGL_CMD_TEXCOORDP1UI) \
+    X(SGL_CMD_TEXCOORDP2UI) \
+    X(SGL_CMD_TEXCOORDP3UI) \
+    X(SGL_CMD_TEXCOORDP4UI) \
+    X(SGL_CMD_MULTITEXCOORDP1UI) \
+    X(SGL_CMD_MULTITEXCOORDP2UI) \
+    X(SGL_CMD_MULTITEXCOORDP3UI) \
+    X(SGL_CMD_MULTITEXCOORDP4UI) \
+    X(SGL_CMD_NORMALP3UI) \
+    X(SGL_CMD_COLORP3UI) \
+    X(SGL_CMD_COLORP4UI) \
+    X(SGL_CMD_SECONDARYCOLORP3UI) \
+    X(SGL_CMD_MINSAMPLESHADING) \
+    X(SGL_CMD_BLENDEQUATIONI) \
+    X(SGL_CMD_BLENDEQUATIONSEPARATEI) \
+    X(SGL_CMD_BLENDFUNCI) \
+    X(SGL_CMD_BLENDFUNCSEPARATEI) \
+    X(SGL_CMD_DRAWARRAYSINDIRECT) \
+    X(SGL_CMD_DRAWELEMENTSINDIRECT) \
+    X(SGL_CMD_UNIFORM1D) \
+    X(SGL_CMD_UNIFORM2D) \
+    X(SGL_CMD_UNIFORM3D) \
+    X(SGL_CMD_UNIFORM4D) \
+    X(SGL_CMD_GETUNIFORMDV) \
+    X(SGL_CMD_GETSUBROUTINEUNIFORMLOCATION) \
+    X(SGL_CMD_GETSUBROUTINEINDEX) \
+    X(SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV) \
+    X(SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME) \
+    X(SGL_CMD_GETACTIVESUBROUTINENAME) \
+    X(SGL_CMD_UNIFORMSUBROUTINESUIV) \
+    X(SGL_CMD_GETUNIFORMSUBROUTINEUIV) \
+    X(SGL_CMD_GETPROGRAMSTAGEIV) \
+    X(SGL_CMD_PATCHPARAMETERI) \
+    X(SGL_CMD_PATCHPARAMETERFV) \
+    X(SGL_CMD_BINDTRANSFORMFEEDBACK) \
+    X(SGL_CMD_DELETETRANSFORMFEEDBACKS) \
+    X(SGL_CMD_GENTRANSFORMFEEDBACKS) \
+    X(SGL_CMD_ISTRANSFORMFEEDBACK) \
+    X(SGL_CMD_PAUSETRANSFORMFEEDBACK) \
+    X(SGL_CMD_RESUMETRANSFORMFEEDBACK) \
+    X(SGL_CMD_DRAWTRANSFORMFEEDBACK) \
+    X(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM) \
+    X(SGL_CMD_BEGINQUERYINDEXED) \
+    X(SGL_CMD_ENDQUERYINDEXED) \
+    X(SGL_CMD_GETQUERYINDEXEDIV) \
+    X(SGL_CMD_RELEASESHADERCOMPILER) \
+    X(SGL_CMD_SHADERBINARY) \
+    X(SGL_CMD_GETSHADERPRECISIONFORMAT) \
+    X(SGL_CMD_DEPTHRANGEF) \
+    X(SGL_CMD_CLEARDEPTHF) \
+    X(SGL_CMD_GETPROGRAMBINARY) \
+    X(SGL_CMD_PROGRAMBINARY) \
+    X(SGL_CMD_PROGRAMPARAMETERI) \
+    X(SGL_CMD_USEPROGRAMSTAGES) \
+    X(SGL_CMD_ACTIVESHADERPROGRAM) \
+    X(SGL_CMD_CREATESHADERPROGRAMV) \
+    X(SGL_CMD_BINDPROGRAMPIPELINE) \
+    X(SGL_CMD_DELETEPROGRAMPIPELINES) \
+    X(SGL_CMD_GENPROGRAMPIPELINES) \
+    X(SGL_CMD_ISPROGRAMPIPELINE) \
+    X(SGL_CMD_GETPROGRAMPIPELINEIV) \
+    X(SGL_CMD_PROGRAMUNIFORM1I) \
+    X(SGL_CMD_PROGRAMUNIFORM1F) \
+    X(SGL_CMD_PROGRAMUNIFORM1D) \
+    X(SGL_CMD_PROGRAMUNIFORM1UI) \
+    X(SGL_CMD_PROGRAMUNIFORM2I) \
+    X(SGL_CMD_PROGRAMUNIFORM2F) \
+    X(SGL_CMD_PROGRAMUNIFORM2D) \
+    X(SGL_CMD_PROGRAMUNIFORM2UI) \
+    X(SGL_CMD_PROGRAMUNIFORM3I) \
+    X(SGL_CMD_PROGRAMUNIFORM3F) \
+    X(SGL_CMD_PROGRAMUNIFORM3D) \
+    X(SGL_CMD_PROGRAMUNIFORM3UI) \
+    X(SGL_CMD_PROGRAMUNIFORM4I) \
+    X(SGL_CMD_PROGRAMUNIFORM4F) \
+    X(SGL_CMD_PROGRAMUNIFORM4D) \
+    X(SGL_CMD_PROGRAMUNIFORM4UI) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX2FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX3FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX4FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX2DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX3DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX4DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX2X3FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX2X3DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX3X2DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX2X4DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX4X2DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX3X4DV) \
+    X(SGL_CMD_PROGRAMUNIFORMMATRIX4X3DV) \
+    X(SGL_CMD_VALIDATEPROGRAMPIPELINE) \
+    X(SGL_CMD_GETPROGRAMPIPELINEINFOLOG) \
+    X(SGL_CMD_VERTEXATTRIBL1D) \
+    X(SGL_CMD_VERTEXATTRIBL2D) \
+    X(SGL_CMD_VERTEXATTRIBL3D) \
+    X(SGL_CMD_VERTEXATTRIBL4D) \
+    X(SGL_CMD_VERTEXATTRIBLPOINTER) \
+    X(SGL_CMD_VIEWPORTARRAYV) \
+    X(SGL_CMD_VIEWPORTINDEXEDF) \
+    X(SGL_CMD_VIEWPORTINDEXEDFV) \
+    X(SGL_CMD_SCISSORARRAYV) \
+    X(SGL_CMD_SCISSORINDEXED) \
+    X(SGL_CMD_SCISSORINDEXEDV) \
+    X(SGL_CMD_DEPTHRANGEARRAYV) \
+    X(SGL_CMD_DEPTHRANGEINDEXED) \
+    X(SGL_CMD_GETFLOATI_V) \
+    X(SGL_CMD_GETDOUBLEI_V) \
+    X(SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE) \
+    X(SGL_CMD_DRAWELEMENTSINSTANCEDBASEINSTANCE) \
+    X(SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE) \
+    X(SGL_CMD_GETINTERNALFORMATIV) \
+    X(SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV) \
+    X(SGL_CMD_BINDIMAGETEXTURE) \
+    X(SGL_CMD_MEMORYBARRIER) \
+    X(SGL_CMD_TEXSTORAGE1D) \
+    X(SGL_CMD_TEXSTORAGE2D) \
+    X(SGL_CMD_TEXSTORAGE3D) \
+    X(SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED) \
+    X(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED) \
+    X(SGL_CMD_CLEARBUFFERDATA) \
+    X(SGL_CMD_CLEARBUFFERSUBDATA) \
+    X(SGL_CMD_DISPATCHCOMPUTE) \
+    X(SGL_CMD_DISPATCHCOMPUTEINDIRECT) \
+    X(SGL_CMD_COPYIMAGESUBDATA) \
+    X(SGL_CMD_FRAMEBUFFERPARAMETERI) \
+    X(SGL_CMD_GETFRAMEBUFFERPARAMETERIV) \
+    X(SGL_CMD_GETINTERNALFORMATI64V) \
+    X(SGL_CMD_INVALIDATETEXSUBIMAGE) \
+    X(SGL_CMD_INVALIDATETEXIMAGE) \
+    X(SGL_CMD_INVALIDATEBUFFERSUBDATA) \
+    X(SGL_CMD_INVALIDATEBUFFERDATA) \
+    X(SGL_CMD_INVALIDATEFRAMEBUFFER) \
+    X(SGL_CMD_INVALIDATESUBFRAMEBUFFER) \
+    X(SGL_CMD_MULTIDRAWARRAYSINDIRECT) \
+    X(SGL_CMD_MULTIDRAWELEMENTSINDIRECT) \
+    X(SGL_CMD_GETPROGRAMINTERFACEIV) \
+    X(SGL_CMD_GETPROGRAMRESOURCEINDEX) \
+    X(SGL_CMD_GETPROGRAMRESOURCENAME) \
+    X(SGL_CMD_GETPROGRAMRESOURCEIV) \
+    X(SGL_CMD_GETPROGRAMRESOURCELOCATION) \
+    X(SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX) \
+    X(SGL_CMD_SHADERSTORAGEBLOCKBINDING) \
+    X(SGL_CMD_TEXBUFFERRANGE) \
+    X(SGL_CMD_TEXSTORAGE2DMULTISAMPLE) \
+    X(SGL_CMD_TEXSTORAGE3DMULTISAMPLE) \
+    X(SGL_CMD_TEXTUREVIEW) \
+    X(SGL_CMD_BINDVERTEXBUFFER) \
+    X(SGL_CMD_VERTEXATTRIBFORMAT) \
+    X(SGL_CMD_VERTEXATTRIBIFORMAT) \
+    X(SGL_CMD_VERTEXATTRIBLFORMAT) \
+    X(SGL_CMD_VERTEXATTRIBBINDING) \
+    X(SGL_CMD_VERTEXBINDINGDIVISOR) \
+    X(SGL_CMD_DEBUGMESSAGECONTROL) \
+    X(SGL_CMD_DEBUGMESSAGEINSERT) \
+    X(SGL_CMD_DEBUGMESSAGECALLBACK) \
+    X(SGL_CMD_GETDEBUGMESSAGELOG) \
+    X(SGL_CMD_PUSHDEBUGGROUP) \
+    X(SGL_CMD_POPDEBUGGROUP) \
+    X(SGL_CMD_OBJECTLABEL) \
+    X(SGL_CMD_GETOBJECTLABEL) \
+    X(SGL_CMD_OBJECTPTRLABEL) \
+    X(SGL_CMD_GETOBJECTPTRLABEL) \
+    X(SGL_CMD_BUFFERSTORAGE) \
+    X(SGL_CMD_CLEARTEXIMAGE) \
+    X(SGL_CMD_CLEARTEXSUBIMAGE) \
+    X(SGL_CMD_BINDBUFFERSBASE) \
+    X(SGL_CMD_BINDBUFFERSRANGE) \
+    X(SGL_CMD_BINDTEXTURES) \
+    X(SGL_CMD_BINDSAMPLERS) \
+    X(SGL_CMD_BINDIMAGETEXTURES) \
+    X(SGL_CMD_BINDVERTEXBUFFERS) \
+    X(SGL_CMD_CLIPCONTROL) \
+    X(SGL_CMD_CREATETRANSFORMFEEDBACKS) \
+    X(SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE) \
+    X(SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE) \
+    X(SGL_CMD_GETTRANSFORMFEEDBACKIV) \
+    X(SGL_CMD_GETTRANSFORMFEEDBACKI_V) \
+    X(SGL_CMD_GETTRANSFORMFEEDBACKI64_V) \
+    X(SGL_CMD_CREATEBUFFERS) \
+    X(SGL_CMD_NAMEDBUFFERSTORAGE) \
+    X(SGL_CMD_NAMEDBUFFERDATA) \
+    X(SGL_CMD_NAMEDBUFFERSUBDATA) \
+    X(SGL_CMD_COPYNAMEDBUFFERSUBDATA) \
+    X(SGL_CMD_CLEARNAMEDBUFFERDATA) \
+    X(SGL_CMD_CLEARNAMEDBUFFERSUBDATA) \
+    X(SGL_CMD_MAPNAMEDBUFFER) \
+    X(SGL_CMD_MAPNAMEDBUFFERRANGE) \
+    X(SGL_CMD_UNMAPNAMEDBUFFER) \
+    X(SGL_CMD_FLUSHMAPPEDNAMEDBUFFERRANGE) \
+    X(SGL_CMD_GETNAMEDBUFFERPARAMETERIV) \
+    X(SGL_CMD_GETNAMEDBUFFERPARAMETERI64V) \
+    X(SGL_CMD_GETNAMEDBUFFERPOINTERV) \
+    X(SGL_CMD_GETNAMEDBUFFERSUBDATA) \
+    X(SGL_CMD_CREATEFRAMEBUFFERS) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERTEXTURE) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS) \
+    X(SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER) \
+    X(SGL_CMD_INVALIDATENAMEDFRAMEBUFFERDATA) \
+    X(SGL_CMD_INVALIDATENAMEDFRAMEBUFFERSUBDATA) \
+    X(SGL_CMD_CLEARNAMEDFRAMEBUFFERIV) \
+    X(SGL_CMD_CLEARNAMEDFRAMEBUFFERUIV) \
+    X(SGL_CMD_CLEARNAMEDFRAMEBUFFERFV) \
+    X(SGL_CMD_CLEARNAMEDFRAMEBUFFERFI) \
+    X(SGL_CMD_BLITNAMEDFRAMEBUFFER) \
+    X(SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS) \
+    X(SGL_CMD_GETNAMEDFRAMEBUFFERPARAMETERIV) \
+    X(SGL_CMD_GETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIV) \
+    X(SGL_CMD_CREATERENDERBUFFERS) \
+    X(SGL_CMD_NAMEDRENDERBUFFERSTORAGE) \
+    X(SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE) \
+    X(SGL_CMD_GETNAMEDRENDERBUFFERPARAMETERIV) \
+    X(SGL_CMD_CREATETEXTURES) \
+    X(SGL_CMD_TEXTUREBUFFER) \
+    X(SGL_CMD_TEXTUREBUFFERRANGE) \
+    X(SGL_CMD_TEXTURESTORAGE1D) \
+    X(SGL_CMD_TEXTURESTORAGE2D) \
+    X(SGL_CMD_TEXTURESTORAGE3D) \
+    X(SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE) \
+    X(SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE) \
+    X(SGL_CMD_TEXTURESUBIMAGE1D) \
+    X(SGL_CMD_TEXTURESUBIMAGE2D) \
+    X(SGL_CMD_TEXTURESUBIMAGE3D) \
+    X(SGL_CMD_COMPRESSEDTEXTURESUBIMAGE1D) \
+    X(SGL_CMD_COMPRESSEDTEXTURESUBIMAGE2D) \
+    X(SGL_CMD_COMPRESSEDTEXTURESUBIMAGE3D) \
+    X(SGL_CMD_COPYTEXTURESUBIMAGE1D) \
+    X(SGL_CMD_COPYTEXTURESUBIMAGE2D) \
+    X(SGL_CMD_COPYTEXTURESUBIMAGE3D) \
+    X(SGL_CMD_TEXTUREPARAMETERF) \
+    X(SGL_CMD_TEXTUREPARAMETERFV) \
+    X(SGL_CMD_TEXTUREPARAMETERI) \
+    X(SGL_CMD_TEXTUREPARAMETERIIV) \
+    X(SGL_CMD_TEXTUREPARAMETERIUIV) \
+    X(SGL_CMD_TEXTUREPARAMETERIV) \
+    X(SGL_CMD_GENERATETEXTUREMIPMAP) \
+    X(SGL_CMD_BINDTEXTUREUNIT) \
+    X(SGL_CMD_GETTEXTUREIMAGE) \
+    X(SGL_CMD_GETCOMPRESSEDTEXTUREIMAGE) \
+    X(SGL_CMD_GETTEXTURELEVELPARAMETERFV) \
+    X(SGL_CMD_GETTEXTURELEVELPARAMETERIV) \
+    X(SGL_CMD_GETTEXTUREPARAMETERFV) \
+    X(SGL_CMD_GETTEXTUREPARAMETERIIV) \
+    X(SGL_CMD_GETTEXTUREPARAMETERIUIV) \
+    X(SGL_CMD_GETTEXTUREPARAMETERIV) \
+    X(SGL_CMD_CREATEVERTEXARRAYS) \
+    X(SGL_CMD_DISABLEVERTEXARRAYATTRIB) \
+    X(SGL_CMD_ENABLEVERTEXARRAYATTRIB) \
+    X(SGL_CMD_VERTEXARRAYELEMENTBUFFER) \
+    X(SGL_CMD_VERTEXARRAYVERTEXBUFFER) \
+    X(SGL_CMD_VERTEXARRAYVERTEXBUFFERS) \
+    X(SGL_CMD_VERTEXARRAYATTRIBBINDING) \
+    X(SGL_CMD_VERTEXARRAYATTRIBFORMAT) \
+    X(SGL_CMD_VERTEXARRAYATTRIBIFORMAT) \
+    X(SGL_CMD_VERTEXARRAYATTRIBLFORMAT) \
+    X(SGL_CMD_VERTEXARRAYBINDINGDIVISOR) \
+    X(SGL_CMD_GETVERTEXARRAYIV) \
+    X(SGL_CMD_GETVERTEXARRAYINDEXEDIV) \
+    X(SGL_CMD_GETVERTEXARRAYINDEXED64IV) \
+    X(SGL_CMD_CREATESAMPLERS) \
+    X(SGL_CMD_CREATEPROGRAMPIPELINES) \
+    X(SGL_CMD_CREATEQUERIES) \
+    X(SGL_CMD_GETQUERYBUFFEROBJECTI64V) \
+    X(SGL_CMD_GETQUERYBUFFEROBJECTIV) \
+    X(SGL_CMD_GETQUERYBUFFEROBJECTUI64V) \
+    X(SGL_CMD_GETQUERYBUFFEROBJECTUIV) \
+    X(SGL_CMD_MEMORYBARRIERBYREGION) \
+    X(SGL_CMD_GETTEXTURESUBIMAGE) \
+    X(SGL_CMD_GETCOMPRESSEDTEXTURESUBIMAGE) \
+    X(SGL_CMD_GETGRAPHICSRESETSTATUS) \
+    X(SGL_CMD_GETNCOMPRESSEDTEXIMAGE) \
+    X(SGL_CMD_GETNTEXIMAGE) \
+    X(SGL_CMD_GETNUNIFORMDV) \
+    X(SGL_CMD_GETNUNIFORMFV) \
+    X(SGL_CMD_GETNUNIFORMIV) \
+    X(SGL_CMD_GETNUNIFORMUIV) \
+    X(SGL_CMD_READNPIXELS) \
+    X(SGL_CMD_GETNMAPDV) \
+    X(SGL_CMD_GETNMAPFV) \
+    X(SGL_CMD_GETNMAPIV) \
+    X(SGL_CMD_GETNPIXELMAPFV) \
+    X(SGL_CMD_GETNPIXELMAPUIV) \
+    X(SGL_CMD_GETNPIXELMAPUSV) \
+    X(SGL_CMD_GETNPOLYGONSTIPPLE) \
+    X(SGL_CMD_GETNCOLORTABLE) \
+    X(SGL_CMD_GETNCONVOLUTIONFILTER) \
+    X(SGL_CMD_GETNSEPARABLEFILTER) \
+    X(SGL_CMD_GETNHISTOGRAM) \
+    X(SGL_CMD_GETNMINMAX) \
+    X(SGL_CMD_TEXTUREBARRIER) \
+    X(SGL_CMD_POLYGONOFFSETCLAMP) \
+    X(SGL_CMD_GETOBJECTPARAMETERIVARB) \
+    X(SGL_CMD_ATTACHOBJECTARB) \
+    X(SGL_CMD_BINDATTRIBLOCATIONARB) \
+    X(SGL_CMD_BINDBUFFERARB) \
+    X(SGL_CMD_BINDPROGRAMARB) \
+    X(SGL_CMD_BUFFERDATAARB) \
+    X(SGL_CMD_COMPILESHADERARB) \
+    X(SGL_CMD_CREATEPROGRAMOBJECTARB) \
+    X(SGL_CMD_CREATESHADEROBJECTARB) \
+    X(SGL_CMD_DELETEBUFFERSARB) \
+    X(SGL_CMD_DELETEOBJECTARB) \
+    X(SGL_CMD_DELETEPROGRAMSARB) \
+    X(SGL_CMD_DELETEQUERIESARB) \
+    X(SGL_CMD_DETACHOBJECTARB) \
+    X(SGL_CMD_GENBUFFERSARB) \
+    X(SGL_CMD_GENPROGRAMSARB) \
+    X(SGL_CMD_GENQUERIESARB) \
+    X(SGL_CMD_GETINFOLOGARB) \
+    X(SGL_CMD_GETPROGRAMIVARB) \
+    X(SGL_CMD_GETUNIFORMLOCATIONARB) \
+    X(SGL_CMD_LINKPROGRAMARB) \
+    X(SGL_CMD_MAPBUFFERARB) \
+    X(SGL_CMD_PROGRAMSTRINGARB) \
+    X(SGL_CMD_SHADERSOURCEARB) \
+    X(SGL_CMD_UNIFORM1IARB) \
+    X(SGL_CMD_PROGRAMENVPARAMETERS4FVEXT) \
+    X(SGL_CMD_COLORMASKINDEXEDEXT) \
+    X(SGL_CMD_ENABLEINDEXEDEXT) \
+    X(SGL_CMD_DISABLEINDEXEDEXT) \
+    X(SGL_CMD_GETBOOLEANINDEXEDVEXT) \
+    X(SGL_CMD_ACTIVETEXTUREARB) \
+    X(SGL_CMD_MULTITEXCOORD2FARB) \
+    X(SGL_CMD_BUFFERSUBDATAARB)
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef _SGL_CMDTABLE_H_
+#define _SGL_CMDTABLE_H_
+
+#include <sharedgl.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * how the variable part of a command, which follows its fixed arguments,
+ * is sized. count and bytes are indices of arguments after the opcode
+ */
+enum sgl_cmd_rule {
+    SGL_CMD_RULE_NONE,
+    SGL_CMD_RULE_WORDS,         /* args[count] * scale words */
+    SGL_CMD_RULE_BYTES,         /* args[count] bytes, padded to words */
+    SGL_CMD_RULE_STRING,        /* one nul terminated string, padded to words */
+    SGL_CMD_RULE_STRINGS,       /* args[count] strings */
+    SGL_CMD_RULE_WORDS_BYTES,   /* args[count] * scale words, then args[bytes] bytes */
+};
+
+struct sgl_cmd_desc {
+    unsigned short args;        /* fixed arguments, not counting the opcode */
+    unsigned char rule;
+    unsigned char count;
+    unsigned char scale;
+    unsigned char bytes;
+    unsigned char tail;         /* fixed arguments after the variable part */
+    bool handled;
+};
+
+/*
+ * generated from the decoder by scripts/gencmdtable.py
+ */
+extern const struct sgl_cmd_desc sgl_cmd_table[SGL_CMD_MAX];
+
+/*
+ * length in words of the command at pb, opcode included, without
+ * executing it. returns 0 for commands the decoder doesn't handle or
+ * that don't fit in the available words
+ */
+size_t sgl_cmd_length(const int *pb, size_t available);
+
+#endif
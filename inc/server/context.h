@@ -2,18 +2,69 @@
 #define _SGL_CONTEXT_H_
 
 #include <SDL2/SDL.h>
+#include <server/overlay.h>
+#include <server/names.h>
+#include <server/programcache.h>
+
+/*
+ * frames may be read back into pixel buffers and only copied out a
+ * few frames later, so that reading back doesn't stall the pipeline
+ */
+#define SGL_READBACK_MAX_LATENCY 2
+
+struct sgl_readback_buffer {
+    GLuint pbo;
+    unsigned int width, height;
+    bool pending;
+};
 
 struct sgl_host_context {
     SDL_Window *window;
     SDL_GLContext gl_context;
+
+    /*
+     * each context keeps its own overlay, as contexts
+     * may be read back from different threads
+     */
+    struct overlay_context overlay_ctx;
+
+    /*
+     * frames that need flipping or an overlay are composited here
+     * on the gpu before reading back, see sgl_read_pixels
+     */
+    GLuint composite_fbo, composite_rbo;
+    GLuint overlay_fbo, overlay_texture;
+
+    /*
+     * client to real object names, see names.h
+     */
+    struct sgl_name_table names[SGL_NAME_TYPE_COUNT];
+
+    /*
+     * shaders and programs, see programcache.h
+     */
+    struct sgl_program_tracker programs;
+
+    /*
+     * ring of pixel buffers frames are read back into,
+     * see sgl_set_readback_latency
+     */
+    struct sgl_readback_buffer readback[SGL_READBACK_MAX_LATENCY + 1];
+    int readback_head;
 };
 
 void sgl_set_max_resolution(int width, int height);
 void sgl_get_max_resolution(int *width, int *height);
 
+/*
+ * 0 reads back the frame that was just rendered, otherwise
+ * the frame from this many swaps ago is returned
+ */
+void sgl_set_readback_latency(int frames);
+
 struct sgl_host_context *sgl_context_create();
 void sgl_context_destroy(struct sgl_host_context *ctx);
 void sgl_set_current(struct sgl_host_context *ctx);
-void *sgl_read_pixels(unsigned int width, unsigned int height, void *data, int vflip, int format, size_t mem_usage);
+void *sgl_read_pixels(struct sgl_host_context *ctx, unsigned int width, unsigned int height, void *data, int vflip, int format, size_t mem_usage);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,65 @@
+#ifndef _SGL_SERVER_NAMES_H_
+#define _SGL_SERVER_NAMES_H_
+
+#include <epoxy/gl.h>
+#include <stdbool.h>
+
+/*
+ * clients pick object names themselves, so that glGen* never has
+ * to wait for the server. each context keeps a table per object
+ * type translating the client's names to the real gl names
+ */
+enum sgl_name_type {
+    SGL_NAME_BUFFER,
+    SGL_NAME_TEXTURE,
+    SGL_NAME_QUERY,
+    SGL_NAME_FRAMEBUFFER,
+    SGL_NAME_RENDERBUFFER,
+    SGL_NAME_VERTEX_ARRAY,
+    SGL_NAME_TYPE_COUNT
+};
+
+struct sgl_name_table {
+    GLuint *names;
+    GLuint size;
+};
+
+/*
+ * reserve a real name for a client name, as glGen* and glCreate*
+ * would. target is only used when creating textures and queries
+ */
+void sgl_names_gen(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name);
+void sgl_names_create(struct sgl_name_table *tables, enum sgl_name_type type, GLenum target, GLuint name);
+
+/*
+ * translate a client name, names the client never generated get a real
+ * name on first use to keep bind-to-create working
+ */
+GLuint sgl_names_get(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name);
+void sgl_names_get_array(struct sgl_name_table *tables, enum sgl_name_type type, GLsizei n, const GLuint *names, GLuint *real);
+
+/*
+ * like sgl_names_get, but returns 0 for names without a real name
+ */
+GLuint sgl_names_find(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name);
+
+/*
+ * forgets a client name and returns the real name, which the
+ * caller should delete
+ */
+GLuint sgl_names_delete(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name);
+
+/*
+ * translates a real name back for queries returning names
+ */
+GLuint sgl_names_reverse(struct sgl_name_table *tables, enum sgl_name_type type, GLuint real);
+
+/*
+ * translates the answer to a glGet* query back if pname
+ * is one that returns a name
+ */
+void sgl_names_reverse_query(struct sgl_name_table *tables, GLenum pname, GLint *data);
+
+void sgl_names_free(struct sgl_name_table *tables);
+
+#endif
\ No newline at end of file
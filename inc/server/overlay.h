@@ -2,15 +2,37 @@
 #define _SGL_OVERLAY_H_
 
 #include <time.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * the overlay is rasterized into a small image of this many lines of text,
+ * 8x16 pixels per character, which the caller composites onto the frame
+ */
+#define OVERLAY_LINES 3
+#define OVERLAY_COLUMNS 96
+#define OVERLAY_IMAGE_WIDTH (OVERLAY_COLUMNS * 8)
+#define OVERLAY_IMAGE_HEIGHT (OVERLAY_LINES * 16)
+#define OVERLAY_LINE_HEIGHT 16
 
 struct overlay_context {
     clock_t current_ticks, delta_ticks;
     clock_t fps;
+
+    /*
+     * top line first, line_width holds the width of each line in pixels
+     */
+    unsigned int image[OVERLAY_IMAGE_HEIGHT][OVERLAY_IMAGE_WIDTH];
+    int line_width[OVERLAY_LINES];
 };
 
 void overlay_set_renderer_string(char *string);
 void overlay_enable();
 void overlay_stage1(struct overlay_context *ctx);
-void overlay_stage2(struct overlay_context *ctx, int *frame, int width, size_t mem_usage);
+
+/*
+ * rasterizes the overlay, returns false if there is nothing to draw
+ */
+bool overlay_stage2(struct overlay_context *ctx, size_t mem_usage);
 
 #endif
\ No newline at end of file
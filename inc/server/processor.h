@@ -4,6 +4,26 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include <server/trace.h>
+
+enum sgl_error_check {
+    /*
+     * only query gl errors when the client asks for them
+     */
+    SGL_ERROR_CHECK_OFF,
+
+    /*
+     * query gl errors once per submit
+     */
+    SGL_ERROR_CHECK_SUBMIT,
+
+    /*
+     * query gl errors after every command and log the
+     * command that caused them, slow; for debugging
+     */
+    SGL_ERROR_CHECK_COMMAND
+};
+
 struct sgl_cmd_processor_args {
     /*
      * shared memory information
@@ -23,6 +43,40 @@ struct sgl_cmd_processor_args {
     int gl_major;
     int gl_minor;
 
+    /*
+     * number of clients that may be connected at once,
+     * and whether each gets its own decoding thread
+     */
+    int max_clients;
+    bool threaded;
+
+    /*
+     * how often gl errors are gathered for glGetError
+     */
+    enum sgl_error_check error_check;
+
+    /*
+     * network only; size of the tiles the framebuffer is split into
+     * for damage tracking, the compression level of changed tiles and
+     * how many frames pass between resending every tile
+     */
+    int fb_tile_size;
+    int fb_compression_level;
+    int fb_keyframe_interval;
+
+    /*
+     * if set, every batch is recorded to this file, see trace.h
+     */
+    const char *trace_path;
+
+    /*
+     * if set, decoding is profiled per client and command, see
+     * profile.h. the profile is written to this file when asked
+     * for with SIGUSR1 and every profile_interval seconds, if not 0
+     */
+    const char *profile_path;
+    int profile_interval;
+
     /*
      * for debugging; in the event of an exception,
      * this pointer will contain a pointer to the
@@ -31,6 +85,17 @@ struct sgl_cmd_processor_args {
     int **internal_cmd_ptr;
 };
 
+/*
+ * called after every record of a trace is replayed
+ */
+typedef void (*sgl_replay_callback)(const struct sgl_trace_record *record, void *user);
+
 void sgl_cmd_processor_start(struct sgl_cmd_processor_args args);
 
+/*
+ * decodes a recorded trace as fast as possible, args should
+ * describe the server the trace was recorded with
+ */
+void sgl_cmd_processor_replay(struct sgl_cmd_processor_args args, const struct sgl_trace *trace, sgl_replay_callback callback, void *user);
+
 #endif
\ No newline at end of file
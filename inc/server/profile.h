@@ -0,0 +1,93 @@
+#ifndef _SGL_PROFILE_H_
+#define _SGL_PROFILE_H_
+
+#include <sharedgl.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * when profiling, the decoder times every command it runs and every
+ * submit as a whole. times are kept as histograms, bucket i counts the
+ * times between 2^i and 2^(i+1) nanoseconds
+ */
+#define SGL_PROFILE_BUCKETS 32
+
+/*
+ * commands listed per client when a profile is logged,
+ * the json holds all of them
+ */
+#define SGL_PROFILE_TABLE_ROWS 20
+
+struct sgl_profile_stats {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t ns;
+    uint32_t histogram[SGL_PROFILE_BUCKETS];
+};
+
+struct sgl_profile {
+    struct sgl_profile *next;
+
+    int client_id;
+    bool exited;
+
+    /*
+     * indexed by command, unknown commands are never timed
+     */
+    struct sgl_profile_stats commands[SGL_CMD_MAX];
+
+    /*
+     * calls are submits, commands is the number of commands in them
+     */
+    struct sgl_profile_stats submits;
+    uint64_t submit_commands;
+};
+
+/*
+ * path is where the json is written, the table always goes to the log.
+ * profiles are dumped when requested and, if interval isn't 0, every
+ * interval seconds
+ */
+void sgl_profile_enable(const char *path, int interval);
+bool sgl_profile_enabled(void);
+
+/*
+ * a profile is only ever updated by the thread decoding its client,
+ * dumps read it as it is. destroyed profiles are logged one last time
+ * and stay in the json until the next dump
+ */
+struct sgl_profile *sgl_profile_create(int client_id);
+void sgl_profile_destroy(struct sgl_profile *profile);
+
+/*
+ * safe to call from a signal handler, the dump happens on the next poll.
+ * waiting for clients is cut into periods of SGL_PROFILE_POLL_US so that
+ * dumps also happen while idle
+ */
+#define SGL_PROFILE_POLL_US 100000
+
+void sgl_profile_request(void);
+void sgl_profile_poll(void);
+void sgl_profile_dump(void);
+
+static inline uint64_t sgl_profile_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static inline void sgl_profile_add(struct sgl_profile_stats *stats, size_t bytes, uint64_t ns)
+{
+    int bucket = 63 - __builtin_clzll(ns | 1);
+
+    stats->calls++;
+    stats->bytes += bytes;
+    stats->ns += ns;
+    stats->histogram[bucket < SGL_PROFILE_BUCKETS ? bucket : SGL_PROFILE_BUCKETS - 1]++;
+}
+
+#endif
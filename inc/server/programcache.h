@@ -0,0 +1,76 @@
+#ifndef _SGL_PROGRAMCACHE_H_
+#define _SGL_PROGRAMCACHE_H_
+
+#include <epoxy/gl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * linked programs are kept on disk as program binaries, keyed by the
+ * sources of their shaders, the state that affects linking and the
+ * driver. compiling a shader is put off until a link misses the cache
+ * or the client asks about the shader, so a hit skips the compiler
+ */
+#define SGL_PROGRAM_CACHE_DEFAULT_SIZE 64 // MiB
+
+struct sgl_tracked_shader {
+    GLuint shader;
+    uint64_t source;    /* hash of the last glShaderSource */
+    uint64_t compiled;  /* hash of the source at glCompileShader, 0 if never compiled */
+    bool pending;       /* compile was put off */
+    bool deleted;       /* deleted while pending, kept for programs it's attached to */
+};
+
+struct sgl_tracked_program {
+    GLuint program;
+    uint64_t state;     /* hash of bindings and parameters set before linking */
+};
+
+/*
+ * shaders and programs of a context, kept next to the context's names
+ */
+struct sgl_program_tracker {
+    struct sgl_tracked_shader *shaders;
+    int shader_count, shader_capacity;
+
+    struct sgl_tracked_program *programs;
+    int program_count, program_capacity;
+};
+
+/*
+ * directory is created if missing, NULL disables the cache. the least
+ * recently used binaries are evicted once they take up max_size bytes
+ */
+void sgl_program_cache_init(const char *directory, size_t max_size);
+void sgl_program_cache_stats(unsigned int *hits, unsigned int *misses);
+
+void sgl_program_cache_shader_source(struct sgl_program_tracker *tracker, GLuint shader, GLsizei count, const char **strings);
+void sgl_program_cache_compile(struct sgl_program_tracker *tracker, GLuint shader);
+
+/*
+ * compiles a shader whose compile was put off, before it is queried.
+ * does nothing for other names
+ */
+void sgl_program_cache_prepare(struct sgl_program_tracker *tracker, GLuint shader);
+
+/*
+ * answers glGetShaderiv for a shader whose compile was put off, if that
+ * can be done without compiling it. sources that compiled before report
+ * success and an empty info log
+ */
+bool sgl_program_cache_shader_query(struct sgl_program_tracker *tracker, GLuint shader, GLenum pname, GLint *value);
+
+void sgl_program_cache_delete_shader(struct sgl_program_tracker *tracker, GLuint shader);
+
+/*
+ * mixes state set on the program before linking into its key, data
+ * should hold the command's arguments
+ */
+void sgl_program_cache_program_state(struct sgl_program_tracker *tracker, GLuint program, const void *data, size_t size);
+void sgl_program_cache_link(struct sgl_program_tracker *tracker, GLuint program);
+void sgl_program_cache_delete_program(struct sgl_program_tracker *tracker, GLuint program);
+
+void sgl_program_cache_free(struct sgl_program_tracker *tracker);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef _SGL_TRACE_H_
+#define _SGL_TRACE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * a trace holds every batch the server decoded, in order, so that a
+ * workload can be replayed without the guest that produced it. uploads
+ * travel inside the batches, the only client data outside of them is
+ * what clients write to persistent mappings, which is recorded before
+ * the batch that sees it. records are 8 byte aligned so that a trace
+ * can be used straight from a mapping of the file
+ */
+#define SGL_TRACE_MAGIC 0x54474c53 // SGLT
+#define SGL_TRACE_VERSION 1
+
+/*
+ * the layout of the server that recorded the trace, replaying with the
+ * same layout puts everything at the offsets the client expected
+ */
+struct sgl_trace_header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t memory_size;
+    uint32_t max_clients;
+    uint32_t max_width, max_height;
+    uint32_t gl_major, gl_minor;
+    uint32_t network;
+};
+
+enum sgl_trace_record_type {
+    /*
+     * the words of a batch, terminated by SGL_CMD_INVALID
+     */
+    SGL_TRACE_BATCH = 1,
+
+    /*
+     * the contents of a persistent mapping at offset in the client's
+     * map region, recorded when they change
+     */
+    SGL_TRACE_WINDOW
+};
+
+struct sgl_trace_record {
+    uint32_t type;
+    uint32_t client_id;
+    uint32_t length;    /* bytes of data following the record */
+    uint32_t offset;    /* windows only */
+    uint32_t commands;  /* batches only, commands and swaps in the batch */
+    uint32_t swaps;
+};
+
+struct sgl_trace {
+    void *data;
+    size_t size;
+    const struct sgl_trace_header *header;
+};
+
+/*
+ * recording; the file is replaced, records may be added from any thread
+ */
+bool sgl_trace_open(const char *path, const struct sgl_trace_header *header);
+bool sgl_trace_recording(void);
+void sgl_trace_batch(int client_id, const int *words, size_t count, unsigned int commands, unsigned int swaps);
+void sgl_trace_window(int client_id, size_t offset, const void *data, size_t length);
+void sgl_trace_close(void);
+
+/*
+ * replaying; a trace cut short by the server stopping
+ * ends at the last complete record
+ */
+bool sgl_trace_load(struct sgl_trace *trace, const char *path);
+const struct sgl_trace_record *sgl_trace_next(const struct sgl_trace *trace, const struct sgl_trace_record *record);
+const void *sgl_trace_data(const struct sgl_trace_record *record);
+void sgl_trace_unload(struct sgl_trace *trace);
+
+#endif
@@ -28,25 +28,89 @@
         fprintf(stderr, __VA_ARGS__); \
     }
 
-#define SGL_OFFSET_REGISTER_SUBMIT              (sizeof(int) * 0)
+/*
+ * the first page holds the global registers, followed by the framebuffer
+ * and then the client slots. each slot begins with a register page of its
+ * own (only RETVAL, RETVAL_V and the ring indices are used there) followed
+ * by the client's ring buffer, the region persistent buffer mappings live
+ * in and the region downloads are written to
+ */
 #define SGL_OFFSET_REGISTER_RETVAL              (sizeof(int) * 1)
-#define SGL_OFFSET_REGISTER_READY_HINT          (sizeof(int) * 2)
 #define SGL_OFFSET_REGISTER_LOCK                (sizeof(int) * 3)
 #define SGL_OFFSET_REGISTER_CLAIM_ID            (sizeof(int) * 4)
-#define SGL_OFFSET_REGISTER_CONNECT             (sizeof(int) * 5)
+#define SGL_OFFSET_REGISTER_SLOT_COUNT          (sizeof(int) * 5)
 #define SGL_OFFSET_REGISTER_FBSTART             (sizeof(int) * 6)
 #define SGL_OFFSET_REGISTER_MEMSIZE             (sizeof(int) * 8)
 #define SGL_OFFSET_REGISTER_SWAP_BUFFERS_SYNC   (sizeof(int) * 10)
 #define SGL_OFFSET_REGISTER_GLMAJ               (sizeof(int) * 11)
 #define SGL_OFFSET_REGISTER_GLMIN               (sizeof(int) * 12)
-#define SGL_OFFSET_REGISTER_RETVAL_V            (sizeof(int) * 13)
+#define SGL_OFFSET_REGISTER_SLOT_START          (sizeof(int) * 14)
+#define SGL_OFFSET_REGISTER_SLOT_SIZE           (sizeof(int) * 16)
+#define SGL_OFFSET_REGISTER_DOWNLOAD_SIZE       (sizeof(int) * 18)
+#define SGL_OFFSET_REGISTER_MAP_SIZE            (sizeof(int) * 20)
+#define SGL_OFFSET_REGISTER_DOORBELL            (sizeof(int) * 22)
+#define SGL_OFFSET_REGISTER_SERVER_SLEEPING     (sizeof(int) * 23)
+#define SGL_OFFSET_SLOT_TABLE                   0x80
+#define SGL_OFFSET_REGISTER_RETVAL_V            0x100
 #define SGL_OFFSET_COMMAND_START                0x1000
 
 /*
- * max return in RETVAL_V is 4044
+ * slot table holds the id of the client owning each slot, 0 if free
+ */
+#define SGL_MAX_SLOTS ((SGL_OFFSET_REGISTER_RETVAL_V - SGL_OFFSET_SLOT_TABLE) / sizeof(int))
+#define SGL_DEFAULT_SLOTS 4
+
+#define SGL_IS_CLIENT_REGISTER(offset) \
+    ((offset) < SGL_OFFSET_REGISTER_LOCK || ((offset) >= SGL_OFFSET_REGISTER_RETVAL_V && (offset) < SGL_OFFSET_COMMAND_START))
+
+/*
+ * ring indices, relative to the start of a slot. the client produces
+ * batches at the tail and the server consumes them at the head, both
+ * are byte offsets into the ring and sit on separate cache lines
+ *
+ * every batch starts with its size in bytes (header included), a
+ * header of SGL_RING_WRAP tells the server to continue at the start
+ * of the ring
+ */
+#define SGL_OFFSET_SLOT_RING_HEAD               0x40
+#define SGL_OFFSET_SLOT_RING_TAIL               0x80
+#define SGL_RING_WRAP                           -1
+
+/*
+ * neither side spins forever waiting for the other, see wait.h. clients
+ * bump the doorbell after publishing a tail, and wake the server if it
+ * sleeps on it (or, with -t, on their tail). the server wakes clients
+ * sleeping on their head. each flag sits on the line of the index the
+ * side setting it writes anyway
+ */
+#define SGL_OFFSET_SLOT_TAIL_SLEEPING           0x44
+#define SGL_OFFSET_SLOT_HEAD_SLEEPING           0x84
+
+#define SGL_WAIT_SPIN_US                        50
+#define SGL_WAIT_MIN_SLEEP_US                   20
+#define SGL_WAIT_MAX_SLEEP_US                   1000
+
+/*
+ * entries in a client's array cache, named 1 through this
+ */
+#define SGL_ARRAY_CACHE_ENTRIES 256
+
+/*
+ * client side arrays a single draw can source, the generic vertex
+ * attributes followed by the fixed function arrays. staged arrays are
+ * kept in the slot of the same number, 1 through this
+ */
+#define SGL_MAX_VERTEX_ATTRIBS 256
+#define SGL_MAX_CLIENT_ARRAYS (SGL_MAX_VERTEX_ATTRIBS + 16)
+
+/*
+ * attributes a batched glBegin/glEnd block carries per vertex. vertices
+ * are interleaved floats, the attributes in the layout in this order
+ * followed by a 4 component position
  */
-#define SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES 3072
-#define SGL_VP_DOWNLOAD_BLOCK_SIZE (SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES / sizeof(int))
+#define SGL_IMMEDIATE_TEXCOORD  (1 << 0) // 4 floats
+#define SGL_IMMEDIATE_COLOR     (1 << 1) // 4 floats
+#define SGL_IMMEDIATE_NORMAL    (1 << 2) // 3 floats
 
 #define SGL_DEFAULT_MAJOR 4
 #define SGL_DEFAULT_MINOR 6
@@ -93,12 +157,20 @@ enum {
     SGL_CMD_VP_UPLOAD,
     SGL_CMD_VP_NULL,
     SGL_CMD_VP_UPLOAD_STAY,
-    SGL_CMD_VP_DOWNLOAD,        // UNLIKE VP_UPLOAD, WE USE BYTES INSTEAD OF INTS
+    SGL_CMD_VP_DOWNLOAD,        // UNLIKE VP_UPLOAD, WE USE BYTES INSTEAD OF INTS. WRITTEN TO THE DOWNLOAD REGION
     SGL_CMD_CREATE_CONTEXT,
     SGL_CMD_REPORT_DIMS,        // NOT USED
     SGL_CMD_HELLO_WORLD,
     SGL_CMD_GOODBYE_WORLD,
     SGL_CMD_SWAP_BUFFERS,
+    SGL_CMD_VP_UPLOAD_CHUNK,    // SLOT (0 IF TRANSIENT), TOTAL, OFFSET, COUNT (INTS), DATA
+    SGL_CMD_VP_MAP_WINDOW,      // BUFFER, WINDOW, LENGTH, ACCESS (BYTES). MIRRORS THE LAST MAPPED BUFFER
+    SGL_CMD_VP_FLUSH_WINDOW,    // WINDOW, OFFSET, LENGTH (BYTES)
+    SGL_CMD_VP_UNMAP_WINDOW,    // WINDOW
+    SGL_CMD_VP_CACHE_STORE,     // ENTRY, SIZE (BYTES). STORES THE LAST UPLOAD
+    SGL_CMD_VP_CACHE_BIND,      // ENTRY. USED IN PLACE OF AN UPLOAD BY THE NEXT ARRAY
+    SGL_CMD_VP_CACHE_RELEASE,   // ENTRY. FREES THE STORAGE OF AN EVICTED ENTRY
+    SGL_CMD_VP_DRAW_IMMEDIATE,  // MODE, COUNT, LAYOUT. DRAWS A GLBEGIN/GLEND BLOCK FROM THE LAST UPLOAD
 
     SGL_CMD_CULLFACE,
     SGL_CMD_FRONTFACE,
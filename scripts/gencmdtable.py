@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+#
+# generates the command descriptor table from the decoder in
+# src/server/processor.c, run from the repository root after
+# adding or changing a command:
+#
+#     python3 scripts/gencmdtable.py
+#
+# every case is read for how many words it takes from the command
+# stream and how the variable part, if any, is sized. commands the
+# script can't make sense of are reported and have to be fixed up
+# in the decoder, sglrenderer -e command checks the table against
+# the decoder at runtime
+#
+
+import re
+import sys
+
+HEADER = 'inc/sharedgl.h'
+DECODER = 'src/server/processor.c'
+TABLE = 'src/server/cmdtable.c'
+HANDLERS = 'inc/server/cmdhandlers.h'
+
+BANNER = '/*\n * generated by scripts/gencmdtable.py from src/server/processor.c, do not edit\n */\n'
+
+CASE = re.compile(r'^        (?:case (SGL_CMD_\w+):|SGL_CASE\((SGL_CMD_\w+)\))')
+READ = re.compile(r'pb\+\+')
+FOR = re.compile(r'for \(int \w+ = 0; \w+ < (\w+); \w+\+\+\)')
+
+
+def commands():
+    source = open(HEADER).read()
+    body = source[source.index('SGL_CMD_INVALID,'):source.index('SGL_CMD_MAX')]
+    return re.findall(r'^\s*(SGL_CMD_\w+)', body, re.M)
+
+
+def cases():
+    lines = open(DECODER).read().split('\n')
+    start = next(i for i, line in enumerate(lines) if 'switch (SGL_CMD_SLOT(cmd))' in line or 'switch (*pb++)' in line)
+    depth, end = 0, None
+    for i in range(start, len(lines)):
+        depth += lines[i].count('{') - lines[i].count('}')
+        if depth == 0:
+            end = i
+            break
+
+    result, names, current = [], [], None
+    for line in lines[start + 1:end]:
+        match = CASE.match(line)
+        if match:
+            names.append(match.group(1) or match.group(2))
+            continue
+        if line.startswith('        default:'):
+            break
+        if names:
+            current = (names, [])
+            result.append(current)
+            names = []
+        if current is not None:
+            current[1].append(line)
+    return result
+
+
+def statements(lines):
+    """joins the body into statements, keeping loops apart"""
+    text = '\n'.join(line.split('//')[0] for line in lines)
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return text
+
+
+def describe(name, lines):
+    text = statements(lines)
+
+    # argument names in the order they are read
+    bound = []
+    fixed, tail = 0, 0
+    rule, count, scale, nbytes = 'SGL_CMD_RULE_NONE', 0, 0, 0
+    variable = False
+    problems = []
+
+    def argument(var):
+        if var not in bound:
+            problems.append('count %s is not an argument' % var)
+            return 0
+        return bound.index(var)
+
+    position = 0
+    while position < len(text):
+        loop = FOR.search(text, position)
+        advance = text.find('ADVANCE_PAST_STRING', position)
+        skip = re.compile(r'pb \+= ([^;]+);').search(text, position)
+        read = READ.search(text, position)
+
+        events = [e for e in [
+            (loop.start(), 'loop', loop) if loop else None,
+            (advance, 'string', None) if advance != -1 else None,
+            (skip.start(), 'skip', skip) if skip else None,
+            (read.start(), 'read', read) if read else None] if e]
+        if not events:
+            break
+        start, kind, match = min(events, key=lambda e: e[0])
+
+        if kind == 'read':
+            statement = text[text.rfind('\n', 0, start) + 1:start]
+            var = re.findall(r'(\w+)(?:\[\w+\])?\s*=', statement)
+            bound.append(var[-1] if var else None)
+            if variable:
+                tail += 1
+            else:
+                fixed += 1
+            position = start + 4
+            continue
+
+        if kind == 'string':
+            if variable:
+                problems.append('more than one variable part')
+            rule, variable = 'SGL_CMD_RULE_STRING', True
+            position = start + len('ADVANCE_PAST_STRING')
+            continue
+
+        if kind == 'skip':
+            amount = match.group(1).strip()
+            position = match.end()
+            if re.fullmatch(r'[\d\s*]+', amount):
+                words = eval(amount)
+                if variable:
+                    tail += words
+                else:
+                    fixed += words
+                bound.extend([None] * words)
+                continue
+            bytes_match = re.fullmatch(r'CEIL_DIV\((\w+), 4\)', amount)
+            words_match = re.fullmatch(r'(\w+)(?: \* (\d+))?', amount)
+            if bytes_match and rule == 'SGL_CMD_RULE_WORDS' and variable:
+                rule, nbytes = 'SGL_CMD_RULE_WORDS_BYTES', argument(bytes_match.group(1))
+            elif bytes_match and not variable:
+                rule, count, variable = 'SGL_CMD_RULE_BYTES', argument(bytes_match.group(1)), True
+            elif words_match and not variable:
+                rule, count, variable = 'SGL_CMD_RULE_WORDS', argument(words_match.group(1)), True
+                scale = int(words_match.group(2) or 1)
+            else:
+                problems.append('unknown skip "%s"' % amount)
+            continue
+
+        # loops either read a constant number of words or make up the variable part
+        bound_name = match.group(1)
+        body_start = match.end()
+        rest = text[body_start:].lstrip()
+        if rest.startswith('{'):
+            depth, i = 0, text.index('{', body_start)
+            for j in range(i, len(text)):
+                depth += {'{': 1, '}': -1}.get(text[j], 0)
+                if depth == 0:
+                    break
+            body, position = text[i + 1:j], j + 1
+        else:
+            end = text.index(';', body_start)
+            body, position = text[body_start:end + 1], end + 1
+
+        reads = len(READ.findall(body))
+        strings = body.count('ADVANCE_PAST_STRING')
+
+        if bound_name.isdigit():
+            words = int(bound_name) * reads
+            if variable:
+                tail += words
+            else:
+                fixed += words
+            bound.extend([None] * words)
+        elif variable:
+            problems.append('more than one variable part')
+        elif strings:
+            rule, count, variable = 'SGL_CMD_RULE_STRINGS', argument(bound_name), True
+        elif reads:
+            rule, count, variable = 'SGL_CMD_RULE_WORDS', argument(bound_name), True
+            scale = reads
+
+    if re.search(r'\bif\b[^;{]*\{[^}]*pb\+\+', text) or re.search(r'\bif \([^\n]*\)\n\s*[^\n]*pb\+\+', text):
+        problems.append('reads depending on a condition')
+
+    return (fixed, rule, count, scale, nbytes, tail), problems
+
+
+def main():
+    known = commands()
+    table, failed = {}, False
+
+    for names, lines in cases():
+        desc, problems = describe(names[0], lines)
+        for problem in problems:
+            print('%s: %s' % (names[0], problem), file=sys.stderr)
+            failed = True
+        for name in names:
+            if name not in known:
+                print('%s: not in %s' % (name, HEADER), file=sys.stderr)
+                failed = True
+            table[name] = desc
+
+    if failed:
+        return 1
+
+    with open(TABLE, 'w') as out:
+        out.write(BANNER)
+        out.write('#include <sharedgl.h>\n#include <server/cmdtable.h>\n\n')
+        out.write('const struct sgl_cmd_desc sgl_cmd_table[SGL_CMD_MAX] = {\n')
+        for name in known:
+            if name not in table:
+                continue
+            fixed, rule, count, scale, nbytes, tail = table[name]
+            out.write('    [%s] = { %d, %s, %d, %d, %d, %d, true },\n' % (name, fixed, rule, count, scale, nbytes, tail))
+        out.write('};\n')
+
+    with open(HANDLERS, 'w') as out:
+        out.write(BANNER)
+        out.write('#ifndef _SGL_CMDHANDLERS_H_\n#define _SGL_CMDHANDLERS_H_\n\n')
+        out.write('#define SGL_HANDLED_COMMANDS(X) \\\n')
+        out.write(' \\\n'.join('    X(%s)' % name for name in known if name in table))
+        out.write('\n\n#endif\n')
+
+    print('%d of %d commands handled' % (len(table), len(known)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
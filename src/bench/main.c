@@ -0,0 +1,531 @@
+#include <sharedgl.h>
+#include <commongl.h>
+
+#include <client/glimpl.h>
+#include <client/pb.h>
+#include <client/platform/icd.h>
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sys/wait.h>
+
+/*
+ * the entry points the benchmarks drive, implemented by glimpl.c
+ */
+void glBindBuffer(GLenum target, GLuint buffer);
+void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+void glClear(GLbitfield mask);
+void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+void glDeleteBuffers(GLsizei n, const GLuint *buffers);
+void glDisableClientState(GLenum array);
+void glDrawArrays(GLenum mode, GLint first, GLsizei count);
+void glEnableClientState(GLenum array);
+void glGenBuffers(GLsizei n, GLuint *buffers);
+GLenum glGetError(void);
+void glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer);
+void glViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+/*
+ * sglbench stands in for the windowing system, like glx.c does
+ */
+static int max_width, max_height, real_width, real_height;
+
+ICD_SET_MAX_DIMENSIONS_DEFINITION(max_width, max_height, real_width, real_height);
+ICD_RESIZE_DEFINITION(real_width, real_height);
+
+static const char *usage =
+    "usage: sglbench [-h] [-n ADDRESS:PORT] [-c COUNT] [-t SECONDS] [-o FILE]\n"
+    "\n"
+    "benchmarks a running sglrenderer through the client library, results are written as json\n"
+    "\n"
+    "options:\n"
+    "    -h                 display help information\n"
+    "    -n [ADDRESS:PORT]  connect over the network instead of shared memory, the server must run with -n\n"
+    "    -c [COUNT]         most clients to run at once when measuring scaling (default: %d)\n"
+    "    -t [SECONDS]       how long each timed benchmark runs (default: %.1f)\n"
+    "    -o [FILE]          write results to FILE instead of stdout\n";
+
+#define BENCH_DEFAULT_SECONDS 2.0
+
+/*
+ * draws are submitted in batches of this many
+ */
+#define BENCH_DRAWS_PER_SUBMIT 256
+
+#define BENCH_MAX_SAMPLES 65536
+
+static const size_t upload_sizes[] = { 4 << 10, 64 << 10, 1 << 20, 16 << 20 };
+static const int draw_vertices[] = { 3, 3000 };
+static const int swap_sizes[][2] = { { 640, 480 }, { 1280, 720 }, { 1920, 1080 }, { 3840, 2160 } };
+
+#define BENCH_COUNT(array) (sizeof(array) / sizeof(array[0]))
+
+/*
+ * what every benchmark reports back from its client process
+ */
+struct bench_timing {
+    double mean, median, p99, max;
+};
+
+struct bench_results {
+    struct bench_timing latency_us;
+
+    double encode_calls_per_second;
+    double encode_megabytes_per_second;
+    double submit_calls_per_second;
+
+    double upload_megabytes_per_second[BENCH_COUNT(upload_sizes)];
+    double draws_per_second[BENCH_COUNT(draw_vertices)];
+
+    struct bench_timing swap_ms[BENCH_COUNT(swap_sizes)];
+    bool swap_measured[BENCH_COUNT(swap_sizes)];
+};
+
+static double bench_seconds = BENCH_DEFAULT_SECONDS;
+static double *samples;
+
+static double bench_now(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+    double x = *(const double*)a,
+           y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static struct bench_timing bench_summarize(double *values, int count)
+{
+    struct bench_timing timing = { 0 };
+    if (count == 0)
+        return timing;
+
+    for (int i = 0; i < count; i++)
+        timing.mean += values[i];
+    timing.mean /= count;
+
+    qsort(values, count, sizeof(double), compare_samples);
+    timing.median = values[count / 2];
+    timing.p99 = values[(count * 99) / 100];
+    timing.max = values[count - 1];
+    return timing;
+}
+
+/*
+ * glGetError submits and waits for the server's answer, the
+ * shortest round trip there is
+ */
+static void bench_latency(struct bench_results *results)
+{
+    int count = 0;
+    double end = bench_now() + bench_seconds;
+
+    while (count < BENCH_MAX_SAMPLES && bench_now() < end) {
+        double start = bench_now();
+        glGetError();
+        samples[count++] = (bench_now() - start) * 1e6;
+    }
+
+    results->latency_us = bench_summarize(samples, count);
+}
+
+/*
+ * encoding alone is measured by throwing batches away instead of
+ * submitting them, then again with every batch submitted
+ */
+static void bench_encode(struct bench_results *results)
+{
+    const int calls = 4096;
+    double elapsed = 0;
+    long total = 0;
+
+    while (elapsed < bench_seconds) {
+        double start = bench_now();
+        for (int i = 0; i < calls; i++)
+            glClearColor(i, 0, 0, 1);
+        elapsed += bench_now() - start;
+
+        total += calls;
+        pb_reset();
+    }
+
+    results->encode_calls_per_second = total / elapsed;
+    results->encode_megabytes_per_second = total * 5 * sizeof(int) / elapsed / (1024 * 1024);
+
+    double start = bench_now(), end = start + bench_seconds;
+    total = 0;
+    while (bench_now() < end) {
+        for (int i = 0; i < calls; i++)
+            glClearColor(i, 0, 0, 1);
+        glimpl_submit();
+        total += calls;
+    }
+    glGetError();
+
+    results->submit_calls_per_second = total / (bench_now() - start);
+}
+
+static void bench_upload(struct bench_results *results)
+{
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    for (int i = 0; i < BENCH_COUNT(upload_sizes); i++) {
+        size_t size = upload_sizes[i];
+        char *data = malloc(size);
+        for (size_t j = 0; j < size; j++)
+            data[j] = j * 31;
+
+        double start = bench_now(), end = start + bench_seconds;
+        size_t total = 0;
+        while (bench_now() < end) {
+            glBufferData(GL_ARRAY_BUFFER, size, data, GL_STREAM_DRAW);
+            total += size;
+        }
+        glGetError();
+
+        results->upload_megabytes_per_second[i] = total / (bench_now() - start) / (1024 * 1024);
+        free(data);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDeleteBuffers(1, &buffer);
+}
+
+static long bench_draw_loop(int vertices, double seconds)
+{
+    float *positions = malloc(vertices * 3 * sizeof(float));
+    for (int i = 0; i < vertices * 3; i++)
+        positions[i] = (i % 3) * 0.01f;
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, positions);
+
+    double end = bench_now() + seconds;
+    long draws = 0;
+    while (bench_now() < end) {
+        for (int i = 0; i < BENCH_DRAWS_PER_SUBMIT; i++)
+            glDrawArrays(GL_TRIANGLES, 0, vertices);
+        glimpl_submit();
+        draws += BENCH_DRAWS_PER_SUBMIT;
+    }
+    glGetError();
+
+    glDisableClientState(GL_VERTEX_ARRAY);
+    free(positions);
+    return draws;
+}
+
+static void bench_draws(struct bench_results *results)
+{
+    for (int i = 0; i < BENCH_COUNT(draw_vertices); i++) {
+        double start = bench_now();
+        long draws = bench_draw_loop(draw_vertices[i], bench_seconds);
+        results->draws_per_second[i] = draws / (bench_now() - start);
+    }
+}
+
+static void bench_swap(struct bench_results *results)
+{
+    for (int i = 0; i < BENCH_COUNT(swap_sizes); i++) {
+        int width = swap_sizes[i][0],
+            height = swap_sizes[i][1];
+
+        if (width > max_width || height > max_height)
+            continue;
+
+        glViewport(0, 0, width, height);
+
+        int count = 0;
+        double end = bench_now() + bench_seconds;
+        while (count < BENCH_MAX_SAMPLES && bench_now() < end) {
+            double start = bench_now();
+            glClearColor(count & 1, 0, 0, 1);
+            glClear(GL_COLOR_BUFFER_BIT);
+            glimpl_swap_buffers(width, height, 1, GL_BGRA);
+            samples[count++] = (bench_now() - start) * 1e3;
+        }
+
+        results->swap_ms[i] = bench_summarize(samples, count);
+        results->swap_measured[i] = true;
+    }
+}
+
+/*
+ * every benchmark runs in a client process of its own, so that each
+ * starts with a fresh context and clients can run side by side
+ */
+struct bench_client {
+    pid_t pid;
+    int results;    /* read end, what the client measured */
+    int start;      /* write end, closed to let the client start */
+};
+
+static bool bench_read(int fd, void *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t n = read(fd, data, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        data = (char*)data + n;
+        size -= n;
+    }
+    return true;
+}
+
+static void bench_write(int fd, const void *data, size_t size)
+{
+    while (size > 0) {
+        ssize_t n = write(fd, data, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return;
+        data = (const char*)data + n;
+        size -= n;
+    }
+}
+
+static struct bench_client bench_spawn(void (*run)(int fd))
+{
+    struct bench_client client = { -1, -1, -1 };
+    int results[2], start[2];
+
+    if (pipe(results) == -1 || pipe(start) == -1) {
+        PRINT_LOG("failed to create pipes for a client\n");
+        return client;
+    }
+
+    client.pid = fork();
+    if (client.pid == 0) {
+        close(results[0]);
+        close(start[1]);
+
+        glimpl_init();
+
+        /*
+         * connected, wait for the others
+         */
+        char ready = 1;
+        bench_write(results[1], &ready, 1);
+        bench_read(start[0], &ready, 1);
+
+        run(results[1]);
+
+        glimpl_goodbye();
+        _exit(0);
+    }
+
+    close(results[1]);
+    close(start[0]);
+    client.results = results[0];
+    client.start = start[1];
+    return client;
+}
+
+static bool bench_join(struct bench_client *clients, int count, void *results, size_t size)
+{
+    bool ok = true;
+
+    for (int i = 0; i < count; i++) {
+        char ready;
+        ok &= clients[i].pid > 0 && bench_read(clients[i].results, &ready, 1);
+    }
+
+    for (int i = 0; i < count; i++)
+        if (clients[i].start != -1)
+            close(clients[i].start);
+
+    for (int i = 0; i < count; i++) {
+        if (ok)
+            ok &= bench_read(clients[i].results, (char*)results + i * size, size);
+        if (clients[i].results != -1)
+            close(clients[i].results);
+        if (clients[i].pid > 0)
+            waitpid(clients[i].pid, NULL, 0);
+    }
+
+    return ok;
+}
+
+static void bench_single(int fd)
+{
+    struct bench_results results = { 0 };
+
+    samples = malloc(BENCH_MAX_SAMPLES * sizeof(double));
+
+    PRINT_LOG("measuring round trip latency\n");
+    bench_latency(&results);
+    PRINT_LOG("measuring encode throughput\n");
+    bench_encode(&results);
+    PRINT_LOG("measuring uploads\n");
+    bench_upload(&results);
+    PRINT_LOG("measuring draw calls\n");
+    bench_draws(&results);
+    PRINT_LOG("measuring swaps\n");
+    bench_swap(&results);
+
+    free(samples);
+    bench_write(fd, &results, sizeof(results));
+}
+
+static void bench_scaling_client(int fd)
+{
+    double start = bench_now();
+    long draws = bench_draw_loop(draw_vertices[0], bench_seconds);
+    double rate = draws / (bench_now() - start);
+    bench_write(fd, &rate, sizeof(rate));
+}
+
+static void json_timing(FILE *out, const char *name, const struct bench_timing *timing, const char *indent)
+{
+    fprintf(out, "%s\"%s\": { \"mean\": %.3f, \"median\": %.3f, \"p99\": %.3f, \"max\": %.3f }",
+        indent, name, timing->mean, timing->median, timing->p99, timing->max);
+}
+
+int main(int argc, char **argv)
+{
+    const char *output = NULL;
+    const char *network = NULL;
+    int max_clients = SGL_DEFAULT_SLOTS;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][1] != 'h' && i + 1 == argc) {
+            PRINT_LOG("expected second argument\n");
+            return 1;
+        }
+
+        switch (argv[i][1]) {
+        case 'h':
+            fprintf(stderr, usage, SGL_DEFAULT_SLOTS, BENCH_DEFAULT_SECONDS);
+            return 0;
+        case 'n':
+            network = argv[i + 1];
+            i++;
+            break;
+        case 'c':
+            max_clients = atoi(argv[i + 1]);
+            if (max_clients < 1 || max_clients > SGL_MAX_SLOTS) {
+                PRINT_LOG("client count must be between 1 and %ld\n", SGL_MAX_SLOTS);
+                return 1;
+            }
+            i++;
+            break;
+        case 't':
+            bench_seconds = atof(argv[i + 1]);
+            if (bench_seconds <= 0) {
+                PRINT_LOG("duration must be positive\n");
+                return 1;
+            }
+            i++;
+            break;
+        case 'o':
+            output = argv[i + 1];
+            i++;
+            break;
+        default:
+            PRINT_LOG("unrecognized command-line option '%s'\n", argv[i]);
+        }
+    }
+
+    /*
+     * read by glimpl_init in every client
+     */
+    if (network != NULL)
+        setenv("SGL_NET_OVER_SHARED", network, 1);
+    else
+        unsetenv("SGL_NET_OVER_SHARED");
+
+    signal(SIGPIPE, SIG_IGN);
+
+    struct bench_results results;
+    struct bench_client client = bench_spawn(bench_single);
+    if (!bench_join(&client, 1, &results, sizeof(results))) {
+        PRINT_LOG("benchmark client failed, is sglrenderer running%s?\n", network != NULL ? " with -n" : "");
+        return 1;
+    }
+
+    int scaling_count = 0;
+    double scaling[SGL_MAX_SLOTS];
+    for (int clients = 1; clients <= max_clients; clients *= 2) {
+        struct bench_client spawned[SGL_MAX_SLOTS];
+        double rates[SGL_MAX_SLOTS];
+
+        PRINT_LOG("measuring draw calls with %d clients\n", clients);
+        for (int i = 0; i < clients; i++)
+            spawned[i] = bench_spawn(bench_scaling_client);
+
+        if (!bench_join(spawned, clients, rates, sizeof(double))) {
+            PRINT_LOG("a client failed with %d clients, stopping\n", clients);
+            break;
+        }
+
+        scaling[scaling_count] = 0;
+        for (int i = 0; i < clients; i++)
+            scaling[scaling_count] += rates[i];
+        scaling_count++;
+    }
+
+    FILE *out = stdout;
+    if (output != NULL && (out = fopen(output, "w")) == NULL) {
+        PRINT_LOG("failed to open '%s'\n", output);
+        return 1;
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"transport\": \"%s\",\n", network != NULL ? "network" : "shared memory");
+    fprintf(out, "  \"seconds\": %.3f,\n", bench_seconds);
+    json_timing(out, "latency_us", &results.latency_us, "  ");
+    fprintf(out, ",\n");
+    fprintf(out, "  \"encode\": { \"calls_per_second\": %.0f, \"megabytes_per_second\": %.1f, \"submitted_calls_per_second\": %.0f },\n",
+        results.encode_calls_per_second, results.encode_megabytes_per_second, results.submit_calls_per_second);
+
+    fprintf(out, "  \"upload\": [\n");
+    for (int i = 0; i < BENCH_COUNT(upload_sizes); i++)
+        fprintf(out, "    { \"bytes\": %zu, \"megabytes_per_second\": %.1f }%s\n",
+            upload_sizes[i], results.upload_megabytes_per_second[i], i + 1 < BENCH_COUNT(upload_sizes) ? "," : "");
+    fprintf(out, "  ],\n");
+
+    fprintf(out, "  \"draws\": [\n");
+    for (int i = 0; i < BENCH_COUNT(draw_vertices); i++)
+        fprintf(out, "    { \"vertices\": %d, \"draws_per_second\": %.0f }%s\n",
+            draw_vertices[i], results.draws_per_second[i], i + 1 < BENCH_COUNT(draw_vertices) ? "," : "");
+    fprintf(out, "  ],\n");
+
+    fprintf(out, "  \"swap\": [");
+    bool first = true;
+    for (int i = 0; i < BENCH_COUNT(swap_sizes); i++) {
+        if (!results.swap_measured[i])
+            continue;
+        fprintf(out, "%s\n    { \"width\": %d, \"height\": %d, ", first ? "" : ",", swap_sizes[i][0], swap_sizes[i][1]);
+        json_timing(out, "ms", &results.swap_ms[i], "");
+        fprintf(out, " }");
+        first = false;
+    }
+    fprintf(out, "\n  ],\n");
+
+    fprintf(out, "  \"scaling\": [\n");
+    for (int i = 0; i < scaling_count; i++)
+        fprintf(out, "    { \"clients\": %d, \"draws_per_second\": %.0f }%s\n",
+            1 << i, scaling[i], i + 1 < scaling_count ? "," : "");
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
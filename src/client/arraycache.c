@@ -0,0 +1,167 @@
+#include <client/arraycache.h>
+#include <sharedgl.h>
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * arrays smaller than this cost less to send than to hash
+ */
+#define ARRAYCACHE_MIN_SIZE 1024
+
+struct arraycache_entry {
+    const void *data;
+    size_t size;
+    uint64_t hash;
+    uint64_t last_used;
+    bool resident;
+    bool released; /* evicted, but still holding storage on the server */
+};
+
+static struct arraycache_entry entries[SGL_ARRAY_CACHE_ENTRIES];
+static size_t budget;
+static size_t used;
+static uint64_t tick;
+static int released_count;
+
+void arraycache_init(size_t size)
+{
+    budget = size;
+}
+
+/*
+ * eight bytes at a time, mixed with the 64 bit finalizer of murmur3
+ */
+static uint64_t arraycache_hash(const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    uint64_t hash = size * 0x9E3779B97F4A7C15ULL;
+    size_t i;
+
+    for (i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 32;
+    }
+
+    for (; i < size; i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static void arraycache_evict(struct arraycache_entry *entry)
+{
+    if (entry->resident) {
+        used -= entry->size;
+        entry->released = true;
+        released_count++;
+    }
+    entry->resident = false;
+}
+
+/*
+ * frees up room for size more bytes, the least recently used go first
+ */
+static void arraycache_make_room(size_t size)
+{
+    while (used + size > budget) {
+        struct arraycache_entry *oldest = NULL;
+
+        for (int i = 0; i < SGL_ARRAY_CACHE_ENTRIES; i++)
+            if (entries[i].resident && (oldest == NULL || entries[i].last_used < oldest->last_used))
+                oldest = &entries[i];
+
+        if (oldest == NULL)
+            return;
+
+        arraycache_evict(oldest);
+    }
+}
+
+bool arraycache_find(const void *data, size_t size, GLuint *id)
+{
+    struct arraycache_entry *entry = NULL;
+    uint64_t hash;
+
+    *id = 0;
+    if (size < ARRAYCACHE_MIN_SIZE || size > budget)
+        return false;
+
+    hash = arraycache_hash(data, size);
+    tick++;
+
+    for (int i = 0; i < SGL_ARRAY_CACHE_ENTRIES; i++) {
+        if (entries[i].resident && entries[i].data == data && entries[i].size == size) {
+            entry = &entries[i];
+            break;
+        }
+    }
+
+    if (entry != NULL) {
+        *id = entry - entries + 1;
+        entry->last_used = tick;
+        if (entry->hash == hash)
+            return true;
+
+        /*
+         * same array, new contents; send it again into the same entry
+         */
+        entry->hash = hash;
+        return false;
+    }
+
+    arraycache_make_room(size);
+
+    /*
+     * an entry that isn't resident, or failing that the oldest one
+     */
+    for (int i = 0; i < SGL_ARRAY_CACHE_ENTRIES; i++) {
+        if (!entries[i].resident) {
+            entry = &entries[i];
+            break;
+        }
+        if (entry == NULL || entries[i].last_used < entry->last_used)
+            entry = &entries[i];
+    }
+
+    /*
+     * storing into the entry replaces its storage anyway
+     */
+    arraycache_evict(entry);
+    if (entry->released)
+        released_count--;
+
+    *entry = (struct arraycache_entry){
+        /* data = */        data,
+        /* size = */        size,
+        /* hash = */        hash,
+        /* last_used = */   tick,
+        /* resident = */    true,
+        /* released = */    false
+    };
+    used += size;
+
+    *id = entry - entries + 1;
+    return false;
+}
+
+GLuint arraycache_next_released(void)
+{
+    if (released_count == 0)
+        return 0;
+
+    for (int i = 0; i < SGL_ARRAY_CACHE_ENTRIES; i++) {
+        if (entries[i].released) {
+            entries[i].released = false;
+            released_count--;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
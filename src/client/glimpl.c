@@ -3,6 +3,11 @@
 #include <client/spinlock.h>
 #include <client/pb.h>
 #include <client/scratch.h>
+#include <client/names.h>
+#include <client/state.h>
+#include <client/indices.h>
+#include <client/arraycache.h>
+#include <client/locations.h>
 
 #include <client/platform/icd.h>
 
@@ -11,6 +16,7 @@
 
 #include <network/net.h>
 #include <network/packet.h>
+#include <network/fbcodec.h>
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -23,10 +29,12 @@
 
 #define GLIMPL_RUNTIME_USES_SHARED_MEMORY (net_ctx == NULL)
 
-#define GLIMPL_MAX_OBJECTS 256
+#define GLIMPL_MAX_OBJECTS SGL_MAX_VERTEX_ATTRIBS
 #define GLIMPL_MAX_TEXTURES 8
 #define GLIMPL_MAX_COUNT_FOR_MATRIX_OP 256 // MSVC doesn't support VLAs
 
+#define GLIMPL_DEFAULT_ARRAY_CACHE_SIZE 64 // MiB
+
 // used by glGet*v
 #define GL_GET_MEMCPY_RETVAL_EX(name, data, type) \
     switch (name) { \
@@ -120,8 +128,56 @@ struct gl_map_buffer {
     bool in_use;
 };
 
+/*
+ * persistent mappings point straight into the map region of our slot,
+ * which the server mirrors into the real mapping. windows are placed
+ * at offsets within the region
+ */
+#define GLIMPL_MAX_MAP_WINDOWS 16
+#define GLIMPL_MAP_WINDOW_ALIGNMENT 64
+
+struct gl_map_window {
+    GLuint buffer;
+    size_t window;
+    size_t length;
+    GLbitfield access;
+    bool in_use;
+};
+
+/*
+ * attributes of a batched glBegin/glEnd block, each one
+ * matching the bit of the same index in SGL_IMMEDIATE_*
+ */
+enum {
+    GLIMPL_IMMEDIATE_TEXCOORD,
+    GLIMPL_IMMEDIATE_COLOR,
+    GLIMPL_IMMEDIATE_NORMAL,
+    GLIMPL_IMMEDIATE_ATTRIBS
+};
+
+static const int glimpl_immediate_sizes[GLIMPL_IMMEDIATE_ATTRIBS] = { 4, 4, 3 };
+
+struct gl_immediate {
+    bool begun;
+    bool batching;
+    GLenum mode;
+    size_t mark; /* pb_size() when the block began */
+    int layout; /* -1 until the first vertex */
+    int seen;
+    float current[GLIMPL_IMMEDIATE_ATTRIBS][4];
+    float *vertices;
+    size_t count;
+    size_t capacity; /* floats */
+};
+
 struct gl_vertex_attrib_pointer     glimpl_vaps[GLIMPL_MAX_OBJECTS];
 
+/*
+ * attributes set up through vertex buffer bindings aren't followed,
+ * this only records that some were so draws don't assume otherwise
+ */
+bool                                glimpl_vertex_bindings_used = false;
+
 struct gl_color_tex_vertex_pointer  glimpl_color_ptr,
                                     glimpl_tex_coord_ptr[GLIMPL_MAX_TEXTURES],
                                     glimpl_vertex_ptr,
@@ -138,6 +194,11 @@ struct gl_edge_flag_pointer         glimpl_edge_flag_ptr;
 
 struct gl_map_buffer                glimpl_map_buffer;
 
+struct gl_map_window                glimpl_map_windows[GLIMPL_MAX_MAP_WINDOWS];
+int                                 glimpl_map_window_count = 0;
+
+struct gl_immediate                 glimpl_immediate;
+
 float                               glimpl_global_matrix_double_to_float[GLIMPL_MAX_COUNT_FOR_MATRIX_OP];
 
 #define NUM_EXTENSIONS 84
@@ -318,17 +379,59 @@ static const char glimpl_extensions_list[NUM_EXTENSIONS][48] = {
 static struct net_context *net_ctx = NULL;
 static int *fake_register_space = NULL;
 static int *fake_framebuffer = NULL;
+static int fake_framebuffer_width = 0, fake_framebuffer_height = 0;
 static int fake_swap_buffers_sync = 0;
 
+/*
+ * packets of the frame being received, a frame is only
+ * decoded once all of them arrived
+ */
+static struct sgl_packet_swapbuffers_result *fb_chunks = NULL;
+static int fb_chunk_capacity = 0;
+static uint32_t fb_frame = 0;
+static bool fb_previous_complete = true;
+
 static int glimpl_major = SGL_DEFAULT_MAJOR;
 static int glimpl_minor = SGL_DEFAULT_MINOR;
 
 static int client_id = 0;
 static void *lockg;
 
+/*
+ * the server answers every submit with a retval packet, which is only
+ * read once the client actually needs a return value. past this many
+ * unread packets we drain them anyway, so that the server never blocks
+ * on a full socket while we block on sending to it
+ */
+#define GLIMPL_MAX_PENDING_RETVALS 64
+
+static int pending_retvals = 0;
+
+/*
+ * blocks until every pending packet is in. a packet that never arrives
+ * would leave every later return value off by one, so losing the server
+ * here is fatal
+ */
+static void net_wait_idle()
+{
+    struct sgl_packet_retval packet;
+
+    while (pending_retvals) {
+        if (!net_recv_tcp(net_ctx, NET_SOCKET_SERVER, &packet, sizeof(packet))) {
+            fprintf(stderr, "net_wait_idle: lost the connection to the server with %d replies pending\n", pending_retvals);
+            exit(1);
+        }
+
+        memcpy(fake_register_space, &packet, 256 + 8);
+        pending_retvals--;
+    }
+}
+
 /* pb_read hook if using network feature */
 static int pb_read_hook(int offset)
 {
+    net_wait_idle();
+
     switch (offset) {
     case SGL_OFFSET_REGISTER_RETVAL:
         return fake_register_space[0];
@@ -337,6 +440,8 @@ static int pb_read_hook(int offset)
     case SGL_OFFSET_REGISTER_GLMIN:
         return glimpl_minor;
     default:
+        if (offset >= SGL_OFFSET_REGISTER_RETVAL_V)
+            return fake_register_space[2 + (offset - SGL_OFFSET_REGISTER_RETVAL_V) / sizeof(int)];
         return fake_register_space[offset];
     }
 }
@@ -344,8 +449,12 @@ static int pb_read_hook(int offset)
 /* pb_read64 hook if using network feature */
 static int64_t pb_read64_hook(int offset)
 {
+    net_wait_idle();
+
     if (offset == SGL_OFFSET_REGISTER_RETVAL)
         return *(int64_t*)&fake_register_space[0];
+    if (offset >= SGL_OFFSET_REGISTER_RETVAL_V)
+        return *(int64_t*)&fake_register_space[2 + (offset - SGL_OFFSET_REGISTER_RETVAL_V) / sizeof(int)];
     return *(int64_t*)&fake_register_space[offset];
 }
 
@@ -354,8 +463,10 @@ static void *pb_ptr_hook(size_t offset)
 {
     switch (offset) {
     case SGL_OFFSET_REGISTER_RETVAL:
+        net_wait_idle();
         return &fake_register_space[0];
     case SGL_OFFSET_REGISTER_RETVAL_V:
+        net_wait_idle();
         return &fake_register_space[2];
     case SGL_OFFSET_REGISTER_SWAP_BUFFERS_SYNC:
         return &fake_swap_buffers_sync;
@@ -365,6 +476,67 @@ static void *pb_ptr_hook(size_t offset)
     }
 }
 
+/* pb_download hook if using network feature */
+static void pb_download_hook(void *dst, size_t length)
+{
+    /*
+     * the data follows the retval packet of the batch that asked for it
+     */
+    net_wait_idle();
+    net_recv_tcp(net_ctx, NET_SOCKET_SERVER, dst, length);
+}
+
+/*
+ * room left for the commands that follow an upload
+ */
+#define GLIMPL_UPLOAD_SLACK 4096
+
+/*
+ * submits early if size more bytes wouldn't fit in the batch
+ */
+static inline void glimpl_reserve(size_t size)
+{
+    if (pb_size() > 0 && pb_size() + size + GLIMPL_UPLOAD_SLACK > pb_capacity())
+        glimpl_submit();
+}
+
+/*
+ * starts the command of a gl call. a call pushes at most
+ * GLIMPL_UPLOAD_SLACK bytes besides what it reserves, so
+ * the batch is submitted before it could overflow
+ */
+static inline void glimpl_push_command(int cmd)
+{
+    if (pb_size() + GLIMPL_UPLOAD_SLACK > pb_capacity())
+        glimpl_submit();
+
+    pb_push(cmd);
+}
+
+/*
+ * starts a gl call that pushes size bytes on top of GLIMPL_UPLOAD_SLACK.
+ * a call no batch could hold is dropped, false is returned for it
+ */
+static inline bool glimpl_push_command_sized(int cmd, size_t size)
+{
+    if (size + GLIMPL_UPLOAD_SLACK > pb_capacity()) {
+        fprintf(stderr, "glimpl_push_command_sized: command %d needs %zu bytes, a batch holds %zu\n", cmd, size, pb_capacity() - GLIMPL_UPLOAD_SLACK);
+        return false;
+    }
+
+    glimpl_reserve(size);
+    pb_push(cmd);
+    return true;
+}
+
+/*
+ * upper bound of what push_string pushes
+ */
+static size_t push_string_size(const char *s)
+{
+    return (strlen(s) / 4 + 1) * sizeof(int);
+}
+
 static void push_string(const char *s)
 {
     int len = strlen(s);
@@ -393,6 +565,31 @@ static void push_string(const char *s)
         pb_push(0);
 }
 
+/*
+ * name lookups which stay valid until the program is linked again
+ */
+static GLint glimpl_get_location(int cmd, enum location_kind kind, GLuint program, const char *name)
+{
+    GLint location;
+
+    if (locations_find(program, kind, name, &location))
+        return location;
+
+    if (!glimpl_push_command_sized(cmd, push_string_size(name)))
+        return -1;
+
+    pb_push(program);
+    push_string(name);
+
+    glimpl_submit();
+    location = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+
+    if (program != 0)
+        locations_add(program, kind, name, location);
+
+    return location;
+}
+
 /*
  * temporary solution to submit stalling out at `recv` when
  * submitting the goodbye message
@@ -402,73 +599,47 @@ bool expecting_retval = true;
 static inline void submit_shm()
 {
     /*
-     * lock
-     */
-    spin_lock(lockg);
-
-    /* 
-     * hint to server that we're ready 
-     */
-    pb_write(SGL_OFFSET_REGISTER_READY_HINT, client_id);
-
-    /*
-     * copy internal buffer to shared memory and submit
+     * copy internal buffer into our ring, no locking is needed
+     * as no other client touches our slot. we don't wait for the
+     * server here, reading a return value does that for us
      */
     pb_copy_to_shared();
-    pb_write(SGL_OFFSET_REGISTER_SUBMIT, 1);
-    while (pb_read(SGL_OFFSET_REGISTER_SUBMIT) == 1);
     pb_reset();
-
-    /*
-     * unlock
-     */
-    spin_unlock(lockg);
 }
 
 static inline void submit_net()
 {
-    void *ptr = pb_iptr(0);
-    size_t size = pb_size();
-    int blocks = CEIL_DIV(size, SGL_FIFO_UPLOAD_COMMAND_BLOCK_SIZE);
-    size_t min_size = 0;
-    size_t count = size / 4;
-    struct sgl_packet_retval packet;
-
-    /*
-     * packet
-     */
-    for (int i = 0; i < blocks; i++) {
-        size_t packet_count = MIN(count, SGL_FIFO_UPLOAD_COMMAND_BLOCK_COUNT);
-
-        struct sgl_packet_fifo_upload packet = {
-            /* client_id = */       client_id,
-            /* expected_chunks = */ blocks,
-            /* index = */           i,
-            /* count = */           packet_count,
-            /* commands = */        { 0 }
-        };
+    struct sgl_packet_fifo_upload packet = {
+        /* client_id = */   client_id,
+        /* size = */        pb_size()
+    };
 
-        memcpy(packet.commands, (char*)ptr + (i * SGL_FIFO_UPLOAD_COMMAND_BLOCK_SIZE), packet_count * sizeof(uint32_t));
-        net_send_tcp(net_ctx, NET_SOCKET_SERVER, &packet, sizeof(packet));
+    struct net_buffer buffers[] = {
+        { &packet, sizeof(packet) },
+        { pb_iptr(0), packet.size }
+    };
 
-        count -= SGL_FIFO_UPLOAD_COMMAND_BLOCK_COUNT;
-    }
+    net_send_tcp_buffers(net_ctx, NET_SOCKET_SERVER, buffers, 2);
 
     /*
-     * get retval registers
+     * retval registers are picked up once they're read
      */
     if (expecting_retval)
-        net_recv_tcp_timeout(net_ctx, NET_SOCKET_SERVER, &packet, sizeof(packet), 500);
+        pending_retvals++;
+
+    if (pending_retvals >= GLIMPL_MAX_PENDING_RETVALS)
+        net_wait_idle();
 
-    /*
-     * write response into fake register space
-     */
-    memcpy(fake_register_space, &packet, 256 + 8); 
     pb_reset();
 }
 
+static void glimpl_immediate_spill(void);
+
 void glimpl_submit()
 {
+    if (glimpl_immediate.batching)
+        glimpl_immediate_spill();
+
     /*
      * processor stops at 0
      */
@@ -482,6 +653,12 @@ void glimpl_submit()
 
 void glimpl_goodbye()
 {
+    /*
+     * never connected, nobody to say goodbye to
+     */
+    if (client_id == 0)
+        return;
+
     expecting_retval = false;
 
     /*
@@ -514,41 +691,134 @@ static inline void swap_buffers_shm(int width, int height, int vflip, int format
     pb_push(vflip);
     pb_push(format);
     glimpl_submit();
+
+    /*
+     * the framebuffer is read right after we return
+     */
+    pb_wait_idle();
 }
 
+/*
+ * how long to wait for the server to answer a frame request, and for
+ * each framebuffer packet before asking for the missing ones again
+ */
+#define GLIMPL_FB_REQUEST_TIMEOUT_MS 250
+#define GLIMPL_FB_PACKET_TIMEOUT_MS 20
+
+/*
+ * after this many unanswered frame or retransmit requests the frame is dropped
+ */
+#define GLIMPL_FB_REQUEST_ATTEMPTS 8
+#define GLIMPL_FB_RETRANSMIT_ATTEMPTS 8
+
 static inline void swap_buffers_net(int width, int height, int vflip, int format)
 {
-    int expected = CEIL_DIV((width * height * 4), SGL_SWAPBUFFERS_RESULT_SIZE);
-    struct sgl_packet_sync sync;
+    struct sgl_packet_sync sync = { 0 };
+    uint8_t received[SGL_SWAPBUFFERS_MAX_CHUNKS / 8] = { 0 };
+    int count = 0, attempts = 0;
 
     glimpl_submit();
 
+    /*
+     * pending retval packets would otherwise be mistaken for the sync packet
+     */
+    net_wait_idle();
+
+    if (width > fake_framebuffer_width || height > fake_framebuffer_height)
+        return;
+
     struct sgl_packet_swapbuffers_request packet = {
-        /* client_id = */   client_id,
-        /* width = */       width,
-        /* height = */      height,
-        /* vflip = */       vflip,
-        /* format = */      format
+        /* client_id = */           client_id,
+        /* type = */                SGL_SWAPBUFFERS_REQUEST_FRAME,
+        /* frame = */               ++fb_frame,
+        /* width = */               width,
+        /* height = */              height,
+        /* vflip = */               vflip,
+        /* format = */              format,
+        /* previous_complete = */   fb_previous_complete
     };
 
-    net_send_udp(net_ctx, &packet, sizeof(packet), 0);
+    /*
+     * the request may get lost, so ask again until the server answers. syncs
+     * of earlier frames which were asked for twice are skipped. if it never
+     * answers the frame is dropped, and the next one is asked for whole
+     */
+    do {
+        if (attempts++ == GLIMPL_FB_REQUEST_ATTEMPTS) {
+            fprintf(stderr, "swap_buffers_net: no answer to frame %u, dropping it\n", fb_frame);
+            fb_previous_complete = false;
+            return;
+        }
+
+        net_send_udp(net_ctx, &packet, offsetof(struct sgl_packet_swapbuffers_request, missing), 0);
+        while (net_wait_tcp(net_ctx, NET_SOCKET_SERVER, GLIMPL_FB_REQUEST_TIMEOUT_MS)) {
+            if (!net_recv_tcp(net_ctx, NET_SOCKET_SERVER, &sync, sizeof(sync))) {
+                fb_previous_complete = false;
+                return;
+            }
+            if (sync.frame == fb_frame)
+                break;
+        }
+    } while (sync.frame != fb_frame);
 
-    // wait for sync, timeout appears to disturb fifo upload
-    net_recv_tcp(net_ctx, NET_SOCKET_SERVER, &sync, sizeof(sync));
+    attempts = 0;
 
-    for (int i = 0; i < expected * 4; i++) {
-        struct sgl_packet_swapbuffers_result result;
-        // while (net_recv_udp(net_ctx, &result, sizeof(result), 0) == -1);
-        int recieved = net_recv_udp(net_ctx, &result, sizeof(result), 0);
+    if (sync.chunks > SGL_SWAPBUFFERS_MAX_CHUNKS) {
+        fb_previous_complete = false;
+        return;
+    }
 
-        // global, so throwout any results that aren't ours (possible vuln for other applications? idk)
-        if (result.client_id != client_id || recieved < 0) {
-            // i--;
+    if (fb_chunk_capacity < sync.chunks) {
+        struct sgl_packet_swapbuffers_result *chunks = realloc(fb_chunks, sync.chunks * sizeof(*chunks));
+        if (chunks == NULL) {
+            fb_previous_complete = false;
+            return;
+        }
+        fb_chunks = chunks;
+        fb_chunk_capacity = sync.chunks;
+    }
+
+    /*
+     * packets are received in place, and only kept if they
+     * belong to this frame and weren't seen before
+     */
+    packet.type = SGL_SWAPBUFFERS_REQUEST_RETRANSMIT;
+    while (count < sync.chunks) {
+        struct sgl_packet_swapbuffers_result *result = &fb_chunks[count];
+        long recieved = net_recv_udp_timeout(net_ctx, result, sizeof(*result), 0, GLIMPL_FB_PACKET_TIMEOUT_MS);
+
+        if (recieved < 0) {
+            if (attempts++ == GLIMPL_FB_RETRANSMIT_ATTEMPTS)
+                break;
+
+            for (int i = 0; i < sync.chunks; i++)
+                packet.missing[i / 8] = ~received[i / 8];
+            net_send_udp(net_ctx, &packet, offsetof(struct sgl_packet_swapbuffers_request, missing) + CEIL_DIV(sync.chunks, 8), 0);
             continue;
         }
 
-        memcpy((char*)fake_framebuffer + (result.index * SGL_SWAPBUFFERS_RESULT_SIZE), result.result, result.size);
+        if (recieved < (long)offsetof(struct sgl_packet_swapbuffers_result, result) || recieved < (long)offsetof(struct sgl_packet_swapbuffers_result, result) + (long)result->size)
+            continue;
+        if (result->client_id != client_id || result->frame != fb_frame || result->index >= sync.chunks)
+            continue;
+        if (received[result->index / 8] & (1 << (result->index % 8)))
+            continue;
+
+        received[result->index / 8] |= 1 << (result->index % 8);
+        count++;
     }
+
+    /*
+     * never show a partial frame; the server resends every
+     * tile next frame if this one is incomplete
+     */
+    fb_previous_complete = count == sync.chunks;
+    if (!fb_previous_complete)
+        return;
+
+    for (int i = 0; i < count; i++)
+        if (!fb_decode(fb_chunks[i].result, fb_chunks[i].size, fb_chunks[i].tile_size, fb_chunks[i].tile_count, (uint32_t*)fake_framebuffer, width, height, fake_framebuffer_width))
+            fb_previous_complete = false;
 }
 
 void glimpl_swap_buffers(int width, int height, int vflip, int format)
@@ -567,7 +837,7 @@ void *glimpl_fb_address()
     return pb_ptr(pb_read64(SGL_OFFSET_REGISTER_FBSTART));
 }
 
-static inline void init_shm(bool use_direct_access)
+static inline void init_shm()
 {
 #ifndef _WIN32
     int fd = shm_open(SGL_SHARED_MEMORY_NAME, O_RDWR, S_IRWXU);
@@ -578,9 +848,9 @@ static inline void init_shm(bool use_direct_access)
         exit(1);
     }
 
-    pb_set(fd, use_direct_access);
+    pb_set(fd);
 #else
-    pb_set(use_direct_access);
+    pb_set();
 #endif
     pb_reset();
 }
@@ -594,15 +864,34 @@ static inline void shm_create_context()
      * next claimee to claim
      */
     spin_lock(lockg);
+    int *slot_table = pb_ptr(SGL_OFFSET_SLOT_TABLE);
+    int slot_count = pb_read(SGL_OFFSET_REGISTER_SLOT_COUNT);
+    int slot = -1;
+
+    for (int i = 0; i < slot_count; i++) {
+        if (slot_table[i] == 0) {
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot == -1) {
+        spin_unlock(lockg);
+        fprintf(stderr, "shm_create_context: all %d client slots are in use\n", slot_count);
+        exit(1);
+    }
+
     client_id = pb_read(SGL_OFFSET_REGISTER_CLAIM_ID);
-    pb_write(SGL_OFFSET_REGISTER_READY_HINT, client_id);
     pb_write(SGL_OFFSET_REGISTER_CLAIM_ID, client_id + 1);
 
     /*
-     * notify the server we would like to connect
+     * notify the server we would like to connect by
+     * writing our id into the slot table
      */
-    pb_write(SGL_OFFSET_REGISTER_CONNECT, client_id);
+    slot_table[slot] = client_id;
     spin_unlock(lockg);
+
+    pb_claim_slot(slot);
         
     /*
      * submit
@@ -625,7 +914,8 @@ static inline void init_net(char *network)
         NULL,
         NULL,
         pb_ptr_hook,
-        NULL
+        NULL,
+        pb_download_hook
     };
 
     /*
@@ -653,8 +943,10 @@ static inline void init_net(char *network)
 
     fake_register_space = malloc(SGL_OFFSET_COMMAND_START);
     fake_framebuffer = malloc(packet.framebuffer_size);
+    fake_framebuffer_width = packet.max_width;
+    fake_framebuffer_height = packet.max_height;
 
-    pb_set_net(hooks, packet.fifo_size);
+    pb_set_net(hooks, packet.fifo_size, packet.download_size);
 
     icd_set_max_dimensions(packet.max_width, packet.max_height);
 }
@@ -663,9 +955,18 @@ void glimpl_init()
 {
     char *network = getenv("SGL_NET_OVER_SHARED");
     char *gl_version_override = getenv("GL_VERSION_OVERRIDE");
+    char *array_cache_size = getenv("SGL_ARRAY_CACHE_SIZE");
+    long array_cache_mib = array_cache_size ? strtol(array_cache_size, NULL, 10) : GLIMPL_DEFAULT_ARRAY_CACHE_SIZE;
+
+    if (array_cache_mib < 0) {
+        fprintf(stderr, "glimpl_init: SGL_ARRAY_CACHE_SIZE can't be negative, using %d\n", GLIMPL_DEFAULT_ARRAY_CACHE_SIZE);
+        array_cache_mib = GLIMPL_DEFAULT_ARRAY_CACHE_SIZE;
+    }
+
+    arraycache_init((size_t)array_cache_mib * 1024 * 1024);
 
     if (network == NULL)
-        init_shm(false);
+        init_shm();
     else
         init_net(network);
 
@@ -751,8 +1052,50 @@ static inline size_t glimpl_type_size(GLenum type)
     return 1;
 }
 
+/*
+ * uploads larger than this are streamed in chunks
+ */
+static inline size_t glimpl_upload_watermark()
+{
+    return (pb_capacity() / 4) & ~(size_t)3;
+}
+
+/*
+ * every chunk but the last is submitted on its own, the last one shares a
+ * batch with the command using the upload. the server reassembles them.
+ * uploads into a staging slot other than 0 stay around for client side
+ * vertex arrays, each array of a draw has a slot of its own
+ */
+static void glimpl_upload_chunked(const void *data, size_t size, int slot)
+{
+    size_t chunk = glimpl_upload_watermark();
+
+    glimpl_reserve(MIN(chunk, size) + 5 * sizeof(int));
+
+    for (size_t offset = 0; offset < size; offset += chunk) {
+        size_t length = MIN(chunk, size - offset);
+
+        pb_push(SGL_CMD_VP_UPLOAD_CHUNK);
+        pb_push(slot);
+        pb_push(CEIL_DIV(size, 4));
+        pb_push(offset / 4);
+        pb_push(CEIL_DIV(length, 4));
+        pb_memcpy((const char*)data + offset, length);
+
+        if (offset + length < size)
+            glimpl_submit();
+    }
+}
+
 static inline void glimpl_upload_buffer(const void *data, size_t size)
 {
+    if (size > glimpl_upload_watermark()) {
+        glimpl_upload_chunked(data, size, 0);
+        return;
+    }
+
+    glimpl_reserve(size + 2 * sizeof(int));
+
     pb_push(SGL_CMD_VP_UPLOAD);
     pb_push(CEIL_DIV(size, 4));
     pb_memcpy((void*)data, size);
@@ -760,22 +1103,21 @@ static inline void glimpl_upload_buffer(const void *data, size_t size)
 
 static inline void glimpl_download_buffer(void *dst, size_t size)
 {
-    int blocks = CEIL_DIV(size, SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES);
-    size_t count = size;
+    size_t chunk = pb_download_capacity();
 
-    void *retval_v = pb_ptr(SGL_OFFSET_REGISTER_RETVAL_V);
-
-    for (int i = 0; i < blocks; i++) {
-        size_t true_count = MIN(count, SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES);
+    /*
+     * one round trip per download region, which usually
+     * means one for the whole download
+     */
+    for (size_t offset = 0; offset < size; offset += chunk) {
+        size_t length = MIN(chunk, size - offset);
 
         pb_push(SGL_CMD_VP_DOWNLOAD);
-        pb_push(true_count);
-        
-        glimpl_submit();
+        pb_push(length);
 
-        memcpy((char*)dst + (i * SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES), retval_v, true_count);
+        glimpl_submit();
 
-        count -= SGL_VP_DOWNLOAD_BLOCK_SIZE_IN_BYTES;
+        pb_download((char*)dst + offset, length);
     }
 }
 
@@ -791,12 +1133,294 @@ static void glimpl_upload_texture(GLsizei width, GLsizei height, GLsizei depth,
     glimpl_upload_buffer(pixels, total_size);
 }
 
-static inline void glimpl_push_vertex_attrib_pointers(int count)
+/*
+ * frees what the array cache has evicted since the last draw
+ */
+static inline void glimpl_cache_release(void)
 {
+    GLuint entry;
+
+    while ((entry = arraycache_next_released()) != 0) {
+        pb_push(SGL_CMD_VP_CACHE_RELEASE);
+        pb_push(entry);
+    }
+}
+
+/*
+ * keeps the last upload in the given entry of the array cache
+ */
+static inline void glimpl_cache_store(GLuint entry, size_t size)
+{
+    if (entry == 0)
+        return;
+
+    pb_push(SGL_CMD_VP_CACHE_STORE);
+    pb_push(entry);
+    pb_push(size);
+}
+
+/*
+ * glBegin/glEnd blocks are gathered into interleaved vertices and drawn
+ * with a single upload. anything else pushed in the middle of a block
+ * spills the vertices gathered so far as regular immediate mode commands
+ * and leaves the rest of the block unbatched
+ */
+/*
+ * signed integer colors and normals map to [-1, 1]
+ */
+#define GLIMPL_SNORM(c, max) MAX((float)(c) / (max), -1.0f)
+#define GLIMPL_SNORM8(c) GLIMPL_SNORM(c, 127.0f)
+#define GLIMPL_SNORM16(c) GLIMPL_SNORM(c, 32767.0f)
+#define GLIMPL_SNORM32(c) GLIMPL_SNORM(c, 2147483647.0f)
+
+static size_t glimpl_immediate_stride(int layout)
+{
+    size_t stride = 4;
+    for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++)
+        if (layout & (1 << i))
+            stride += glimpl_immediate_sizes[i];
+    return stride;
+}
+
+static void glimpl_immediate_push_attrib(int attrib, const float *v)
+{
+    static const int commands[GLIMPL_IMMEDIATE_ATTRIBS] = {
+        /* GLIMPL_IMMEDIATE_TEXCOORD = */ SGL_CMD_TEXCOORD4F,
+        /* GLIMPL_IMMEDIATE_COLOR = */ SGL_CMD_COLOR4F,
+        /* GLIMPL_IMMEDIATE_NORMAL = */ SGL_CMD_NORMAL3F
+    };
+
+    pb_push(commands[attrib]);
+    for (int i = 0; i < glimpl_immediate_sizes[attrib]; i++)
+        pb_pushf(v[i]);
+}
+
+/*
+ * the current values set within the block, which glEnd leaves behind
+ */
+static void glimpl_immediate_push_current(void)
+{
+    for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++)
+        if (glimpl_immediate.seen & (1 << i))
+            glimpl_immediate_push_attrib(i, glimpl_immediate.current[i]);
+}
+
+static void glimpl_immediate_spill(void)
+{
+    struct gl_immediate *im = &glimpl_immediate;
+    size_t stride = glimpl_immediate_stride(im->layout);
+    size_t pushed = pb_size() - im->mark;
+    void *foreign = NULL;
+
+    im->batching = false;
+
+    /*
+     * commands pushed since glBegin go after the vertices
+     */
+    if (pushed) {
+        foreign = malloc(pushed);
+        memcpy(foreign, pb_iptr(im->mark), pushed);
+        pb_truncate(im->mark);
+    }
+
+    pb_push(SGL_CMD_BEGIN);
+    pb_push(im->mode);
+
+    for (size_t v = 0; v < im->count; v++) {
+        const float *vertex = &im->vertices[v * stride];
+
+        glimpl_reserve((stride + GLIMPL_IMMEDIATE_ATTRIBS + 1) * sizeof(int));
+
+        for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++) {
+            if (im->layout & (1 << i)) {
+                glimpl_immediate_push_attrib(i, vertex);
+                vertex += glimpl_immediate_sizes[i];
+            }
+        }
+
+        pb_push(SGL_CMD_VERTEX4F);
+        for (int i = 0; i < 4; i++)
+            pb_pushf(vertex[i]);
+    }
+
+    glimpl_immediate_push_current();
+
+    if (pushed) {
+        glimpl_reserve(pushed);
+        pb_memcpy_unaligned(foreign, pushed);
+        free(foreign);
+    }
+}
+
+/*
+ * true while the block is still being gathered
+ */
+static bool glimpl_immediate_batching(void)
+{
+    if (glimpl_immediate.batching && pb_size() != glimpl_immediate.mark)
+        glimpl_immediate_spill();
+    return glimpl_immediate.batching;
+}
+
+static bool glimpl_immediate_attrib(int attrib, float x, float y, float z, float w)
+{
+    struct gl_immediate *im = &glimpl_immediate;
+
+    if (!glimpl_immediate_batching())
+        return false;
+
+    /*
+     * the layout is fixed by the first vertex
+     */
+    if (im->layout != -1 && !(im->layout & (1 << attrib))) {
+        glimpl_immediate_spill();
+        return false;
+    }
+
+    im->current[attrib][0] = x;
+    im->current[attrib][1] = y;
+    im->current[attrib][2] = z;
+    im->current[attrib][3] = w;
+    im->seen |= 1 << attrib;
+
+    return true;
+}
+
+static bool glimpl_immediate_vertex(float x, float y, float z, float w)
+{
+    struct gl_immediate *im = &glimpl_immediate;
+
+    if (!glimpl_immediate_batching())
+        return false;
+
+    if (im->layout == -1)
+        im->layout = im->seen;
+
+    size_t stride = glimpl_immediate_stride(im->layout);
+    if ((im->count + 1) * stride > im->capacity) {
+        size_t capacity = MAX(im->capacity * 2, stride * 256);
+        float *vertices = realloc(im->vertices, capacity * sizeof(float));
+        if (vertices == NULL) {
+            glimpl_immediate_spill();
+            return false;
+        }
+
+        im->vertices = vertices;
+        im->capacity = capacity;
+    }
+
+    float *vertex = &im->vertices[im->count++ * stride];
+    for (int i = 0; i < GLIMPL_IMMEDIATE_ATTRIBS; i++) {
+        if (im->layout & (1 << i)) {
+            memcpy(vertex, im->current[i], glimpl_immediate_sizes[i] * sizeof(float));
+            vertex += glimpl_immediate_sizes[i];
+        }
+    }
+
+    vertex[0] = x;
+    vertex[1] = y;
+    vertex[2] = z;
+    vertex[3] = w;
+
+    return true;
+}
+
+static inline size_t glimpl_vertex_attrib_pointer_stride(struct gl_vertex_attrib_pointer *vap)
+{
+    return vap->stride ? vap->stride : vap->size * glimpl_type_size(vap->type);
+}
+
+static inline size_t glimpl_vertex_attrib_pointer_size(struct gl_vertex_attrib_pointer *vap, int count)
+{
+    if (count <= 0)
+        return 0;
+    return (count - 1) * glimpl_vertex_attrib_pointer_stride(vap) + vap->size * glimpl_type_size(vap->type);
+}
+
+/*
+ * staging slot of the last array staged for the draw being pushed
+ */
+static int glimpl_staging_slot = 0;
+
+static inline int glimpl_color_pointer_size(void)
+{
+    return glimpl_color_ptr.size > 8 ? glimpl_get_pixel_size(glimpl_color_ptr.size) : glimpl_color_ptr.size;
+}
+
+/*
+ * the size of a client pointer's upload once packed, along with the commands around it
+ */
+static inline size_t glimpl_client_pointer_size(int count, int size, int type, const void *pointer)
+{
+    if (is_value_likely_an_offset(pointer) || count <= 0)
+        return 0;
+    return count * size * glimpl_type_size(type) + 24 * sizeof(int);
+}
+
+static inline size_t glimpl_client_pointers_size(int count)
+{
+    size_t total = 0;
+
+    if (glimpl_normal_ptr.in_use)
+        total += glimpl_client_pointer_size(count, 3, glimpl_normal_ptr.type, glimpl_normal_ptr.pointer);
+    if (glimpl_color_ptr.in_use)
+        total += glimpl_client_pointer_size(count, glimpl_color_pointer_size(), glimpl_color_ptr.type, glimpl_color_ptr.pointer);
+    for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++)
+        if (glimpl_tex_coord_ptr[t].in_use)
+            total += glimpl_client_pointer_size(count, glimpl_tex_coord_ptr[t].size, glimpl_tex_coord_ptr[t].type, glimpl_tex_coord_ptr[t].pointer);
+    if (glimpl_vertex_ptr.in_use)
+        total += glimpl_client_pointer_size(count, glimpl_vertex_ptr.size, glimpl_vertex_ptr.type, glimpl_vertex_ptr.pointer);
+
+    return total;
+}
+
+/*
+ * uploads vertices [first, first + count) of every generic client side
+ * array, extra is the size of uploads that have to share a batch with
+ * them. returns whether the arrays are staged, which the client pointers
+ * pushed right after must follow
+ */
+static inline bool glimpl_push_vertex_attrib_pointers(int first, int count, size_t extra)
+{
+    size_t total = extra + glimpl_client_pointers_size(count);
+    bool staged;
+
+    glimpl_cache_release();
+    glimpl_staging_slot = 0;
+
+    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++) {
+        struct gl_vertex_attrib_pointer *vap = &glimpl_vaps[i];
+        if (vap->client_managed)
+            total += glimpl_vertex_attrib_pointer_size(vap, count) + 16 * sizeof(int);
+    }
+
+    /*
+     * every array must still be around once the draw command runs, if they
+     * don't all fit in one batch they are staged on the server instead
+     */
+    staged = total > glimpl_upload_watermark();
+    if (!staged && total > 0)
+        glimpl_reserve(total);
+
     for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++) {
         struct gl_vertex_attrib_pointer *vap = &glimpl_vaps[i];
         if (vap->client_managed) {
-            glimpl_upload_buffer(vap->ptr, vap->size * count * glimpl_type_size(vap->type));
+            const char *data = (const char*)vap->ptr + first * glimpl_vertex_attrib_pointer_stride(vap);
+            size_t size = glimpl_vertex_attrib_pointer_size(vap, count);
+            GLuint entry;
+
+            if (arraycache_find(data, size, &entry)) {
+                pb_push(SGL_CMD_VP_CACHE_BIND);
+                pb_push(entry);
+            }
+            else {
+                if (staged)
+                    glimpl_upload_chunked(data, size, ++glimpl_staging_slot);
+                else
+                    glimpl_upload_buffer(data, size);
+
+                glimpl_cache_store(entry, size);
+            }
 
             pb_push(SGL_CMD_VERTEXATTRIBPOINTER);
             pb_push(vap->index);
@@ -807,37 +1431,86 @@ static inline void glimpl_push_vertex_attrib_pointers(int count)
             pb_push(LIKELY_OFFSET_LIMIT + 1); // force server to use upload
         }
     }
+
+    return staged;
+}
+
+/*
+ * strided arrays are packed before they are staged, as chunks
+ * are cut from a single contiguous copy
+ */
+static const void *glimpl_pack_client_pointer(const unsigned char *data, int count, size_t element, int stride)
+{
+    static unsigned char *packed = NULL;
+    static size_t capacity = 0;
+    size_t size = count * element;
+
+    if (capacity < size) {
+        unsigned char *grown = realloc(packed, size);
+        if (grown == NULL)
+            return NULL;
+        packed = grown;
+        capacity = size;
+    }
+
+    for (int i = 0; i < count; i++)
+        memcpy(packed + i * element, data + i * stride, element);
+
+    return packed;
 }
 
-static inline bool glimpl_push_client_pointer(int count, int size, int type, int stride, const void *pointer)
+static inline bool glimpl_push_client_pointer(int first, int count, int size, int type, int stride, const void *pointer, bool staged)
 {
-    const unsigned char *data = pointer;
     size_t sizeof_type = glimpl_type_size(type);
+    size_t element = size * sizeof_type;
+    const unsigned char *data = (const unsigned char*)pointer + first * (stride ? stride : element);
+    const void *packed = data;
+    GLuint entry;
 
     if (is_value_likely_an_offset(pointer))
         return false;
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push((count * size) / CEIL_DIV(sizeof(int), sizeof_type));
+    /*
+     * the cache is keyed by the array as the application laid it out,
+     * but holds it packed just like the upload below
+     */
+    if (arraycache_find(data, count > 0 ? (count - 1) * (stride ? stride : element) + element : 0, &entry)) {
+        pb_push(SGL_CMD_VP_CACHE_BIND);
+        pb_push(entry);
+        return true;
+    }
+
+    if (staged && stride != 0)
+        packed = glimpl_pack_client_pointer(data, count, element, stride);
 
-    if (stride == 0)
-        pb_memcpy(data, count * size * sizeof_type);
+    if (staged && packed != NULL) {
+        glimpl_upload_chunked(packed, count * element, ++glimpl_staging_slot);
+    }
     else {
-        for (int i = 0; i < count; i++) {
-            void *real_data = ((char*)data + i * stride);
-            pb_memcpy_unaligned(real_data, size * sizeof_type);
+        pb_push(SGL_CMD_VP_UPLOAD);
+        pb_push(CEIL_DIV(count * element, sizeof(int)));
+
+        if (stride == 0)
+            pb_memcpy(data, count * element);
+        else {
+            for (int i = 0; i < count; i++) {
+                void *real_data = ((char*)data + i * stride);
+                pb_memcpy_unaligned(real_data, element);
+            }
+            pb_realign();
         }
-        pb_realign();
     }
 
+    glimpl_cache_store(entry, count * element);
+
     return true;
 }
 
-static inline void glimpl_push_client_pointers(int mode, int count)
+static inline void glimpl_push_client_pointers(int mode, int first, int count, bool staged)
 {
     if (glimpl_normal_ptr.in_use) {
-        bool status = glimpl_push_client_pointer(count, 3, /* probably not glimpl_vertex_ptr.size */
-                            glimpl_normal_ptr.type, glimpl_normal_ptr.stride, glimpl_normal_ptr.pointer);
+        bool status = glimpl_push_client_pointer(first, count, 3, /* probably not glimpl_vertex_ptr.size */
+                            glimpl_normal_ptr.type, glimpl_normal_ptr.stride, glimpl_normal_ptr.pointer, staged);
 
         pb_push(SGL_CMD_NORMALPOINTER);
         pb_push(glimpl_normal_ptr.type);
@@ -847,12 +1520,8 @@ static inline void glimpl_push_client_pointers(int mode, int count)
     }
 
     if (glimpl_color_ptr.in_use) {
-        int true_size = glimpl_color_ptr.size;
-        if (true_size > 8)
-            true_size = glimpl_get_pixel_size(true_size);
-
-        bool status = glimpl_push_client_pointer(count, true_size, 
-                            glimpl_color_ptr.type, glimpl_color_ptr.stride, glimpl_color_ptr.pointer);
+        bool status = glimpl_push_client_pointer(first, count, glimpl_color_pointer_size(), 
+                            glimpl_color_ptr.type, glimpl_color_ptr.stride, glimpl_color_ptr.pointer, staged);
 
         pb_push(SGL_CMD_COLORPOINTER);
         pb_push(glimpl_color_ptr.size);
@@ -864,8 +1533,8 @@ static inline void glimpl_push_client_pointers(int mode, int count)
 
     for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++) {
         if (glimpl_tex_coord_ptr[t].in_use) {
-            bool status = glimpl_push_client_pointer(count, glimpl_tex_coord_ptr[t].size, 
-                                glimpl_tex_coord_ptr[t].type, glimpl_tex_coord_ptr[t].stride, glimpl_tex_coord_ptr[t].pointer);
+            bool status = glimpl_push_client_pointer(first, count, glimpl_tex_coord_ptr[t].size, 
+                                glimpl_tex_coord_ptr[t].type, glimpl_tex_coord_ptr[t].stride, glimpl_tex_coord_ptr[t].pointer, staged);
 
             pb_push(SGL_CMD_CLIENTACTIVETEXTURE);
             pb_push(GL_TEXTURE0 + t);
@@ -883,8 +1552,8 @@ static inline void glimpl_push_client_pointers(int mode, int count)
     }
 
     if (glimpl_vertex_ptr.in_use) {
-        bool status = glimpl_push_client_pointer(count, glimpl_vertex_ptr.size,
-                            glimpl_vertex_ptr.type,  glimpl_vertex_ptr.stride, glimpl_vertex_ptr.pointer);
+        bool status = glimpl_push_client_pointer(first, count, glimpl_vertex_ptr.size,
+                            glimpl_vertex_ptr.type,  glimpl_vertex_ptr.stride, glimpl_vertex_ptr.pointer, staged);
 
         pb_push(SGL_CMD_VERTEXPOINTER);
         pb_push(glimpl_vertex_ptr.size);
@@ -895,74 +1564,85 @@ static inline void glimpl_push_client_pointers(int mode, int count)
     }
 }
 
-#define GET_MAX_INDEX(x, y, s, e) \
-    for (int i = s; i < e; i++) \
-        if (y[i] > x) \
-            x = y[i]
+void glGetIntegerv(GLenum pname, GLint* data);
 
-static inline void glimpl_draw_elements(int mode, int type, int start, int end, const void *indices)
+/*
+ * whether every array in use lives in client memory, or at least one
+ * is sourced from a buffer. NULL pointers count as buffer offsets, and
+ * so does anything a vertex array object or a vertex buffer binding
+ * may source, since neither is followed here
+ */
+static inline void glimpl_classify_arrays(bool *has_client, bool *has_buffer)
 {
-    if (indices) {
-        int max_index = 0;
-        switch (type) {
-        case GL_UNSIGNED_BYTE: {
-            const unsigned char *tindices = indices;
-            GET_MAX_INDEX(max_index, tindices, start, end);
-            break;
-        }
-        case GL_UNSIGNED_SHORT: {
-            const unsigned short *tindices = indices;
-            GET_MAX_INDEX(max_index, tindices, start, end);
-            break;
-        }
-        case GL_UNSIGNED_INT: {
-            const unsigned int *tindices = indices;
-            GET_MAX_INDEX(max_index, tindices, start, end);
-            break;
-        }
-        }
+    const struct gl_color_tex_vertex_pointer *pointers[] = { &glimpl_color_ptr, &glimpl_vertex_ptr };
+    GLint vertex_array = 0;
+
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vertex_array);
+
+    *has_client = false;
+    *has_buffer = vertex_array != 0 || glimpl_vertex_bindings_used;
+
+    for (int i = 0; i < GLIMPL_MAX_OBJECTS; i++) {
+        if (glimpl_vaps[i].client_managed)
+            *has_client = true;
+        else if (glimpl_vaps[i].enabled)
+            *has_buffer = true;
+    }
 
-        // increment bc we want count, not the value of the largest index
-        max_index++;
-        glimpl_push_vertex_attrib_pointers(max_index);
-        glimpl_push_client_pointers(mode, max_index);
+    for (int i = 0; i < sizeof(pointers) / sizeof(*pointers); i++)
+        if (pointers[i]->in_use)
+            *(is_value_likely_an_offset(pointers[i]->pointer) ? has_buffer : has_client) = true;
+
+    for (int t = 0; t < GLIMPL_MAX_TEXTURES; t++)
+        if (glimpl_tex_coord_ptr[t].in_use)
+            *(is_value_likely_an_offset(glimpl_tex_coord_ptr[t].pointer) ? has_buffer : has_client) = true;
+
+    if (glimpl_normal_ptr.in_use)
+        *(is_value_likely_an_offset(glimpl_normal_ptr.pointer) ? has_buffer : has_client) = true;
+}
+
+/*
+ * ranged is set by glDrawRangeElements, whose start and end
+ * bound the indices so that they needn't be scanned
+ */
+static inline void glimpl_draw_elements(int mode, int type, int count, const void *indices, bool ranged, GLuint start, GLuint end)
+{
+    bool uploaded = !is_value_likely_an_offset(indices);
+    int basevertex = 0;
+
+    if (uploaded) {
+        size_t size = count * indices_type_size(type);
+        GLuint min = start, max = end;
+        bool has_client, has_buffer;
+
+        if (!ranged)
+            indices_range(type, indices, count, &min, &max);
 
         /*
-         * to-do: pack?
+         * only the vertices the indices refer to are uploaded, the server
+         * offsets every index to get to them. arrays sourced from buffers
+         * would be offset as well, so they need the whole range instead
          */
-        pb_push(SGL_CMD_VP_UPLOAD);
-        pb_push(end - start);
-        switch (type) {
-        case GL_UNSIGNED_BYTE: {
-            const unsigned char *b = indices;
-            for (int i = start; i < end; i++)
-                pb_push(*b++);
-            break;
-        }
-        case GL_UNSIGNED_SHORT: {
-            const unsigned short *s = indices;
-            for (int i = start; i < end; i++)
-                pb_push(*s++);
-            break;
-        }
-        case GL_UNSIGNED_INT: {
-            const unsigned int *u = indices;
-            for (int i = start; i < end; i++)
-                pb_push(*u++);
-            break;
-        }
-        }
+        glimpl_classify_arrays(&has_client, &has_buffer);
+        if (!has_client || has_buffer)
+            min = 0;
+        basevertex = -(int)min;
+
+        bool staged = glimpl_push_vertex_attrib_pointers(min, max - min + 1, size + 2 * sizeof(int));
+        glimpl_push_client_pointers(mode, min, max - min + 1, staged);
+
+        glimpl_upload_buffer(indices, size);
     }
     
     pb_push(SGL_CMD_DRAWELEMENTS);
     pb_push(mode);
-    pb_push(end - start);
-    pb_push(indices != NULL ? GL_UNSIGNED_INT : type); /* to-do: actually use type */
-    pb_push(indices != NULL);
+    pb_push(count);
+    pb_push(type);
+    pb_push(uploaded);
+    pb_push(uploaded ? 0 : (int)(uintptr_t)indices);
+    pb_push(basevertex);
 }
 
-#undef GET_MAX_INDEX
-
 static void glimpl_texture_image(int cmd, int n_dims, GLuint texture, GLint level, GLint internalformat,
         GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
 {
@@ -1031,46 +1711,204 @@ static void glimpl_buffer_store_data(int cmd, GLuint buffer, GLsizeiptr size, co
     pb_push(usage);
 }
 
-static void glimpl_buffer_subdata(int cmd, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+static void glimpl_buffer_subdata(int cmd, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    glimpl_upload_buffer(data, size);
+    
+    pb_push(cmd);
+    pb_push(buffer);
+    pb_push(offset);
+    pb_push(size);
+}
+
+static void glimpl_buffer_clear_data(int cmd, bool is_subdata, GLenum buffer, GLenum internalformat, GLintptr offset, 
+        GLsizeiptr size, GLenum format, GLenum type, const void* data)
+{
+    pb_push(cmd);
+    pb_push(buffer);
+    pb_push(internalformat);
+
+    if (is_subdata) {
+        pb_push(offset);
+        pb_push(size);
+    }
+
+    pb_push(format);
+    pb_push(type);
+    pb_push(*(unsigned int*)data); // to-do: technically should look at type first, dont care
+}
+
+static void glimpl_get_buffer_parameter(int cmd, GLuint buffer, GLenum pname, GLint* params)
+{
+    pb_push(cmd);
+    pb_push(buffer);
+    pb_push(pname);
+
+    glimpl_submit();
+    *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+}
+
+/*
+ * glMapBuffer takes an enum rather than access bits
+ */
+static GLbitfield glimpl_map_access_bits(GLenum access)
+{
+    switch (access) {
+    case GL_READ_ONLY:  return GL_MAP_READ_BIT;
+    case GL_WRITE_ONLY: return GL_MAP_WRITE_BIT;
+    }
+
+    return GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
+}
+
+/*
+ * windows are known by the name of their buffer, a target
+ * stands for whichever buffer is bound to it
+ */
+static GLuint glimpl_map_window_buffer(bool is_named, GLenum buffer)
+{
+    GLint name = 0;
+    GLenum pname;
+
+    if (is_named)
+        return buffer;
+
+    pname = state_buffer_binding_pname(buffer);
+    if (pname != 0)
+        glGetIntegerv(pname, &name);
+    return name;
+}
+
+static struct gl_map_window *glimpl_map_window_find(bool is_named, GLenum buffer)
+{
+    GLuint name;
+
+    if (glimpl_map_window_count == 0)
+        return NULL;
+
+    name = glimpl_map_window_buffer(is_named, buffer);
+    for (int i = 0; i < GLIMPL_MAX_MAP_WINDOWS && name != 0; i++)
+        if (glimpl_map_windows[i].in_use && glimpl_map_windows[i].buffer == name)
+            return &glimpl_map_windows[i];
+
+    return NULL;
+}
+
+static void glimpl_map_window_free(struct gl_map_window *window)
+{
+    window->in_use = false;
+    glimpl_map_window_count--;
+}
+
+/*
+ * first fit, the candidates being the start of the
+ * region and the end of every window in use
+ */
+static struct gl_map_window *glimpl_map_window_alloc(GLuint buffer, size_t length, GLbitfield access)
+{
+    struct gl_map_window *free_window = NULL;
+    size_t region_size = pb_map_region_size();
+
+    for (int i = 0; i < GLIMPL_MAX_MAP_WINDOWS && free_window == NULL; i++)
+        if (!glimpl_map_windows[i].in_use)
+            free_window = &glimpl_map_windows[i];
+
+    if (free_window == NULL || length == 0 || length > region_size)
+        return NULL;
+
+    for (int i = -1; i < GLIMPL_MAX_MAP_WINDOWS; i++) {
+        size_t candidate = 0;
+        bool fits = true;
+
+        if (i != -1) {
+            if (!glimpl_map_windows[i].in_use)
+                continue;
+            candidate = glimpl_map_windows[i].window + glimpl_map_windows[i].length;
+            candidate = (candidate + GLIMPL_MAP_WINDOW_ALIGNMENT - 1) & ~(size_t)(GLIMPL_MAP_WINDOW_ALIGNMENT - 1);
+        }
+
+        if (candidate + length > region_size)
+            continue;
+
+        for (int j = 0; j < GLIMPL_MAX_MAP_WINDOWS && fits; j++) {
+            struct gl_map_window *other = &glimpl_map_windows[j];
+            if (other->in_use && candidate < other->window + other->length && other->window < candidate + length)
+                fits = false;
+        }
+
+        if (fits) {
+            *free_window = (struct gl_map_window){
+                /* buffer = */  buffer,
+                /* window = */  candidate,
+                /* length = */  length,
+                /* access = */  access,
+                /* in_use = */  true
+            };
+            glimpl_map_window_count++;
+            return free_window;
+        }
+    }
+
+    return NULL;
+}
+
+static void glimpl_map_windows_forget(GLsizei n, const GLuint *buffers)
 {
-    glimpl_upload_buffer(data, size);
-    
-    pb_push(cmd);
-    pb_push(buffer);
-    pb_push(offset);
-    pb_push(size);
+    for (int i = 0; i < GLIMPL_MAX_MAP_WINDOWS && glimpl_map_window_count > 0; i++)
+        for (int j = 0; j < n; j++)
+            if (glimpl_map_windows[i].in_use && glimpl_map_windows[i].buffer == buffers[j] && buffers[j] != 0)
+                glimpl_map_window_free(&glimpl_map_windows[i]);
 }
 
-static void glimpl_buffer_clear_data(int cmd, bool is_subdata, GLenum buffer, GLenum internalformat, GLintptr offset, 
-        GLsizeiptr size, GLenum format, GLenum type, const void* data)
+/*
+ * returns NULL if the mapping has to go through the copy path instead,
+ * which is always the case over the network. the map command must have
+ * been pushed already
+ */
+static void *glimpl_map_window(bool is_named, GLenum buffer, GLsizeiptr length, GLbitfield access)
 {
-    pb_push(cmd);
-    pb_push(buffer);
-    pb_push(internalformat);
+    struct gl_map_window *window;
+    GLuint name;
 
-    if (is_subdata) {
-        pb_push(offset);
-        pb_push(size);
-    }
+    /*
+     * windows are mirrored one way only, either written by the client or
+     * read by it; anything written on both sides would be lost by one
+     */
+    if ((access & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT)) == (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT))
+        return NULL;
 
-    pb_push(format);
-    pb_push(type);
-    pb_push(*(unsigned int*)data); // to-do: technically should look at type first, dont care
-}
+    if (pb_map_region_size() == 0 || (name = glimpl_map_window_buffer(is_named, buffer)) == 0)
+        return NULL;
 
-static void glimpl_get_buffer_parameter(int cmd, GLuint buffer, GLenum pname, GLint* params)
-{
-    pb_push(cmd);
-    pb_push(buffer);
-    pb_push(pname);
+    window = glimpl_map_window_alloc(name, length, access);
+    if (window == NULL)
+        return NULL;
+
+    pb_push(SGL_CMD_VP_MAP_WINDOW);
+    pb_push(name);
+    pb_push(window->window);
+    pb_push(length);
+    pb_push(access);
 
+    /*
+     * the server fills the window with the contents of the buffer, as the
+     * whole window is copied back it must be done before we write to it.
+     * persistent mappings are long lived, so this round trip is rare
+     */
     glimpl_submit();
-    *params = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    if (!pb_read(SGL_OFFSET_REGISTER_RETVAL)) {
+        glimpl_map_window_free(window);
+        return NULL;
+    }
+
+    return (char*)pb_map_region() + window->window;
 }
 
 static void *glimpl_map_buffer_range(int cmd, GLenum buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
+    bool is_named = cmd == SGL_CMD_MAPNAMEDBUFFER || cmd == SGL_CMD_MAPNAMEDBUFFERRANGE;
     bool ranged = true;
+    GLbitfield bits = access;
     // if (glimpl_map_buffer.in_use) {
     //     fprintf(stderr, "glimpl_map_buffer_range: map buffer already in use, returning NULL\n");
     //     return glimpl_map_buffer.mem;
@@ -1080,21 +1918,12 @@ static void *glimpl_map_buffer_range(int cmd, GLenum buffer, GLintptr offset, GL
      * length is 0 when this function is called by glMapBuffer, glMapNamedBuffer
      */
     if (length == 0) {
-        bool is_named = cmd == SGL_CMD_MAPNAMEDBUFFER;
         int get_param_cmd = !is_named ? SGL_CMD_GETBUFFERPARAMETERIV : SGL_CMD_GETNAMEDBUFFERPARAMETERIV;
         glimpl_get_buffer_parameter(get_param_cmd, buffer, GL_BUFFER_SIZE, (GLint*)&length);
         ranged = false;
+        bits = glimpl_map_access_bits(access);
     }
 
-    glimpl_map_buffer = (struct gl_map_buffer){
-        /* target = */  buffer,
-        /* mem = */     scratch_buffer_get(length), // calloc(length, 1), // glimpl_map_buffer.mem,
-        /* offset = */  offset,
-        /* length = */  length,
-        /* access = */  access,
-        /* in_use = */  true
-    };
-
     /*
      * this function supports both glMapBuffer and glMapBufferRange; as such, these functions have
      * different parameters to be pushed
@@ -1111,6 +1940,32 @@ static void *glimpl_map_buffer_range(int cmd, GLenum buffer, GLintptr offset, GL
         pb_push(access);
     }
 
+    if (ranged && (access & GL_MAP_PERSISTENT_BIT)) {
+        void *mem = glimpl_map_window(is_named, buffer, length, access);
+        if (mem != NULL)
+            return mem;
+    }
+
+    glimpl_map_buffer = (struct gl_map_buffer){
+        /* target = */  buffer,
+        /* mem = */     scratch_buffer_get(length), // calloc(length, 1), // glimpl_map_buffer.mem,
+        /* offset = */  offset,
+        /* length = */  length,
+        /* access = */  bits,
+        /* in_use = */  true
+    };
+
+    /*
+     * write only mappings skip the download. the exception is a
+     * mapping that is uploaded whole on unmap, there every byte the
+     * application didn't write must still hold the previous contents,
+     * unless those were invalidated. explicitly flushed mappings only
+     * upload the ranges that were flushed
+     */
+    bool needs_contents = !(bits & (GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+    if (!(bits & GL_MAP_READ_BIT) && !needs_contents)
+        return glimpl_map_buffer.mem;
+
     glimpl_submit();
 
     glimpl_download_buffer(glimpl_map_buffer.mem, length);
@@ -1120,16 +1975,32 @@ static void *glimpl_map_buffer_range(int cmd, GLenum buffer, GLintptr offset, GL
 
 static inline bool glimpl_unmap_buffer(int cmd, int buffer)
 {
-    if (glimpl_map_buffer.target != buffer) {
-        fprintf(stderr, "glimpl_unmap_buffer: target mismatch\n");
-        return GL_FALSE;
+    struct gl_map_window *window = glimpl_map_window_find(cmd == SGL_CMD_UNMAPNAMEDBUFFER, buffer);
+    size_t length = 0;
+
+    if (window != NULL) {
+        pb_push(SGL_CMD_VP_UNMAP_WINDOW);
+        pb_push(window->window);
+        glimpl_map_window_free(window);
     }
+    else {
+        if (glimpl_map_buffer.target != buffer) {
+            fprintf(stderr, "glimpl_unmap_buffer: target mismatch\n");
+            return GL_FALSE;
+        }
 
-    glimpl_upload_buffer(glimpl_map_buffer.mem, glimpl_map_buffer.length);
+        /*
+         * explicitly flushed mappings were uploaded as they were flushed
+         */
+        if ((glimpl_map_buffer.access & GL_MAP_WRITE_BIT) && !(glimpl_map_buffer.access & GL_MAP_FLUSH_EXPLICIT_BIT)) {
+            length = glimpl_map_buffer.length;
+            glimpl_upload_buffer(glimpl_map_buffer.mem, length);
+        }
+    }
 
     pb_push(cmd);
     pb_push(buffer);
-    pb_push(glimpl_map_buffer.length); // internal
+    pb_push(length); // internal
 
     glimpl_submit();
     int res = pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -1138,7 +2009,17 @@ static inline bool glimpl_unmap_buffer(int cmd, int buffer)
 
 static inline void glimpl_flush_mapped_buffer_range(int cmd, int buffer, int offset, int length)
 {
-    glimpl_upload_buffer((char*)glimpl_map_buffer.mem + offset, length);
+    struct gl_map_window *window = glimpl_map_window_find(cmd == SGL_CMD_FLUSHMAPPEDNAMEDBUFFERRANGE, buffer);
+
+    if (window != NULL) {
+        pb_push(SGL_CMD_VP_FLUSH_WINDOW);
+        pb_push(window->window);
+        pb_push(offset);
+        pb_push(length);
+    }
+    else {
+        glimpl_upload_buffer((char*)glimpl_map_buffer.mem + offset, length);
+    }
     
     pb_push(cmd);
     pb_push(buffer);
@@ -1259,37 +2140,46 @@ static void glimpl_get_texture_parameter(int cmd, GLenum texture, GLenum pname,
 
 void glAttachShader(GLuint program, GLuint shader)
 {
-    pb_push(SGL_CMD_ATTACHSHADER);
+    glimpl_push_command(SGL_CMD_ATTACHSHADER);
     pb_push(program);
     pb_push(shader);
 }
 
 void glBegin(GLenum mode) 
 {
-    pb_push(SGL_CMD_BEGIN);
-    pb_push(mode);
+    struct gl_immediate *im = &glimpl_immediate;
+
+    im->begun = true;
+    im->batching = true;
+    im->mode = mode;
+    im->mark = pb_size();
+    im->layout = -1;
+    im->seen = 0;
+    im->count = 0;
 }
 
 void glBeginQuery(GLenum target, GLuint id)
 {
-    pb_push(SGL_CMD_BEGINQUERY);
+    glimpl_push_command(SGL_CMD_BEGINQUERY);
     pb_push(target);
     pb_push(id);
+
+    names_reserve(NAMES_QUERY, id);
 }
 
 void glBindBuffer(GLenum target, GLuint buffer)
 {
-    pb_push(SGL_CMD_BINDBUFFER);
+    glimpl_push_command(SGL_CMD_BINDBUFFER);
     pb_push(target);
     pb_push(buffer);
+
+    state_bind_buffer(target, buffer);
+    names_reserve(NAMES_BUFFER, buffer);
 }
 
 void glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count); /* could be very bad mistake */
-    for (int i = 0; i < count; i++)
-        pb_push(buffers[i]);
+    glimpl_upload_buffer(buffers, count * sizeof(GLuint));
     
     pb_push(SGL_CMD_BINDBUFFERSBASE);
     pb_push(target);
@@ -1299,7 +2189,9 @@ void glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint
 
 void glBindFragDataLocation(GLuint program, GLuint color, const GLchar* name)
 {
-    pb_push(SGL_CMD_BINDFRAGDATALOCATION);
+    if (!glimpl_push_command_sized(SGL_CMD_BINDFRAGDATALOCATION, push_string_size(name)))
+        return;
+
     pb_push(program);
     pb_push(color);
     push_string(name);
@@ -1307,13 +2199,17 @@ void glBindFragDataLocation(GLuint program, GLuint color, const GLchar* name)
 
 void glBindVertexArray(GLuint array)
 {
-    pb_push(SGL_CMD_BINDVERTEXARRAY);
+    glimpl_push_command(SGL_CMD_BINDVERTEXARRAY);
     pb_push(array);
+
+    state_bind_vertex_array(array);
 }
 
 void glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte* bitmap)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    if (!glimpl_push_command_sized(SGL_CMD_VP_UPLOAD, width * height / 4 * sizeof(int)))
+        return;
+
     pb_push(width * height / 4); /* could be very bad mistake */
     for (int i = 0; i < (width * height / 4); i++)
         pb_push(bitmap[i * 4] | bitmap[i * 4 + 1] << 8 | bitmap[i * 4 + 2] << 16 | bitmap[i * 4 + 3] << 24);
@@ -1329,7 +2225,7 @@ void glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLflo
 
 void glBlendFunc(GLenum sfactor, GLenum dfactor)
 {
-    pb_push(SGL_CMD_BLENDFUNC);
+    glimpl_push_command(SGL_CMD_BLENDFUNC);
     pb_push(sfactor);
     pb_push(dfactor);
 }
@@ -1341,28 +2237,42 @@ void glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage
 
 void glCallList(GLuint list)
 {
-    pb_push(SGL_CMD_CALLLIST);
+    glimpl_push_command(SGL_CMD_CALLLIST);
     pb_push(list);
+
+    state_invalidate();
 }
 
 void glClear(GLbitfield mask)
 {
-    pb_push(SGL_CMD_CLEAR);
+    glimpl_push_command(SGL_CMD_CLEAR);
     pb_push(mask);
 }
 
 void glClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
 {
-    pb_push(SGL_CMD_CLEARCOLOR);
+    glimpl_push_command(SGL_CMD_CLEARCOLOR);
     pb_pushf(red);
     pb_pushf(green);
     pb_pushf(blue);
     pb_pushf(alpha);
+
+    /*
+     * whether the server clamps depends on the framebuffer format,
+     * so values outside of [0, 1] are left for the server to answer
+     */
+    if (red >= 0 && red <= 1 && green >= 0 && green <= 1 && blue >= 0 && blue <= 1 && alpha >= 0 && alpha <= 1) {
+        GLfloat color[4] = { red, green, blue, alpha };
+        state_set_floats(GL_COLOR_CLEAR_VALUE, color);
+    }
+    else {
+        state_forget(GL_COLOR_CLEAR_VALUE);
+    }
 }
 
 void glClipPlane(GLenum plane, const GLdouble* equation)
 {
-    pb_push(SGL_CMD_CLIPPLANE);
+    glimpl_push_command(SGL_CMD_CLIPPLANE);
     pb_push(plane);
     pb_pushf(equation[0]);
     pb_pushf(equation[1]);
@@ -1372,7 +2282,7 @@ void glClipPlane(GLenum plane, const GLdouble* equation)
 
 void glClipPlanef(GLenum p, const GLfloat* eqn)
 {
-    pb_push(SGL_CMD_CLIPPLANE);
+    glimpl_push_command(SGL_CMD_CLIPPLANE);
     pb_push(p);
     pb_pushf(eqn[0]);
     pb_pushf(eqn[1]);
@@ -1382,6 +2292,9 @@ void glClipPlanef(GLenum p, const GLfloat* eqn)
 
 void glColor3f(GLfloat red, GLfloat green, GLfloat blue) 
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red, green, blue, 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3F);
     pb_pushf(red);
     pb_pushf(green);
@@ -1390,20 +2303,20 @@ void glColor3f(GLfloat red, GLfloat green, GLfloat blue)
 
 void glCompileShader(GLuint shader)
 {
-    pb_push(SGL_CMD_COMPILESHADER);
+    glimpl_push_command(SGL_CMD_COMPILESHADER);
     pb_push(shader);
 }
 
 GLuint glCreateProgram()
 {
-    pb_push(SGL_CMD_CREATEPROGRAM);
+    glimpl_push_command(SGL_CMD_CREATEPROGRAM);
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
 }
 
 GLuint glCreateShader(GLenum type)
 {
-    pb_push(SGL_CMD_CREATESHADER);
+    glimpl_push_command(SGL_CMD_CREATESHADER);
     pb_push(type);
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -1412,61 +2325,75 @@ GLuint glCreateShader(GLenum type)
 void glDeleteBuffers(GLsizei n, const GLuint* buffers)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEBUFFERS);
+        glimpl_push_command(SGL_CMD_DELETEBUFFERS);
         pb_push(buffers[i]);
+        names_free(NAMES_BUFFER, buffers[i]);
     }
+
+    glimpl_map_windows_forget(n, buffers);
+    state_delete_buffers(n, buffers);
 }
 
 void glDeleteTextures(GLsizei n, const GLuint* textures)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETETEXTURES);
+        glimpl_push_command(SGL_CMD_DELETETEXTURES);
         pb_push(textures[i]);
+        names_free(NAMES_TEXTURE, textures[i]);
     }
+
+    state_delete_textures(n, textures);
 }
 
 void glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEVERTEXARRAYS);
+        glimpl_push_command(SGL_CMD_DELETEVERTEXARRAYS);
         pb_push(arrays[i]);
+        names_free(NAMES_VERTEX_ARRAY, arrays[i]);
     }
+
+    state_delete_vertex_arrays(n, arrays);
 }
 
 void glDepthFunc(GLenum func) 
 {
-    pb_push(SGL_CMD_DEPTHFUNC);
+    glimpl_push_command(SGL_CMD_DEPTHFUNC);
     pb_push(func);
 }
 
 void glDeleteProgram(GLuint program)
 {
+    locations_forget(program);
+
     pb_push(SGL_CMD_DELETEPROGRAM);
     pb_push(program);
 }
 
 void glDeleteShader(GLuint shader)
 {
-    pb_push(SGL_CMD_DELETESHADER);
+    glimpl_push_command(SGL_CMD_DELETESHADER);
     pb_push(shader);
 }
 
 void glDetachShader(GLuint program, GLuint shader)
 {
-    pb_push(SGL_CMD_DETACHSHADER);
+    glimpl_push_command(SGL_CMD_DETACHSHADER);
     pb_push(program);
     pb_push(shader);
 }
 
 void glDisable(GLenum cap)
 {
-    pb_push(SGL_CMD_DISABLE);
+    glimpl_push_command(SGL_CMD_DISABLE);
     pb_push(cap);
+
+    state_enable(cap, false);
 }
 
 void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
 {
-    pb_push(SGL_CMD_DISPATCHCOMPUTE);
+    glimpl_push_command(SGL_CMD_DISPATCHCOMPUTE);
     pb_push(num_groups_x);
     pb_push(num_groups_y);
     pb_push(num_groups_z);
@@ -1474,8 +2401,8 @@ void glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_grou
 
 void glDrawArrays(GLenum mode, GLint first, GLsizei count)
 {
-    glimpl_push_vertex_attrib_pointers(count);
-    glimpl_push_client_pointers(mode, count);
+    bool staged = glimpl_push_vertex_attrib_pointers(0, first + count, 0);
+    glimpl_push_client_pointers(mode, 0, first + count, staged);
 
     pb_push(SGL_CMD_DRAWARRAYS);
     pb_push(mode);
@@ -1487,7 +2414,7 @@ void glDrawArrays(GLenum mode, GLint first, GLsizei count)
 
 void glDrawBuffer(GLenum buf)
 {
-    pb_push(SGL_CMD_DRAWBUFFER);
+    glimpl_push_command(SGL_CMD_DRAWBUFFER);
     pb_push(buf);
 }
 
@@ -1497,22 +2424,20 @@ void glDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices
      * to-do: check if mode and type is valid
      */
 
-    glimpl_draw_elements(mode, type, 0, count, indices);
+    glimpl_draw_elements(mode, type, count, indices, false, 0, 0);
 }
 
 void glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
 {
-    /*
-     * count is ignored?
-     */
-
-    glimpl_draw_elements(mode, type, start, end, indices);
+    glimpl_draw_elements(mode, type, count, indices, true, start, end);
 }
 
 void glEnable(GLenum cap)
 {
-    pb_push(SGL_CMD_ENABLE);
+    glimpl_push_command(SGL_CMD_ENABLE);
     pb_push(cap);
+
+    state_enable(cap, true);
 }
 
 void glEnableVertexAttribArray(GLuint index)
@@ -1527,60 +2452,75 @@ void glEnableVertexAttribArray(GLuint index)
 
 void glEnd(void) 
 {
-    pb_push(SGL_CMD_END);
+    struct gl_immediate *im = &glimpl_immediate;
+
+    if (!im->begun || !glimpl_immediate_batching()) {
+        im->begun = false;
+        pb_push(SGL_CMD_END);
+        return;
+    }
+
+    im->begun = false;
+    im->batching = false;
+
+    if (im->count) {
+        glimpl_upload_buffer(im->vertices, im->count * glimpl_immediate_stride(im->layout) * sizeof(float));
+        pb_push(SGL_CMD_VP_DRAW_IMMEDIATE);
+        pb_push(im->mode);
+        pb_push(im->count);
+        pb_push(im->layout);
+    }
+
+    glimpl_immediate_push_current();
 }
 
 void glEndList(void)
 {
-    pb_push(SGL_CMD_ENDLIST);
+    glimpl_push_command(SGL_CMD_ENDLIST);
+
+    state_end_list();
 }
 
 void glEndQuery(GLenum target)
 {
-    pb_push(SGL_CMD_ENDQUERY);
+    glimpl_push_command(SGL_CMD_ENDQUERY);
     pb_push(target);   
 }
 
 void glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
 {
-    pb_push(SGL_CMD_FRUSTUM);
+    glimpl_push_command(SGL_CMD_FRUSTUM);
     pb_pushf(left);
     pb_pushf(right);
     pb_pushf(bottom);
     pb_pushf(top);
     pb_pushf(zNear);
     pb_pushf(zFar);
+
+    state_frustum(left, right, bottom, top, zNear, zFar);
 }
 
 void glGenBuffers(GLsizei n, GLuint* buffers)
 {
-    GLuint *p = buffers;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENBUFFERS);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        buffers[i] = names_alloc(NAMES_BUFFER);
+        glimpl_push_command(SGL_CMD_GENBUFFERS);
+        pb_push(buffers[i]);
     }
 }
 
 void glGenFramebuffers(GLsizei n, GLuint* framebuffers)
 {
-    GLuint *p = framebuffers;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENFRAMEBUFFERS);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        framebuffers[i] = names_alloc(NAMES_FRAMEBUFFER);
+        glimpl_push_command(SGL_CMD_GENFRAMEBUFFERS);
+        pb_push(framebuffers[i]);
     }
 }
 
 GLuint glGenLists(GLsizei range)
 {
-    pb_push(SGL_CMD_GENLISTS);
+    glimpl_push_command(SGL_CMD_GENLISTS);
     pb_push(range);
 
     glimpl_submit();
@@ -1589,46 +2529,34 @@ GLuint glGenLists(GLsizei range)
 
 void glGenQueries(GLsizei n, GLuint* ids)
 {
-    GLuint *p = ids;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENQUERIES);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        ids[i] = names_alloc(NAMES_QUERY);
+        glimpl_push_command(SGL_CMD_GENQUERIES);
+        pb_push(ids[i]);
     }
 }
 
 void glGenTextures(GLsizei n, GLuint* textures)
 {
-    GLuint *p = textures;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENTEXTURES);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        textures[i] = names_alloc(NAMES_TEXTURE);
+        glimpl_push_command(SGL_CMD_GENTEXTURES);
+        pb_push(textures[i]);
     }
 }
 
 void glGenVertexArrays(GLsizei n, GLuint* arrays)
 {
-    GLuint *p = arrays;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENVERTEXARRAYS);
-        pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        arrays[i] = names_alloc(NAMES_VERTEX_ARRAY);
+        glimpl_push_command(SGL_CMD_GENVERTEXARRAYS);
+        pb_push(arrays[i]);
     }
 }
 
 void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 {
-    pb_push(SGL_CMD_GETQUERYOBJECTUI64V);
+    glimpl_push_command(SGL_CMD_GETQUERYOBJECTUI64V);
     pb_push(id);
     pb_push(pname);
 
@@ -1638,7 +2566,7 @@ void glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
 
 void glGetProgramiv(GLuint program, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMIV);
+    glimpl_push_command(SGL_CMD_GETPROGRAMIV);
     pb_push(program);
     pb_push(pname);
 
@@ -1648,7 +2576,7 @@ void glGetProgramiv(GLuint program, GLenum pname, GLint* params)
 
 void glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETSHADERIV);
+    glimpl_push_command(SGL_CMD_GETSHADERIV);
     pb_push(shader);
     pb_push(pname);
 
@@ -1658,7 +2586,7 @@ void glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
 
 void glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params)
 {
-    pb_push(SGL_CMD_GETOBJECTPARAMETERIVARB);
+    glimpl_push_command(SGL_CMD_GETOBJECTPARAMETERIVARB);
     pb_push(obj);
     pb_push(pname);
 
@@ -1727,30 +2655,24 @@ const GLubyte *glGetStringi(GLenum name, GLuint index)
 
 GLint glGetUniformLocation(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETUNIFORMLOCATION);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETUNIFORMLOCATION, LOCATION_UNIFORM, program, name);
 }
 
 GLint glGetAttribLocation(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETATTRIBLOCATION);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETATTRIBLOCATION, LOCATION_ATTRIB, program, name);
 }
 
 void glGetFloatv(GLenum pname, GLfloat* data)
 {
+    if (state_get_floats(pname, data))
+        return;
+
     pb_push(SGL_CMD_GETFLOATV);
     pb_push(pname);
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL(data, float);
+    state_cache_floats(pname, data);
 }
 
 void glGetIntegerv(GLenum pname, GLint* data)
@@ -1771,14 +2693,21 @@ void glGetIntegerv(GLenum pname, GLint* data)
         return;
     }
 
+    if (state_get_integers(pname, data))
+        return;
+
     pb_push(SGL_CMD_GETINTEGERV);
     pb_push(pname);
     glimpl_submit();
     GL_GET_MEMCPY_RETVAL(data, int);
+    state_cache_integers(pname, data);
 }
 
 void glGetBooleanv(GLenum pname, GLboolean* data)
 {
+    if (state_get_booleans(pname, data))
+        return;
+
     pb_push(SGL_CMD_GETBOOLEANV);
     pb_push(pname);
     glimpl_submit();
@@ -1787,6 +2716,9 @@ void glGetBooleanv(GLenum pname, GLboolean* data)
 
 void glGetDoublev(GLenum pname, GLdouble* data)
 {
+    if (state_get_doubles(pname, data))
+        return;
+
     pb_push(SGL_CMD_GETDOUBLEV);
     pb_push(pname);
     glimpl_submit();
@@ -1835,7 +2767,7 @@ void glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void*
 
 void glLightModelfv(GLenum pname, const GLfloat* params)
 {
-    pb_push(SGL_CMD_LIGHTMODELFV);
+    glimpl_push_command(SGL_CMD_LIGHTMODELFV);
     pb_push(pname);
     pb_pushf(params[0]);
     pb_pushf(params[1]); // to-do: check if this is causing an issues (overreading)
@@ -1845,7 +2777,7 @@ void glLightModelfv(GLenum pname, const GLfloat* params)
 
 void glLightfv(GLenum light, GLenum pname, const GLfloat* params)
 {
-    pb_push(SGL_CMD_LIGHTFV);
+    glimpl_push_command(SGL_CMD_LIGHTFV);
     pb_push(light);
     pb_push(pname);
     pb_pushf(params[0]);
@@ -1856,18 +2788,22 @@ void glLightfv(GLenum light, GLenum pname, const GLfloat* params)
 
 void glLinkProgram(GLuint program)
 {
+    locations_forget(program);
+
     pb_push(SGL_CMD_LINKPROGRAM);
     pb_push(program);
 }
 
 void glLoadIdentity(void)
 {
-    pb_push(SGL_CMD_LOADIDENTITY);
+    glimpl_push_command(SGL_CMD_LOADIDENTITY);
+
+    state_load_identity();
 }
 
 void glMaterialfv(GLenum face, GLenum pname, const GLfloat* params)
 {
-    pb_push(SGL_CMD_MATERIALFV);
+    glimpl_push_command(SGL_CMD_MATERIALFV);
     pb_push(face);
     pb_push(pname);
     pb_pushf(params[0]);
@@ -1878,19 +2814,26 @@ void glMaterialfv(GLenum face, GLenum pname, const GLfloat* params)
 
 void glMatrixMode(GLenum mode)
 {
-    pb_push(SGL_CMD_MATRIXMODE);
+    glimpl_push_command(SGL_CMD_MATRIXMODE);
     pb_push(mode);
+
+    state_matrix_mode(mode);
 }
 
 void glNewList(GLuint list, GLenum mode)
 {
-    pb_push(SGL_CMD_NEWLIST);
+    glimpl_push_command(SGL_CMD_NEWLIST);
     pb_push(list);
     pb_push(mode);
+
+    state_new_list(mode);
 }
 
 void glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, nx, ny, nz, 0.0f))
+        return;
+
     pb_push(SGL_CMD_NORMAL3F);
     pb_pushf(nx);
     pb_pushf(ny);
@@ -1899,32 +2842,44 @@ void glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 
 void glPopMatrix(void)
 {
-    pb_push(SGL_CMD_POPMATRIX);
+    glimpl_push_command(SGL_CMD_POPMATRIX);
+
+    state_pop_matrix();
 }
 
 void glPushMatrix(void)
 {
-    pb_push(SGL_CMD_PUSHMATRIX);
+    glimpl_push_command(SGL_CMD_PUSHMATRIX);
+
+    state_push_matrix();
 }
 
 void glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_ROTATEF);
+    glimpl_push_command(SGL_CMD_ROTATEF);
     pb_pushf(angle);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
+
+    state_rotate(angle, x, y, z);
 }
 
 void glShadeModel(GLenum mode)
 {
-    pb_push(SGL_CMD_SHADEMODEL);
+    glimpl_push_command(SGL_CMD_SHADEMODEL);
     pb_push(mode);
 }
 
 void glShaderSource(GLuint shader, GLsizei count, const GLchar** string, const GLint* length)
 {
-    pb_push(SGL_CMD_SHADERSOURCE);
+    size_t size = 0;
+    for (int i = 0; i < count; i++)
+        size += push_string_size(string[i]);
+
+    if (!glimpl_push_command_sized(SGL_CMD_SHADERSOURCE, size))
+        return;
+
     pb_push(shader);
     pb_push(count);
 
@@ -1972,33 +2927,34 @@ void glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, G
 
 void glTranslated(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_TRANSLATED);
+    glimpl_push_command(SGL_CMD_TRANSLATED);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
+
+    state_translate(x, y, z);
 }
 
 void glTranslatef(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_TRANSLATEF);
+    glimpl_push_command(SGL_CMD_TRANSLATEF);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
+
+    state_translate(x, y, z);
 }
 
 void glUniform1f(GLint location, GLfloat v0)
 {
-    pb_push(SGL_CMD_UNIFORM1F);
+    glimpl_push_command(SGL_CMD_UNIFORM1F);
     pb_push(location);
     pb_pushf(v0);
 }
 
 void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 4);
-    for (int i = 0; i < count * 4 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 4 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX4FV);
     pb_push(location);
@@ -2008,12 +2964,17 @@ void glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, cons
 
 void glUseProgram(GLuint program)
 {
-    pb_push(SGL_CMD_USEPROGRAM);
+    glimpl_push_command(SGL_CMD_USEPROGRAM);
     pb_push(program);
+
+    state_set_integers(GL_CURRENT_PROGRAM, (GLint*)&program);
 }
 
 void glVertex3f(GLfloat x, GLfloat y, GLfloat z) 
 {
+    if (glimpl_immediate_vertex(x, y, z, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX3F);
     pb_pushf(x);
     pb_pushf(y);
@@ -2031,7 +2992,7 @@ void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean norm
         .normalized = normalized,
         .stride = stride,
         .ptr = (void*)pointer,
-        .enabled = false,
+        .enabled = glimpl_vaps[index].enabled,
         .client_managed = client_managed
     };
 
@@ -2048,40 +3009,64 @@ void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean norm
 
 void glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_VIEWPORT);
+    glimpl_push_command(SGL_CMD_VIEWPORT);
     pb_push(x);
     pb_push(y);
     pb_push(width);
     pb_push(height);
     icd_resize(width, height);
+
+    /*
+     * the server clamps the viewport to GL_MAX_VIEWPORT_DIMS and
+     * GL_VIEWPORT_BOUNDS_RANGE, so only remember ones that can't
+     * have been clamped
+     */
+    if (width >= 0 && height >= 0 && width <= 4096 && height <= 4096 && x >= -4096 && x <= 4096 && y >= -4096 && y <= 4096) {
+        GLint viewport[4] = { x, y, width, height };
+        state_set_integers(GL_VIEWPORT, viewport);
+    }
 }
 
 void glMultMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_MULTMATRIXF);
+    glimpl_push_command(SGL_CMD_MULTMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    GLfloat mf[16];
+    for (int i = 0; i < 16; i++)
+        mf[i] = m[i];
+    state_mult_matrix(mf);
 }
 
 void glMultMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_MULTMATRIXF);
+    glimpl_push_command(SGL_CMD_MULTMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    state_mult_matrix(m);
 }
 
 void glLoadMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_LOADMATRIXF);
+    glimpl_push_command(SGL_CMD_LOADMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    GLfloat mf[16];
+    for (int i = 0; i < 16; i++)
+        mf[i] = m[i];
+    state_load_matrix(mf);
 }
 
 void glLoadMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_LOADMATRIXF);
+    glimpl_push_command(SGL_CMD_LOADMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    state_load_matrix(m);
 }
 
 void glColorPointer(GLint size, GLenum type, GLsizei stride, const void* pointer)
@@ -2179,45 +3164,45 @@ void glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void
 
 void glCullFace(GLenum mode)
 {
-    pb_push(SGL_CMD_CULLFACE);
+    glimpl_push_command(SGL_CMD_CULLFACE);
     pb_push(mode);
 }
 
 void glFrontFace(GLenum mode)
 {
-    pb_push(SGL_CMD_FRONTFACE);
+    glimpl_push_command(SGL_CMD_FRONTFACE);
     pb_push(mode);
 }
 
 void glHint(GLenum target, GLenum mode)
 {
-    pb_push(SGL_CMD_HINT);
+    glimpl_push_command(SGL_CMD_HINT);
     pb_push(target);
     pb_push(mode);
 }
 
 void glLineWidth(GLfloat width)
 {
-    pb_push(SGL_CMD_LINEWIDTH);
+    glimpl_push_command(SGL_CMD_LINEWIDTH);
     pb_pushf(width);
 }
 
 void glPointSize(GLfloat size)
 {
-    pb_push(SGL_CMD_POINTSIZE);
+    glimpl_push_command(SGL_CMD_POINTSIZE);
     pb_pushf(size);
 }
 
 void glPolygonMode(GLenum face, GLenum mode)
 {
-    pb_push(SGL_CMD_POLYGONMODE);
+    glimpl_push_command(SGL_CMD_POLYGONMODE);
     pb_push(face);
     pb_push(mode);
 }
 
 void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_SCISSOR);
+    glimpl_push_command(SGL_CMD_SCISSOR);
     pb_push(x);
     pb_push(y);
     pb_push(width);
@@ -2228,11 +3213,16 @@ void glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
      */
     if (x == 0 && y == 0 && width > 64 && height > 64)
         icd_resize(width, height);
+
+    if (width >= 0 && height >= 0) {
+        GLint box[4] = { x, y, width, height };
+        state_set_integers(GL_SCISSOR_BOX, box);
+    }
 }
 
 void glTexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXPARAMETERF);
+    glimpl_push_command(SGL_CMD_TEXPARAMETERF);
     pb_push(target);
     pb_push(pname);
     pb_pushf(param);
@@ -2240,7 +3230,7 @@ void glTexParameterf(GLenum target, GLenum pname, GLfloat param)
 
 void glTexParameteri(GLenum target, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXPARAMETERI);
+    glimpl_push_command(SGL_CMD_TEXPARAMETERI);
     pb_push(target);
     pb_push(pname);
     pb_push(param);
@@ -2248,25 +3238,30 @@ void glTexParameteri(GLenum target, GLenum pname, GLint param)
 
 void glClearStencil(GLint s)
 {
-    pb_push(SGL_CMD_CLEARSTENCIL);
+    glimpl_push_command(SGL_CMD_CLEARSTENCIL);
     pb_push(s);
+
+    state_set_integers(GL_STENCIL_CLEAR_VALUE, &s);
 }
 
 void glClearDepth(GLdouble depth)
 {
-    pb_push(SGL_CMD_CLEARDEPTH);
+    glimpl_push_command(SGL_CMD_CLEARDEPTH);
     pb_pushf(depth);
+
+    GLfloat clamped = depth < 0 ? 0 : depth > 1 ? 1 : depth;
+    state_set_floats(GL_DEPTH_CLEAR_VALUE, &clamped);
 }
 
 void glStencilMask(GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILMASK);
+    glimpl_push_command(SGL_CMD_STENCILMASK);
     pb_push(mask);
 }
 
 void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
-    pb_push(SGL_CMD_COLORMASK);
+    glimpl_push_command(SGL_CMD_COLORMASK);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -2275,29 +3270,29 @@ void glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha
 
 void glDepthMask(GLboolean flag)
 {
-    pb_push(SGL_CMD_DEPTHMASK);
+    glimpl_push_command(SGL_CMD_DEPTHMASK);
     pb_push(flag);
 }
 
 void glFinish(void)
 {
-    pb_push(SGL_CMD_FINISH);
+    glimpl_push_command(SGL_CMD_FINISH);
 }
 
 void glFlush(void)
 {
-    pb_push(SGL_CMD_FLUSH);
+    glimpl_push_command(SGL_CMD_FLUSH);
 }
 
 void glLogicOp(GLenum opcode)
 {
-    pb_push(SGL_CMD_LOGICOP);
+    glimpl_push_command(SGL_CMD_LOGICOP);
     pb_push(opcode);
 }
 
 void glStencilFunc(GLenum func, GLint ref, GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILFUNC);
+    glimpl_push_command(SGL_CMD_STENCILFUNC);
     pb_push(func);
     pb_push(ref);
     pb_push(mask);
@@ -2305,7 +3300,7 @@ void glStencilFunc(GLenum func, GLint ref, GLuint mask)
 
 void glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
-    pb_push(SGL_CMD_STENCILOP);
+    glimpl_push_command(SGL_CMD_STENCILOP);
     pb_push(fail);
     pb_push(zfail);
     pb_push(zpass);
@@ -2313,27 +3308,30 @@ void glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
 void glPixelStoref(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_PIXELSTOREF);
+    glimpl_push_command(SGL_CMD_PIXELSTOREF);
     pb_push(pname);
     pb_pushf(param);
 }
 
 void glPixelStorei(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_PIXELSTOREI);
+    glimpl_push_command(SGL_CMD_PIXELSTOREI);
     pb_push(pname);
     pb_push(param);
 }
 
 void glReadBuffer(GLenum src)
 {
-    pb_push(SGL_CMD_READBUFFER);
+    glimpl_push_command(SGL_CMD_READBUFFER);
     pb_push(src);
 }
 
 GLenum glGetError(void)
 {
-    return GL_NO_ERROR;
+    glimpl_push_command(SGL_CMD_GETERROR);
+
+    glimpl_submit();
+    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
 }
 
 void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
@@ -2343,36 +3341,42 @@ void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format
 
 GLboolean glIsEnabled(GLenum cap)
 {
+    GLboolean enabled;
+    if (state_is_enabled(cap, &enabled))
+        return enabled;
+
     pb_push(SGL_CMD_ISENABLED);
     pb_push(cap);
     
     glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    enabled = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    state_cache_enabled(cap, enabled);
+    return enabled;
 }
 
 void glDepthRange(GLdouble n, GLdouble f)
 {
-    pb_push(SGL_CMD_DEPTHRANGE);
+    glimpl_push_command(SGL_CMD_DEPTHRANGE);
     pb_pushf(n);
     pb_pushf(f);
 }
 
 void glDeleteLists(GLuint list, GLsizei range)
 {
-    pb_push(SGL_CMD_DELETELISTS);
+    glimpl_push_command(SGL_CMD_DELETELISTS);
     pb_push(list);
     pb_push(range);
 }
 
 void glListBase(GLuint base)
 {
-    pb_push(SGL_CMD_LISTBASE);
+    glimpl_push_command(SGL_CMD_LISTBASE);
     pb_push(base);
 }
 
 void glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXIMAGE2DMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_TEXIMAGE2DMULTISAMPLE);
     pb_push(target);
     pb_push(samples);
     pb_push(internalformat);
@@ -2383,6 +3387,9 @@ void glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalform
 
 void glColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, GLIMPL_SNORM8(red), GLIMPL_SNORM8(green), GLIMPL_SNORM8(blue), 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3B);
     pb_push(red);
     pb_push(green);
@@ -2391,6 +3398,9 @@ void glColor3b(GLbyte red, GLbyte green, GLbyte blue)
 
 void glColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red, green, blue, 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3D);
     pb_pushf(red);
     pb_pushf(green);
@@ -2399,6 +3409,9 @@ void glColor3d(GLdouble red, GLdouble green, GLdouble blue)
 
 void glColor3i(GLint red, GLint green, GLint blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, GLIMPL_SNORM32(red), GLIMPL_SNORM32(green), GLIMPL_SNORM32(blue), 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3I);
     pb_push(red);
     pb_push(green);
@@ -2407,6 +3420,9 @@ void glColor3i(GLint red, GLint green, GLint blue)
 
 void glColor3s(GLshort red, GLshort green, GLshort blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, GLIMPL_SNORM16(red), GLIMPL_SNORM16(green), GLIMPL_SNORM16(blue), 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3S);
     pb_push(red);
     pb_push(green);
@@ -2415,6 +3431,9 @@ void glColor3s(GLshort red, GLshort green, GLshort blue)
 
 void glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red / 255.0f, green / 255.0f, blue / 255.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3UB);
     pb_push(red);
     pb_push(green);
@@ -2423,6 +3442,9 @@ void glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 
 void glColor3ui(GLuint red, GLuint green, GLuint blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red / 4294967295.0f, green / 4294967295.0f, blue / 4294967295.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3UI);
     pb_push(red);
     pb_push(green);
@@ -2431,6 +3453,9 @@ void glColor3ui(GLuint red, GLuint green, GLuint blue)
 
 void glColor3us(GLushort red, GLushort green, GLushort blue)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red / 65535.0f, green / 65535.0f, blue / 65535.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR3US);
     pb_push(red);
     pb_push(green);
@@ -2439,6 +3464,9 @@ void glColor3us(GLushort red, GLushort green, GLushort blue)
 
 void glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, GLIMPL_SNORM8(red), GLIMPL_SNORM8(green), GLIMPL_SNORM8(blue), GLIMPL_SNORM8(alpha)))
+        return;
+
     pb_push(SGL_CMD_COLOR4B);
     pb_push(red);
     pb_push(green);
@@ -2448,6 +3476,9 @@ void glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
 
 void glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red, green, blue, alpha))
+        return;
+
     pb_push(SGL_CMD_COLOR4D);
     pb_pushf(red);
     pb_pushf(green);
@@ -2457,6 +3488,9 @@ void glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
 
 void glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red, green, blue, alpha))
+        return;
+
     pb_push(SGL_CMD_COLOR4F);
     pb_pushf(red);
     pb_pushf(green);
@@ -2466,6 +3500,9 @@ void glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 
 void glColor4fv(const GLfloat* v)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, v[0], v[1], v[2], v[3]))
+        return;
+
     pb_push(SGL_CMD_COLOR4F);
     pb_pushf(v[0]);
     pb_pushf(v[1]);
@@ -2475,6 +3512,9 @@ void glColor4fv(const GLfloat* v)
 
 void glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, GLIMPL_SNORM32(red), GLIMPL_SNORM32(green), GLIMPL_SNORM32(blue), GLIMPL_SNORM32(alpha)))
+        return;
+
     pb_push(SGL_CMD_COLOR4I);
     pb_push(red);
     pb_push(green);
@@ -2484,6 +3524,9 @@ void glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
 
 void glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, GLIMPL_SNORM16(red), GLIMPL_SNORM16(green), GLIMPL_SNORM16(blue), GLIMPL_SNORM16(alpha)))
+        return;
+
     pb_push(SGL_CMD_COLOR4S);
     pb_push(red);
     pb_push(green);
@@ -2493,6 +3536,9 @@ void glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
 
 void glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red / 255.0f, green / 255.0f, blue / 255.0f, alpha / 255.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR4UB);
     pb_push(red);
     pb_push(green);
@@ -2502,6 +3548,9 @@ void glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
 
 void glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red / 4294967295.0f, green / 4294967295.0f, blue / 4294967295.0f, alpha / 4294967295.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR4UI);
     pb_push(red);
     pb_push(green);
@@ -2511,6 +3560,9 @@ void glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
 
 void glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_COLOR, red / 65535.0f, green / 65535.0f, blue / 65535.0f, alpha / 65535.0f))
+        return;
+
     pb_push(SGL_CMD_COLOR4US);
     pb_push(red);
     pb_push(green);
@@ -2520,36 +3572,39 @@ void glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
 
 void glEdgeFlag(GLboolean flag)
 {
-    pb_push(SGL_CMD_EDGEFLAG);
+    glimpl_push_command(SGL_CMD_EDGEFLAG);
     pb_push(flag);
 }
 
 void glIndexd(GLdouble c)
 {
-    pb_push(SGL_CMD_INDEXD);
+    glimpl_push_command(SGL_CMD_INDEXD);
     pb_pushf(c);
 }
 
 void glIndexf(GLfloat c)
 {
-    pb_push(SGL_CMD_INDEXF);
+    glimpl_push_command(SGL_CMD_INDEXF);
     pb_pushf(c);
 }
 
 void glIndexi(GLint c)
 {
-    pb_push(SGL_CMD_INDEXI);
+    glimpl_push_command(SGL_CMD_INDEXI);
     pb_push(c);
 }
 
 void glIndexs(GLshort c)
 {
-    pb_push(SGL_CMD_INDEXS);
+    glimpl_push_command(SGL_CMD_INDEXS);
     pb_push(c);
 }
 
 void glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, GLIMPL_SNORM8(nx), GLIMPL_SNORM8(ny), GLIMPL_SNORM8(nz), 0.0f))
+        return;
+
     pb_push(SGL_CMD_NORMAL3B);
     pb_push(nx);
     pb_push(ny);
@@ -2558,6 +3613,9 @@ void glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
 
 void glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, nx, ny, nz, 0.0f))
+        return;
+
     pb_push(SGL_CMD_NORMAL3D);
     pb_pushf(nx);
     pb_pushf(ny);
@@ -2566,6 +3624,9 @@ void glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
 
 void glNormal3i(GLint nx, GLint ny, GLint nz)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, GLIMPL_SNORM32(nx), GLIMPL_SNORM32(ny), GLIMPL_SNORM32(nz), 0.0f))
+        return;
+
     pb_push(SGL_CMD_NORMAL3I);
     pb_push(nx);
     pb_push(ny);
@@ -2574,6 +3635,9 @@ void glNormal3i(GLint nx, GLint ny, GLint nz)
 
 void glNormal3s(GLshort nx, GLshort ny, GLshort nz)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_NORMAL, GLIMPL_SNORM16(nx), GLIMPL_SNORM16(ny), GLIMPL_SNORM16(nz), 0.0f))
+        return;
+
     pb_push(SGL_CMD_NORMAL3S);
     pb_push(nx);
     pb_push(ny);
@@ -2582,35 +3646,35 @@ void glNormal3s(GLshort nx, GLshort ny, GLshort nz)
 
 void glRasterPos2d(GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_RASTERPOS2D);
+    glimpl_push_command(SGL_CMD_RASTERPOS2D);
     pb_pushf(x);
     pb_pushf(y);
 }
 
 void glRasterPos2f(GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_RASTERPOS2F);
+    glimpl_push_command(SGL_CMD_RASTERPOS2F);
     pb_pushf(x);
     pb_pushf(y);
 }
 
 void glRasterPos2i(GLint x, GLint y)
 {
-    pb_push(SGL_CMD_RASTERPOS2I);
+    glimpl_push_command(SGL_CMD_RASTERPOS2I);
     pb_push(x);
     pb_push(y);
 }
 
 void glRasterPos2s(GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_RASTERPOS2S);
+    glimpl_push_command(SGL_CMD_RASTERPOS2S);
     pb_push(x);
     pb_push(y);
 }
 
 void glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_RASTERPOS3D);
+    glimpl_push_command(SGL_CMD_RASTERPOS3D);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
@@ -2618,7 +3682,7 @@ void glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
 
 void glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_RASTERPOS3F);
+    glimpl_push_command(SGL_CMD_RASTERPOS3F);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
@@ -2626,7 +3690,7 @@ void glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
 
 void glRasterPos3i(GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_RASTERPOS3I);
+    glimpl_push_command(SGL_CMD_RASTERPOS3I);
     pb_push(x);
     pb_push(y);
     pb_push(z);
@@ -2634,7 +3698,7 @@ void glRasterPos3i(GLint x, GLint y, GLint z)
 
 void glRasterPos3s(GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_RASTERPOS3S);
+    glimpl_push_command(SGL_CMD_RASTERPOS3S);
     pb_push(x);
     pb_push(y);
     pb_push(z);
@@ -2642,7 +3706,7 @@ void glRasterPos3s(GLshort x, GLshort y, GLshort z)
 
 void glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_RASTERPOS4D);
+    glimpl_push_command(SGL_CMD_RASTERPOS4D);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
@@ -2651,7 +3715,7 @@ void glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
 void glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
-    pb_push(SGL_CMD_RASTERPOS4F);
+    glimpl_push_command(SGL_CMD_RASTERPOS4F);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
@@ -2660,7 +3724,7 @@ void glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
 void glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
 {
-    pb_push(SGL_CMD_RASTERPOS4I);
+    glimpl_push_command(SGL_CMD_RASTERPOS4I);
     pb_push(x);
     pb_push(y);
     pb_push(z);
@@ -2669,7 +3733,7 @@ void glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
 
 void glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
 {
-    pb_push(SGL_CMD_RASTERPOS4S);
+    glimpl_push_command(SGL_CMD_RASTERPOS4S);
     pb_push(x);
     pb_push(y);
     pb_push(z);
@@ -2678,7 +3742,7 @@ void glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
 
 void glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 {
-    pb_push(SGL_CMD_RECTD);
+    glimpl_push_command(SGL_CMD_RECTD);
     pb_pushf(x1);
     pb_pushf(y1);
     pb_pushf(x2);
@@ -2687,7 +3751,7 @@ void glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 
 void glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
 {
-    pb_push(SGL_CMD_RECTF);
+    glimpl_push_command(SGL_CMD_RECTF);
     pb_pushf(x1);
     pb_pushf(y1);
     pb_pushf(x2);
@@ -2696,7 +3760,7 @@ void glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
 
 void glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
 {
-    pb_push(SGL_CMD_RECTI);
+    glimpl_push_command(SGL_CMD_RECTI);
     pb_push(x1);
     pb_push(y1);
     pb_push(x2);
@@ -2705,7 +3769,7 @@ void glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
 
 void glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
 {
-    pb_push(SGL_CMD_RECTS);
+    glimpl_push_command(SGL_CMD_RECTS);
     pb_push(x1);
     pb_push(y1);
     pb_push(x2);
@@ -2714,30 +3778,45 @@ void glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
 
 void glTexCoord1d(GLdouble s)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, 0.0f, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD1D);
     pb_pushf(s);
 }
 
 void glTexCoord1f(GLfloat s)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, 0.0f, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD1F);
     pb_pushf(s);
 }
 
 void glTexCoord1i(GLint s)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, 0.0f, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD1I);
     pb_push(s);
 }
 
 void glTexCoord1s(GLshort s)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, 0.0f, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD1S);
     pb_push(s);
 }
 
 void glTexCoord2d(GLdouble s, GLdouble t)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD2D);
     pb_pushf(s);
     pb_pushf(t);
@@ -2745,6 +3824,9 @@ void glTexCoord2d(GLdouble s, GLdouble t)
 
 void glTexCoord2f(GLfloat s, GLfloat t)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD2F);
     pb_pushf(s);
     pb_pushf(t);
@@ -2752,6 +3834,9 @@ void glTexCoord2f(GLfloat s, GLfloat t)
 
 void glTexCoord2i(GLint s, GLint t)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD2I);
     pb_push(s);
     pb_push(t);
@@ -2759,6 +3844,9 @@ void glTexCoord2i(GLint s, GLint t)
 
 void glTexCoord2s(GLshort s, GLshort t)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD2S);
     pb_push(s);
     pb_push(t);
@@ -2766,6 +3854,9 @@ void glTexCoord2s(GLshort s, GLshort t)
 
 void glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD3D);
     pb_pushf(s);
     pb_pushf(t);
@@ -2774,6 +3865,9 @@ void glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
 
 void glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD3F);
     pb_pushf(s);
     pb_pushf(t);
@@ -2782,6 +3876,9 @@ void glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
 
 void glTexCoord3i(GLint s, GLint t, GLint r)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD3I);
     pb_push(s);
     pb_push(t);
@@ -2790,6 +3887,9 @@ void glTexCoord3i(GLint s, GLint t, GLint r)
 
 void glTexCoord3s(GLshort s, GLshort t, GLshort r)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, 1.0f))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD3S);
     pb_push(s);
     pb_push(t);
@@ -2798,6 +3898,9 @@ void glTexCoord3s(GLshort s, GLshort t, GLshort r)
 
 void glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, q))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD4D);
     pb_pushf(s);
     pb_pushf(t);
@@ -2807,6 +3910,9 @@ void glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 
 void glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, q))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD4F);
     pb_pushf(s);
     pb_pushf(t);
@@ -2816,6 +3922,9 @@ void glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 
 void glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, q))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD4I);
     pb_push(s);
     pb_push(t);
@@ -2825,6 +3934,9 @@ void glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
 
 void glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
 {
+    if (glimpl_immediate_attrib(GLIMPL_IMMEDIATE_TEXCOORD, s, t, r, q))
+        return;
+
     pb_push(SGL_CMD_TEXCOORD4S);
     pb_push(s);
     pb_push(t);
@@ -2834,6 +3946,9 @@ void glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
 
 void glVertex2d(GLdouble x, GLdouble y)
 {
+    if (glimpl_immediate_vertex(x, y, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX2D);
     pb_pushf(x);
     pb_pushf(y);
@@ -2841,6 +3956,9 @@ void glVertex2d(GLdouble x, GLdouble y)
 
 void glVertex2f(GLfloat x, GLfloat y)
 {
+    if (glimpl_immediate_vertex(x, y, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX2F);
     pb_pushf(x);
     pb_pushf(y);
@@ -2848,6 +3966,9 @@ void glVertex2f(GLfloat x, GLfloat y)
 
 void glVertex2i(GLint x, GLint y)
 {
+    if (glimpl_immediate_vertex(x, y, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX2I);
     pb_push(x);
     pb_push(y);
@@ -2855,6 +3976,9 @@ void glVertex2i(GLint x, GLint y)
 
 void glVertex2s(GLshort x, GLshort y)
 {
+    if (glimpl_immediate_vertex(x, y, 0.0f, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX2S);
     pb_push(x);
     pb_push(y);
@@ -2862,6 +3986,9 @@ void glVertex2s(GLshort x, GLshort y)
 
 void glVertex3d(GLdouble x, GLdouble y, GLdouble z)
 {
+    if (glimpl_immediate_vertex(x, y, z, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX3D);
     pb_pushf(x);
     pb_pushf(y);
@@ -2870,6 +3997,9 @@ void glVertex3d(GLdouble x, GLdouble y, GLdouble z)
 
 void glVertex3i(GLint x, GLint y, GLint z)
 {
+    if (glimpl_immediate_vertex(x, y, z, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX3I);
     pb_push(x);
     pb_push(y);
@@ -2878,6 +4008,9 @@ void glVertex3i(GLint x, GLint y, GLint z)
 
 void glVertex3s(GLshort x, GLshort y, GLshort z)
 {
+    if (glimpl_immediate_vertex(x, y, z, 1.0f))
+        return;
+
     pb_push(SGL_CMD_VERTEX3S);
     pb_push(x);
     pb_push(y);
@@ -2886,6 +4019,9 @@ void glVertex3s(GLshort x, GLshort y, GLshort z)
 
 void glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
+    if (glimpl_immediate_vertex(x, y, z, w))
+        return;
+
     pb_push(SGL_CMD_VERTEX4D);
     pb_pushf(x);
     pb_pushf(y);
@@ -2895,6 +4031,9 @@ void glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
 void glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
+    if (glimpl_immediate_vertex(x, y, z, w))
+        return;
+
     pb_push(SGL_CMD_VERTEX4F);
     pb_pushf(x);
     pb_pushf(y);
@@ -2904,6 +4043,9 @@ void glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
 void glVertex4i(GLint x, GLint y, GLint z, GLint w)
 {
+    if (glimpl_immediate_vertex(x, y, z, w))
+        return;
+
     pb_push(SGL_CMD_VERTEX4I);
     pb_push(x);
     pb_push(y);
@@ -2913,6 +4055,9 @@ void glVertex4i(GLint x, GLint y, GLint z, GLint w)
 
 void glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
 {
+    if (glimpl_immediate_vertex(x, y, z, w))
+        return;
+
     pb_push(SGL_CMD_VERTEX4S);
     pb_push(x);
     pb_push(y);
@@ -2922,14 +4067,14 @@ void glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
 
 void glColorMaterial(GLenum face, GLenum mode)
 {
-    pb_push(SGL_CMD_COLORMATERIAL);
+    glimpl_push_command(SGL_CMD_COLORMATERIAL);
     pb_push(face);
     pb_push(mode);
 }
 
 void glFogf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_FOGF);
+    glimpl_push_command(SGL_CMD_FOGF);
     pb_push(pname);
     pb_pushf(param);
 }
@@ -2950,14 +4095,14 @@ void glFogfv(GLenum pname, const GLfloat* params)
 
 void glFogi(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_FOGI);
+    glimpl_push_command(SGL_CMD_FOGI);
     pb_push(pname);
     pb_push(param);
 }
 
 void glLightf(GLenum light, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_LIGHTF);
+    glimpl_push_command(SGL_CMD_LIGHTF);
     pb_push(light);
     pb_push(pname);
     pb_pushf(param);
@@ -2965,7 +4110,7 @@ void glLightf(GLenum light, GLenum pname, GLfloat param)
 
 void glLighti(GLenum light, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_LIGHTI);
+    glimpl_push_command(SGL_CMD_LIGHTI);
     pb_push(light);
     pb_push(pname);
     pb_push(param);
@@ -2973,28 +4118,28 @@ void glLighti(GLenum light, GLenum pname, GLint param)
 
 void glLightModelf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_LIGHTMODELF);
+    glimpl_push_command(SGL_CMD_LIGHTMODELF);
     pb_push(pname);
     pb_pushf(param);
 }
 
 void glLightModeli(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_LIGHTMODELI);
+    glimpl_push_command(SGL_CMD_LIGHTMODELI);
     pb_push(pname);
     pb_push(param);
 }
 
 void glLineStipple(GLint factor, GLushort pattern)
 {
-    pb_push(SGL_CMD_LINESTIPPLE);
+    glimpl_push_command(SGL_CMD_LINESTIPPLE);
     pb_push(factor);
     pb_push(pattern);
 }
 
 void glMaterialf(GLenum face, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_MATERIALF);
+    glimpl_push_command(SGL_CMD_MATERIALF);
     pb_push(face);
     pb_push(pname);
     pb_pushf(param);
@@ -3002,7 +4147,7 @@ void glMaterialf(GLenum face, GLenum pname, GLfloat param)
 
 void glMateriali(GLenum face, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_MATERIALI);
+    glimpl_push_command(SGL_CMD_MATERIALI);
     pb_push(face);
     pb_push(pname);
     pb_push(param);
@@ -3010,7 +4155,7 @@ void glMateriali(GLenum face, GLenum pname, GLint param)
 
 void glTexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXENVF);
+    glimpl_push_command(SGL_CMD_TEXENVF);
     pb_push(target);
     pb_push(pname);
     pb_pushf(param);
@@ -3018,7 +4163,7 @@ void glTexEnvf(GLenum target, GLenum pname, GLfloat param)
 
 void glTexEnvi(GLenum target, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXENVI);
+    glimpl_push_command(SGL_CMD_TEXENVI);
     pb_push(target);
     pb_push(pname);
     pb_push(param);
@@ -3026,7 +4171,7 @@ void glTexEnvi(GLenum target, GLenum pname, GLint param)
 
 void glTexGend(GLenum coord, GLenum pname, GLdouble param)
 {
-    pb_push(SGL_CMD_TEXGEND);
+    glimpl_push_command(SGL_CMD_TEXGEND);
     pb_push(coord);
     pb_push(pname);
     pb_pushf(param);
@@ -3034,7 +4179,7 @@ void glTexGend(GLenum coord, GLenum pname, GLdouble param)
 
 void glTexGenf(GLenum coord, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXGENF);
+    glimpl_push_command(SGL_CMD_TEXGENF);
     pb_push(coord);
     pb_push(pname);
     pb_pushf(param);
@@ -3042,7 +4187,7 @@ void glTexGenf(GLenum coord, GLenum pname, GLfloat param)
 
 void glTexGeni(GLenum coord, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXGENI);
+    glimpl_push_command(SGL_CMD_TEXGENI);
     pb_push(coord);
     pb_push(pname);
     pb_push(param);
@@ -3050,7 +4195,7 @@ void glTexGeni(GLenum coord, GLenum pname, GLint param)
 
 GLint glRenderMode(GLenum mode)
 {
-    pb_push(SGL_CMD_RENDERMODE);
+    glimpl_push_command(SGL_CMD_RENDERMODE);
     pb_push(mode);
 
     glimpl_submit();
@@ -3059,35 +4204,35 @@ GLint glRenderMode(GLenum mode)
 
 void glInitNames(void)
 {
-    pb_push(SGL_CMD_INITNAMES);
+    glimpl_push_command(SGL_CMD_INITNAMES);
 }
 
 void glLoadName(GLuint name)
 {
-    pb_push(SGL_CMD_LOADNAME);
+    glimpl_push_command(SGL_CMD_LOADNAME);
     pb_push(name);
 }
 
 void glPassThrough(GLfloat token)
 {
-    pb_push(SGL_CMD_PASSTHROUGH);
+    glimpl_push_command(SGL_CMD_PASSTHROUGH);
     pb_pushf(token);
 }
 
 void glPopName(void)
 {
-    pb_push(SGL_CMD_POPNAME);
+    glimpl_push_command(SGL_CMD_POPNAME);
 }
 
 void glPushName(GLuint name)
 {
-    pb_push(SGL_CMD_PUSHNAME);
+    glimpl_push_command(SGL_CMD_PUSHNAME);
     pb_push(name);
 }
 
 void glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
-    pb_push(SGL_CMD_CLEARACCUM);
+    glimpl_push_command(SGL_CMD_CLEARACCUM);
     pb_pushf(red);
     pb_pushf(green);
     pb_pushf(blue);
@@ -3096,37 +4241,39 @@ void glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 
 void glClearIndex(GLfloat c)
 {
-    pb_push(SGL_CMD_CLEARINDEX);
+    glimpl_push_command(SGL_CMD_CLEARINDEX);
     pb_pushf(c);
 }
 
 void glIndexMask(GLuint mask)
 {
-    pb_push(SGL_CMD_INDEXMASK);
+    glimpl_push_command(SGL_CMD_INDEXMASK);
     pb_push(mask);
 }
 
 void glAccum(GLenum op, GLfloat value)
 {
-    pb_push(SGL_CMD_ACCUM);
+    glimpl_push_command(SGL_CMD_ACCUM);
     pb_push(op);
     pb_pushf(value);
 }
 
 void glPopAttrib(void)
 {
-    pb_push(SGL_CMD_POPATTRIB);
+    glimpl_push_command(SGL_CMD_POPATTRIB);
+
+    state_invalidate();
 }
 
 void glPushAttrib(GLbitfield mask)
 {
-    pb_push(SGL_CMD_PUSHATTRIB);
+    glimpl_push_command(SGL_CMD_PUSHATTRIB);
     pb_push(mask);
 }
 
 void glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
 {
-    pb_push(SGL_CMD_MAPGRID1D);
+    glimpl_push_command(SGL_CMD_MAPGRID1D);
     pb_push(un);
     pb_pushf(u1);
     pb_pushf(u2);
@@ -3134,7 +4281,7 @@ void glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
 
 void glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
 {
-    pb_push(SGL_CMD_MAPGRID1F);
+    glimpl_push_command(SGL_CMD_MAPGRID1F);
     pb_push(un);
     pb_pushf(u1);
     pb_pushf(u2);
@@ -3142,7 +4289,7 @@ void glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
 
 void glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
 {
-    pb_push(SGL_CMD_MAPGRID2D);
+    glimpl_push_command(SGL_CMD_MAPGRID2D);
     pb_push(un);
     pb_pushf(u1);
     pb_pushf(u2);
@@ -3153,7 +4300,7 @@ void glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdo
 
 void glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
 {
-    pb_push(SGL_CMD_MAPGRID2F);
+    glimpl_push_command(SGL_CMD_MAPGRID2F);
     pb_push(un);
     pb_pushf(u1);
     pb_pushf(u2);
@@ -3164,33 +4311,33 @@ void glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat
 
 void glEvalCoord1d(GLdouble u)
 {
-    pb_push(SGL_CMD_EVALCOORD1D);
+    glimpl_push_command(SGL_CMD_EVALCOORD1D);
     pb_pushf(u);
 }
 
 void glEvalCoord1f(GLfloat u)
 {
-    pb_push(SGL_CMD_EVALCOORD1F);
+    glimpl_push_command(SGL_CMD_EVALCOORD1F);
     pb_pushf(u);
 }
 
 void glEvalCoord2d(GLdouble u, GLdouble v)
 {
-    pb_push(SGL_CMD_EVALCOORD2D);
+    glimpl_push_command(SGL_CMD_EVALCOORD2D);
     pb_pushf(u);
     pb_pushf(v);
 }
 
 void glEvalCoord2f(GLfloat u, GLfloat v)
 {
-    pb_push(SGL_CMD_EVALCOORD2F);
+    glimpl_push_command(SGL_CMD_EVALCOORD2F);
     pb_pushf(u);
     pb_pushf(v);
 }
 
 void glEvalMesh1(GLenum mode, GLint i1, GLint i2)
 {
-    pb_push(SGL_CMD_EVALMESH1);
+    glimpl_push_command(SGL_CMD_EVALMESH1);
     pb_push(mode);
     pb_push(i1);
     pb_push(i2);
@@ -3198,13 +4345,13 @@ void glEvalMesh1(GLenum mode, GLint i1, GLint i2)
 
 void glEvalPoint1(GLint i)
 {
-    pb_push(SGL_CMD_EVALPOINT1);
+    glimpl_push_command(SGL_CMD_EVALPOINT1);
     pb_push(i);
 }
 
 void glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
 {
-    pb_push(SGL_CMD_EVALMESH2);
+    glimpl_push_command(SGL_CMD_EVALMESH2);
     pb_push(mode);
     pb_push(i1);
     pb_push(i2);
@@ -3214,42 +4361,42 @@ void glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
 
 void glEvalPoint2(GLint i, GLint j)
 {
-    pb_push(SGL_CMD_EVALPOINT2);
+    glimpl_push_command(SGL_CMD_EVALPOINT2);
     pb_push(i);
     pb_push(j);
 }
 
 void glAlphaFunc(GLenum func, GLfloat ref)
 {
-    pb_push(SGL_CMD_ALPHAFUNC);
+    glimpl_push_command(SGL_CMD_ALPHAFUNC);
     pb_push(func);
     pb_pushf(ref);
 }
 
 void glPixelZoom(GLfloat xfactor, GLfloat yfactor)
 {
-    pb_push(SGL_CMD_PIXELZOOM);
+    glimpl_push_command(SGL_CMD_PIXELZOOM);
     pb_pushf(xfactor);
     pb_pushf(yfactor);
 }
 
 void glPixelTransferf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_PIXELTRANSFERF);
+    glimpl_push_command(SGL_CMD_PIXELTRANSFERF);
     pb_push(pname);
     pb_pushf(param);
 }
 
 void glPixelTransferi(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_PIXELTRANSFERI);
+    glimpl_push_command(SGL_CMD_PIXELTRANSFERI);
     pb_push(pname);
     pb_push(param);
 }
 
 void glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
 {
-    pb_push(SGL_CMD_COPYPIXELS);
+    glimpl_push_command(SGL_CMD_COPYPIXELS);
     pb_push(x);
     pb_push(y);
     pb_push(width);
@@ -3259,7 +4406,7 @@ void glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
 
 GLboolean glIsList(GLuint list)
 {
-    pb_push(SGL_CMD_ISLIST);
+    glimpl_push_command(SGL_CMD_ISLIST);
     pb_push(list);
 
     glimpl_submit();
@@ -3268,50 +4415,58 @@ GLboolean glIsList(GLuint list)
 
 void glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
 {
-    pb_push(SGL_CMD_ORTHO);
+    glimpl_push_command(SGL_CMD_ORTHO);
     pb_pushf(left);
     pb_pushf(right);
     pb_pushf(bottom);
     pb_pushf(top);
     pb_pushf(zNear);
     pb_pushf(zFar);
+
+    state_ortho(left, right, bottom, top, zNear, zFar);
 }
 
 void glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_ROTATED);
+    glimpl_push_command(SGL_CMD_ROTATED);
     pb_pushf(angle);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
+
+    state_rotate(angle, x, y, z);
 }
 
 void glScaled(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_SCALED);
+    glimpl_push_command(SGL_CMD_SCALED);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
+
+    state_scale(x, y, z);
 }
 
 void glScalef(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_SCALEF);
+    glimpl_push_command(SGL_CMD_SCALEF);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
+
+    state_scale(x, y, z);
 }
 
 void glPolygonOffset(GLfloat factor, GLfloat units)
 {
-    pb_push(SGL_CMD_POLYGONOFFSET);
+    glimpl_push_command(SGL_CMD_POLYGONOFFSET);
     pb_pushf(factor);
     pb_pushf(units);
 }
 
 void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
 {
-    pb_push(SGL_CMD_COPYTEXIMAGE1D);
+    glimpl_push_command(SGL_CMD_COPYTEXIMAGE1D);
     pb_push(target);
     pb_push(level);
     pb_push(internalformat);
@@ -3323,7 +4478,7 @@ void glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x
 
 void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
 {
-    pb_push(SGL_CMD_COPYTEXIMAGE2D);
+    glimpl_push_command(SGL_CMD_COPYTEXIMAGE2D);
     pb_push(target);
     pb_push(level);
     pb_push(internalformat);
@@ -3336,7 +4491,7 @@ void glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x
 
 void glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
 {
-    pb_push(SGL_CMD_COPYTEXSUBIMAGE1D);
+    glimpl_push_command(SGL_CMD_COPYTEXSUBIMAGE1D);
     pb_push(target);
     pb_push(level);
     pb_push(xoffset);
@@ -3347,7 +4502,7 @@ void glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLi
 
 void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXSUBIMAGE2D);
+    glimpl_push_command(SGL_CMD_COPYTEXSUBIMAGE2D);
     pb_push(target);
     pb_push(level);
     pb_push(xoffset);
@@ -3360,14 +4515,17 @@ void glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffse
 
 void glBindTexture(GLenum target, GLuint texture)
 {
-    pb_push(SGL_CMD_BINDTEXTURE);
+    glimpl_push_command(SGL_CMD_BINDTEXTURE);
     pb_push(target);
     pb_push(texture);
+
+    state_bind_texture(target, texture);
+    names_reserve(NAMES_TEXTURE, texture);
 }
 
 GLboolean glIsTexture(GLuint texture)
 {
-    pb_push(SGL_CMD_ISTEXTURE);
+    glimpl_push_command(SGL_CMD_ISTEXTURE);
     pb_push(texture);
 
     glimpl_submit();
@@ -3376,7 +4534,7 @@ GLboolean glIsTexture(GLuint texture)
 
 void glArrayElement(GLint i)
 {
-    pb_push(SGL_CMD_ARRAYELEMENT);
+    glimpl_push_command(SGL_CMD_ARRAYELEMENT);
     pb_push(i);
 }
 
@@ -3424,24 +4582,26 @@ void glEnableClientState(GLenum array)
 
 void glIndexub(GLubyte c)
 {
-    pb_push(SGL_CMD_INDEXUB);
+    glimpl_push_command(SGL_CMD_INDEXUB);
     pb_push(c);
 }
 
 void glPopClientAttrib(void)
 {
-    pb_push(SGL_CMD_POPCLIENTATTRIB);
+    glimpl_push_command(SGL_CMD_POPCLIENTATTRIB);
+
+    state_invalidate();
 }
 
 void glPushClientAttrib(GLbitfield mask)
 {
-    pb_push(SGL_CMD_PUSHCLIENTATTRIB);
+    glimpl_push_command(SGL_CMD_PUSHCLIENTATTRIB);
     pb_push(mask);
 }
 
 void glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXIMAGE3DMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_TEXIMAGE3DMULTISAMPLE);
     pb_push(target);
     pb_push(samples);
     pb_push(internalformat);
@@ -3453,7 +4613,7 @@ void glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalform
 
 void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXSUBIMAGE3D);
+    glimpl_push_command(SGL_CMD_COPYTEXSUBIMAGE3D);
     pb_push(target);
     pb_push(level);
     pb_push(xoffset);
@@ -3467,20 +4627,22 @@ void glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffse
 
 void glActiveTexture(GLenum texture)
 {
-    pb_push(SGL_CMD_ACTIVETEXTURE);
+    glimpl_push_command(SGL_CMD_ACTIVETEXTURE);
     pb_push(texture);
+
+    state_active_texture(texture);
 }
 
 void glSampleCoverage(GLfloat value, GLboolean invert)
 {
-    pb_push(SGL_CMD_SAMPLECOVERAGE);
+    glimpl_push_command(SGL_CMD_SAMPLECOVERAGE);
     pb_pushf(value);
     pb_push(invert);
 }
 
 void glClientActiveTexture(GLenum texture)
 {
-    pb_push(SGL_CMD_CLIENTACTIVETEXTURE);
+    glimpl_push_command(SGL_CMD_CLIENTACTIVETEXTURE);
     pb_push(texture);
 
     glimpl_client_active_texture = texture - (GLenum)GL_TEXTURE0;
@@ -3493,35 +4655,35 @@ void glClientActiveTextureARB(GLenum texture)
 
 void glMultiTexCoord1d(GLenum target, GLdouble s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1D);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD1D);
     pb_push(target);
     pb_pushf(s);
 }
 
 void glMultiTexCoord1f(GLenum target, GLfloat s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1F);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD1F);
     pb_push(target);
     pb_pushf(s);
 }
 
 void glMultiTexCoord1i(GLenum target, GLint s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1I);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD1I);
     pb_push(target);
     pb_push(s);
 }
 
 void glMultiTexCoord1s(GLenum target, GLshort s)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD1S);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD1S);
     pb_push(target);
     pb_push(s);
 }
 
 void glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2D);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD2D);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -3529,7 +4691,7 @@ void glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
 
 void glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2F);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD2F);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -3537,7 +4699,7 @@ void glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
 
 void glMultiTexCoord2i(GLenum target, GLint s, GLint t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2I);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD2I);
     pb_push(target);
     pb_push(s);
     pb_push(t);
@@ -3545,7 +4707,7 @@ void glMultiTexCoord2i(GLenum target, GLint s, GLint t)
 
 void glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2S);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD2S);
     pb_push(target);
     pb_push(s);
     pb_push(t);
@@ -3553,7 +4715,7 @@ void glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
 
 void glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3D);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD3D);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -3562,7 +4724,7 @@ void glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
 
 void glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3F);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD3F);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -3571,7 +4733,7 @@ void glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
 
 void glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3I);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD3I);
     pb_push(target);
     pb_push(s);
     pb_push(t);
@@ -3580,7 +4742,7 @@ void glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
 
 void glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD3S);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD3S);
     pb_push(target);
     pb_push(s);
     pb_push(t);
@@ -3589,7 +4751,7 @@ void glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
 
 void glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4D);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD4D);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -3599,7 +4761,7 @@ void glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdoub
 
 void glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4F);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD4F);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -3609,7 +4771,7 @@ void glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q
 
 void glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4I);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD4I);
     pb_push(target);
     pb_push(s);
     pb_push(t);
@@ -3619,7 +4781,7 @@ void glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
 
 void glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD4S);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD4S);
     pb_push(target);
     pb_push(s);
     pb_push(t);
@@ -3629,7 +4791,7 @@ void glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q
 
 void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
 {
-    pb_push(SGL_CMD_BLENDFUNCSEPARATE);
+    glimpl_push_command(SGL_CMD_BLENDFUNCSEPARATE);
     pb_push(sfactorRGB);
     pb_push(dfactorRGB);
     pb_push(sfactorAlpha);
@@ -3638,33 +4800,33 @@ void glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlp
 
 void glPointParameterf(GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_POINTPARAMETERF);
+    glimpl_push_command(SGL_CMD_POINTPARAMETERF);
     pb_push(pname);
     pb_pushf(param);
 }
 
 void glPointParameteri(GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_POINTPARAMETERI);
+    glimpl_push_command(SGL_CMD_POINTPARAMETERI);
     pb_push(pname);
     pb_push(param);
 }
 
 void glFogCoordf(GLfloat coord)
 {
-    pb_push(SGL_CMD_FOGCOORDF);
+    glimpl_push_command(SGL_CMD_FOGCOORDF);
     pb_pushf(coord);
 }
 
 void glFogCoordd(GLdouble coord)
 {
-    pb_push(SGL_CMD_FOGCOORDD);
+    glimpl_push_command(SGL_CMD_FOGCOORDD);
     pb_pushf(coord);
 }
 
 void glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3B);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3B);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -3672,7 +4834,7 @@ void glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 
 void glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3D);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3D);
     pb_pushf(red);
     pb_pushf(green);
     pb_pushf(blue);
@@ -3680,7 +4842,7 @@ void glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
 
 void glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3F);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3F);
     pb_pushf(red);
     pb_pushf(green);
     pb_pushf(blue);
@@ -3688,7 +4850,7 @@ void glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 
 void glSecondaryColor3i(GLint red, GLint green, GLint blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3I);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3I);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -3696,7 +4858,7 @@ void glSecondaryColor3i(GLint red, GLint green, GLint blue)
 
 void glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3S);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3S);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -3704,7 +4866,7 @@ void glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 
 void glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3UB);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3UB);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -3712,7 +4874,7 @@ void glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 
 void glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3UI);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3UI);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -3720,7 +4882,7 @@ void glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 
 void glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
 {
-    pb_push(SGL_CMD_SECONDARYCOLOR3US);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLOR3US);
     pb_push(red);
     pb_push(green);
     pb_push(blue);
@@ -3728,35 +4890,35 @@ void glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
 
 void glWindowPos2d(GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2D);
+    glimpl_push_command(SGL_CMD_WINDOWPOS2D);
     pb_pushf(x);
     pb_pushf(y);
 }
 
 void glWindowPos2f(GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2F);
+    glimpl_push_command(SGL_CMD_WINDOWPOS2F);
     pb_pushf(x);
     pb_pushf(y);
 }
 
 void glWindowPos2i(GLint x, GLint y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2I);
+    glimpl_push_command(SGL_CMD_WINDOWPOS2I);
     pb_push(x);
     pb_push(y);
 }
 
 void glWindowPos2s(GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_WINDOWPOS2S);
+    glimpl_push_command(SGL_CMD_WINDOWPOS2S);
     pb_push(x);
     pb_push(y);
 }
 
 void glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3D);
+    glimpl_push_command(SGL_CMD_WINDOWPOS3D);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
@@ -3764,7 +4926,7 @@ void glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 
 void glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3F);
+    glimpl_push_command(SGL_CMD_WINDOWPOS3F);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(z);
@@ -3772,7 +4934,7 @@ void glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 
 void glWindowPos3i(GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3I);
+    glimpl_push_command(SGL_CMD_WINDOWPOS3I);
     pb_push(x);
     pb_push(y);
     pb_push(z);
@@ -3780,7 +4942,7 @@ void glWindowPos3i(GLint x, GLint y, GLint z)
 
 void glWindowPos3s(GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_WINDOWPOS3S);
+    glimpl_push_command(SGL_CMD_WINDOWPOS3S);
     pb_push(x);
     pb_push(y);
     pb_push(z);
@@ -3788,7 +4950,7 @@ void glWindowPos3s(GLshort x, GLshort y, GLshort z)
 
 void glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
-    pb_push(SGL_CMD_BLENDCOLOR);
+    glimpl_push_command(SGL_CMD_BLENDCOLOR);
     pb_pushf(red);
     pb_pushf(green);
     pb_pushf(blue);
@@ -3797,13 +4959,13 @@ void glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 
 void glBlendEquation(GLenum mode)
 {
-    pb_push(SGL_CMD_BLENDEQUATION);
+    glimpl_push_command(SGL_CMD_BLENDEQUATION);
     pb_push(mode);
 }
 
 GLboolean glIsQuery(GLuint id)
 {
-    pb_push(SGL_CMD_ISQUERY);
+    glimpl_push_command(SGL_CMD_ISQUERY);
     pb_push(id);
 
     glimpl_submit();
@@ -3812,7 +4974,7 @@ GLboolean glIsQuery(GLuint id)
 
 GLboolean glIsBuffer(GLuint buffer)
 {
-    pb_push(SGL_CMD_ISBUFFER);
+    glimpl_push_command(SGL_CMD_ISBUFFER);
     pb_push(buffer);
 
     glimpl_submit();
@@ -3826,14 +4988,14 @@ GLboolean glUnmapBuffer(GLenum target)
 
 void glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
-    pb_push(SGL_CMD_BLENDEQUATIONSEPARATE);
+    glimpl_push_command(SGL_CMD_BLENDEQUATIONSEPARATE);
     pb_push(modeRGB);
     pb_push(modeAlpha);
 }
 
 void glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
 {
-    pb_push(SGL_CMD_STENCILOPSEPARATE);
+    glimpl_push_command(SGL_CMD_STENCILOPSEPARATE);
     pb_push(face);
     pb_push(sfail);
     pb_push(dpfail);
@@ -3842,7 +5004,7 @@ void glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass
 
 void glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILFUNCSEPARATE);
+    glimpl_push_command(SGL_CMD_STENCILFUNCSEPARATE);
     pb_push(face);
     pb_push(func);
     pb_push(ref);
@@ -3851,7 +5013,7 @@ void glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 
 void glStencilMaskSeparate(GLenum face, GLuint mask)
 {
-    pb_push(SGL_CMD_STENCILMASKSEPARATE);
+    glimpl_push_command(SGL_CMD_STENCILMASKSEPARATE);
     pb_push(face);
     pb_push(mask);
 }
@@ -3868,7 +5030,7 @@ void glDisableVertexAttribArray(GLuint index)
 
 GLboolean glIsProgram(GLuint program)
 {
-    pb_push(SGL_CMD_ISPROGRAM);
+    glimpl_push_command(SGL_CMD_ISPROGRAM);
     pb_push(program);
 
     glimpl_submit();
@@ -3877,7 +5039,7 @@ GLboolean glIsProgram(GLuint program)
 
 GLboolean glIsShader(GLuint shader)
 {
-    pb_push(SGL_CMD_ISSHADER);
+    glimpl_push_command(SGL_CMD_ISSHADER);
     pb_push(shader);
 
     glimpl_submit();
@@ -3886,7 +5048,7 @@ GLboolean glIsShader(GLuint shader)
 
 void glUniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
-    pb_push(SGL_CMD_UNIFORM2F);
+    glimpl_push_command(SGL_CMD_UNIFORM2F);
     pb_push(location);
     pb_pushf(v0);
     pb_pushf(v1);
@@ -3894,7 +5056,7 @@ void glUniform2f(GLint location, GLfloat v0, GLfloat v1)
 
 void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
-    pb_push(SGL_CMD_UNIFORM3F);
+    glimpl_push_command(SGL_CMD_UNIFORM3F);
     pb_push(location);
     pb_pushf(v0);
     pb_pushf(v1);
@@ -3903,7 +5065,7 @@ void glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 
 void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
-    pb_push(SGL_CMD_UNIFORM4F);
+    glimpl_push_command(SGL_CMD_UNIFORM4F);
     pb_push(location);
     pb_pushf(v0);
     pb_pushf(v1);
@@ -3913,14 +5075,14 @@ void glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 
 void glUniform1i(GLint location, GLint v0)
 {
-    pb_push(SGL_CMD_UNIFORM1I);
+    glimpl_push_command(SGL_CMD_UNIFORM1I);
     pb_push(location);
     pb_push(v0);
 }
 
 void glUniform2i(GLint location, GLint v0, GLint v1)
 {
-    pb_push(SGL_CMD_UNIFORM2I);
+    glimpl_push_command(SGL_CMD_UNIFORM2I);
     pb_push(location);
     pb_push(v0);
     pb_push(v1);
@@ -3928,7 +5090,7 @@ void glUniform2i(GLint location, GLint v0, GLint v1)
 
 void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
-    pb_push(SGL_CMD_UNIFORM3I);
+    glimpl_push_command(SGL_CMD_UNIFORM3I);
     pb_push(location);
     pb_push(v0);
     pb_push(v1);
@@ -3937,7 +5099,7 @@ void glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 
 void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
-    pb_push(SGL_CMD_UNIFORM4I);
+    glimpl_push_command(SGL_CMD_UNIFORM4I);
     pb_push(location);
     pb_push(v0);
     pb_push(v1);
@@ -3947,34 +5109,34 @@ void glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 
 void glValidateProgram(GLuint program)
 {
-    pb_push(SGL_CMD_VALIDATEPROGRAM);
+    glimpl_push_command(SGL_CMD_VALIDATEPROGRAM);
     pb_push(program);
 }
 
 void glVertexAttrib1d(GLuint index, GLdouble x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB1D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB1D);
     pb_push(index);
     pb_pushf(x);
 }
 
 void glVertexAttrib1f(GLuint index, GLfloat x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB1F);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB1F);
     pb_push(index);
     pb_pushf(x);
 }
 
 void glVertexAttrib1s(GLuint index, GLshort x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB1S);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB1S);
     pb_push(index);
     pb_push(x);
 }
 
 void glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB2D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB2D);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -3982,7 +5144,7 @@ void glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
 
 void glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB2F);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB2F);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -3990,7 +5152,7 @@ void glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 
 void glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB2S);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB2S);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -3998,7 +5160,7 @@ void glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
 
 void glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB3D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB3D);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -4007,7 +5169,7 @@ void glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 
 void glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB3F);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB3F);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -4016,7 +5178,7 @@ void glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 
 void glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB3S);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB3S);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4025,7 +5187,7 @@ void glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
 
 void glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NUB);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4NUB);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4035,7 +5197,7 @@ void glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w
 
 void glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4D);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -4045,7 +5207,7 @@ void glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble
 
 void glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4F);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4F);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -4055,7 +5217,7 @@ void glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
 void glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4S);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4S);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4065,7 +5227,7 @@ void glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
 
 void glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
-    pb_push(SGL_CMD_COLORMASKI);
+    glimpl_push_command(SGL_CMD_COLORMASKI);
     pb_push(index);
     pb_push(r);
     pb_push(g);
@@ -4075,21 +5237,25 @@ void glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean
 
 void glEnablei(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ENABLEI);
+    glimpl_push_command(SGL_CMD_ENABLEI);
     pb_push(target);
     pb_push(index);
+
+    state_enable_indexed(target);
 }
 
 void glDisablei(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_DISABLEI);
+    glimpl_push_command(SGL_CMD_DISABLEI);
     pb_push(target);
     pb_push(index);
+
+    state_enable_indexed(target);
 }
 
 GLboolean glIsEnabledi(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ISENABLEDI);
+    glimpl_push_command(SGL_CMD_ISENABLEDI);
     pb_push(target);
     pb_push(index);
 
@@ -4099,62 +5265,68 @@ GLboolean glIsEnabledi(GLenum target, GLuint index)
 
 void glBeginTransformFeedback(GLenum primitiveMode)
 {
-    pb_push(SGL_CMD_BEGINTRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_BEGINTRANSFORMFEEDBACK);
     pb_push(primitiveMode);
 }
 
 void glEndTransformFeedback(void)
 {
-    pb_push(SGL_CMD_ENDTRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_ENDTRANSFORMFEEDBACK);
 }
 
 void glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_BINDBUFFERRANGE);
+    glimpl_push_command(SGL_CMD_BINDBUFFERRANGE);
     pb_push(target);
     pb_push(index);
     pb_push(buffer);
     pb_push(offset);
     pb_push(size);
+
+    state_bind_buffer(target, buffer);
+    names_reserve(NAMES_BUFFER, buffer);
 }
 
 void glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
-    pb_push(SGL_CMD_BINDBUFFERBASE);
+    glimpl_push_command(SGL_CMD_BINDBUFFERBASE);
     pb_push(target);
     pb_push(index);
     pb_push(buffer);
+
+    state_bind_buffer(target, buffer);
+    names_reserve(NAMES_BUFFER, buffer);
 }
 
 void glClampColor(GLenum target, GLenum clamp)
 {
-    pb_push(SGL_CMD_CLAMPCOLOR);
+    glimpl_push_command(SGL_CMD_CLAMPCOLOR);
     pb_push(target);
     pb_push(clamp);
 }
 
 void glBeginConditionalRender(GLuint id, GLenum mode)
 {
-    pb_push(SGL_CMD_BEGINCONDITIONALRENDER);
+    glimpl_push_command(SGL_CMD_BEGINCONDITIONALRENDER);
     pb_push(id);
     pb_push(mode);
 }
 
 void glEndConditionalRender(void)
 {
-    pb_push(SGL_CMD_ENDCONDITIONALRENDER);
+    glimpl_push_command(SGL_CMD_ENDCONDITIONALRENDER);
 }
 
 void glVertexAttribI1i(GLuint index, GLint x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI1I);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI1I);
     pb_push(index);
     pb_push(x);
 }
 
 void glVertexAttribI2i(GLuint index, GLint x, GLint y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI2I);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI2I);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4162,7 +5334,7 @@ void glVertexAttribI2i(GLuint index, GLint x, GLint y)
 
 void glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI3I);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI3I);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4171,7 +5343,7 @@ void glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
 
 void glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI4I);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI4I);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4181,14 +5353,14 @@ void glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
 
 void glVertexAttribI1ui(GLuint index, GLuint x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI1UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI1UI);
     pb_push(index);
     pb_push(x);
 }
 
 void glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI2UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI2UI);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4196,7 +5368,7 @@ void glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
 
 void glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI3UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI3UI);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4205,7 +5377,7 @@ void glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
 
 void glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBI4UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBI4UI);
     pb_push(index);
     pb_push(x);
     pb_push(y);
@@ -4215,14 +5387,14 @@ void glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 
 void glUniform1ui(GLint location, GLuint v0)
 {
-    pb_push(SGL_CMD_UNIFORM1UI);
+    glimpl_push_command(SGL_CMD_UNIFORM1UI);
     pb_push(location);
     pb_push(v0);
 }
 
 void glUniform2ui(GLint location, GLuint v0, GLuint v1)
 {
-    pb_push(SGL_CMD_UNIFORM2UI);
+    glimpl_push_command(SGL_CMD_UNIFORM2UI);
     pb_push(location);
     pb_push(v0);
     pb_push(v1);
@@ -4230,7 +5402,7 @@ void glUniform2ui(GLint location, GLuint v0, GLuint v1)
 
 void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
-    pb_push(SGL_CMD_UNIFORM3UI);
+    glimpl_push_command(SGL_CMD_UNIFORM3UI);
     pb_push(location);
     pb_push(v0);
     pb_push(v1);
@@ -4239,7 +5411,7 @@ void glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 
 void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
-    pb_push(SGL_CMD_UNIFORM4UI);
+    glimpl_push_command(SGL_CMD_UNIFORM4UI);
     pb_push(location);
     pb_push(v0);
     pb_push(v1);
@@ -4249,7 +5421,7 @@ void glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 
 void glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
 {
-    pb_push(SGL_CMD_CLEARBUFFERFI);
+    glimpl_push_command(SGL_CMD_CLEARBUFFERFI);
     pb_push(buffer);
     pb_push(drawbuffer);
     pb_pushf(depth);
@@ -4258,7 +5430,7 @@ void glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stenc
 
 GLboolean glIsRenderbuffer(GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_ISRENDERBUFFER);
+    glimpl_push_command(SGL_CMD_ISRENDERBUFFER);
     pb_push(renderbuffer);
 
     glimpl_submit();
@@ -4267,14 +5439,17 @@ GLboolean glIsRenderbuffer(GLuint renderbuffer)
 
 void glBindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_BINDRENDERBUFFER);
+    glimpl_push_command(SGL_CMD_BINDRENDERBUFFER);
     pb_push(target);
     pb_push(renderbuffer);
+
+    state_bind_renderbuffer(renderbuffer);
+    names_reserve(NAMES_RENDERBUFFER, renderbuffer);
 }
 
 void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_RENDERBUFFERSTORAGE);
+    glimpl_push_command(SGL_CMD_RENDERBUFFERSTORAGE);
     pb_push(target);
     pb_push(internalformat);
     pb_push(width);
@@ -4283,7 +5458,7 @@ void glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width,
 
 GLboolean glIsFramebuffer(GLuint framebuffer)
 {
-    pb_push(SGL_CMD_ISFRAMEBUFFER);
+    glimpl_push_command(SGL_CMD_ISFRAMEBUFFER);
     pb_push(framebuffer);
 
     glimpl_submit();
@@ -4292,14 +5467,17 @@ GLboolean glIsFramebuffer(GLuint framebuffer)
 
 void glBindFramebuffer(GLenum target, GLuint framebuffer)
 {
-    pb_push(SGL_CMD_BINDFRAMEBUFFER);
+    glimpl_push_command(SGL_CMD_BINDFRAMEBUFFER);
     pb_push(target);
     pb_push(framebuffer);
+
+    state_bind_framebuffer(target, framebuffer);
+    names_reserve(NAMES_FRAMEBUFFER, framebuffer);
 }
 
 GLenum glCheckFramebufferStatus(GLenum target)
 {
-    pb_push(SGL_CMD_CHECKFRAMEBUFFERSTATUS);
+    glimpl_push_command(SGL_CMD_CHECKFRAMEBUFFERSTATUS);
     pb_push(target);
 
     glimpl_submit();
@@ -4308,7 +5486,7 @@ GLenum glCheckFramebufferStatus(GLenum target)
 
 void glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE1D);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERTEXTURE1D);
     pb_push(target);
     pb_push(attachment);
     pb_push(textarget);
@@ -4318,7 +5496,7 @@ void glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget,
 
 void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE2D);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERTEXTURE2D);
     pb_push(target);
     pb_push(attachment);
     pb_push(textarget);
@@ -4328,7 +5506,7 @@ void glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget,
 
 void glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE3D);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERTEXTURE3D);
     pb_push(target);
     pb_push(attachment);
     pb_push(textarget);
@@ -4339,7 +5517,7 @@ void glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget,
 
 void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERRENDERBUFFER);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERRENDERBUFFER);
     pb_push(target);
     pb_push(attachment);
     pb_push(renderbuffertarget);
@@ -4348,13 +5526,13 @@ void glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbu
 
 void glGenerateMipmap(GLenum target)
 {
-    pb_push(SGL_CMD_GENERATEMIPMAP);
+    glimpl_push_command(SGL_CMD_GENERATEMIPMAP);
     pb_push(target);
 }
 
 void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
 {
-    pb_push(SGL_CMD_BLITFRAMEBUFFER);
+    glimpl_push_command(SGL_CMD_BLITFRAMEBUFFER);
     pb_push(srcX0);
     pb_push(srcY0);
     pb_push(srcX1);
@@ -4369,7 +5547,7 @@ void glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint
 
 void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE);
     pb_push(target);
     pb_push(samples);
     pb_push(internalformat);
@@ -4379,7 +5557,7 @@ void glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum int
 
 void glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURELAYER);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERTEXTURELAYER);
     pb_push(target);
     pb_push(attachment);
     pb_push(texture);
@@ -4394,7 +5572,7 @@ void glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
 
 GLboolean glIsVertexArray(GLuint array)
 {
-    pb_push(SGL_CMD_ISVERTEXARRAY);
+    glimpl_push_command(SGL_CMD_ISVERTEXARRAY);
     pb_push(array);
 
     glimpl_submit();
@@ -4403,7 +5581,7 @@ GLboolean glIsVertexArray(GLuint array)
 
 void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
 {
-    pb_push(SGL_CMD_DRAWARRAYSINSTANCED);
+    glimpl_push_command(SGL_CMD_DRAWARRAYSINSTANCED);
     pb_push(mode);
     pb_push(first);
     pb_push(count);
@@ -4412,7 +5590,7 @@ void glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei inst
 
 void glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 {
-    pb_push(SGL_CMD_TEXBUFFER);
+    glimpl_push_command(SGL_CMD_TEXBUFFER);
     pb_push(target);
     pb_push(internalformat);
     pb_push(buffer);
@@ -4420,13 +5598,13 @@ void glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 
 void glPrimitiveRestartIndex(GLuint index)
 {
-    pb_push(SGL_CMD_PRIMITIVERESTARTINDEX);
+    glimpl_push_command(SGL_CMD_PRIMITIVERESTARTINDEX);
     pb_push(index);
 }
 
 void glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_COPYBUFFERSUBDATA);
+    glimpl_push_command(SGL_CMD_COPYBUFFERSUBDATA);
     pb_push(readTarget);
     pb_push(writeTarget);
     pb_push(readOffset);
@@ -4436,7 +5614,7 @@ void glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOff
 
 void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
-    pb_push(SGL_CMD_UNIFORMBLOCKBINDING);
+    glimpl_push_command(SGL_CMD_UNIFORMBLOCKBINDING);
     pb_push(program);
     pb_push(uniformBlockIndex);
     pb_push(uniformBlockBinding);
@@ -4444,13 +5622,13 @@ void glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint unif
 
 void glProvokingVertex(GLenum mode)
 {
-    pb_push(SGL_CMD_PROVOKINGVERTEX);
+    glimpl_push_command(SGL_CMD_PROVOKINGVERTEX);
     pb_push(mode);
 }
 
 void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERTEXTURE);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERTEXTURE);
     pb_push(target);
     pb_push(attachment);
     pb_push(texture);
@@ -4459,14 +5637,14 @@ void glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLin
 
 void glSampleMaski(GLuint maskNumber, GLbitfield mask)
 {
-    pb_push(SGL_CMD_SAMPLEMASKI);
+    glimpl_push_command(SGL_CMD_SAMPLEMASKI);
     pb_push(maskNumber);
     pb_push(mask);
 }
 
 GLboolean glIsSampler(GLuint sampler)
 {
-    pb_push(SGL_CMD_ISSAMPLER);
+    glimpl_push_command(SGL_CMD_ISSAMPLER);
     pb_push(sampler);
 
     glimpl_submit();
@@ -4475,14 +5653,14 @@ GLboolean glIsSampler(GLuint sampler)
 
 void glBindSampler(GLuint unit, GLuint sampler)
 {
-    pb_push(SGL_CMD_BINDSAMPLER);
+    glimpl_push_command(SGL_CMD_BINDSAMPLER);
     pb_push(unit);
     pb_push(sampler);
 }
 
 void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_SAMPLERPARAMETERI);
+    glimpl_push_command(SGL_CMD_SAMPLERPARAMETERI);
     pb_push(sampler);
     pb_push(pname);
     pb_push(param);
@@ -4490,7 +5668,7 @@ void glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 
 void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_SAMPLERPARAMETERF);
+    glimpl_push_command(SGL_CMD_SAMPLERPARAMETERF);
     pb_push(sampler);
     pb_push(pname);
     pb_pushf(param);
@@ -4498,21 +5676,21 @@ void glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 
 void glQueryCounter(GLuint id, GLenum target)
 {
-    pb_push(SGL_CMD_QUERYCOUNTER);
+    glimpl_push_command(SGL_CMD_QUERYCOUNTER);
     pb_push(id);
     pb_push(target);
 }
 
 void glVertexAttribDivisor(GLuint index, GLuint divisor)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBDIVISOR);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBDIVISOR);
     pb_push(index);
     pb_push(divisor);
 }
 
 void glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP1UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBP1UI);
     pb_push(index);
     pb_push(type);
     pb_push(normalized);
@@ -4521,7 +5699,7 @@ void glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 
 void glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP2UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBP2UI);
     pb_push(index);
     pb_push(type);
     pb_push(normalized);
@@ -4530,7 +5708,7 @@ void glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 
 void glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP3UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBP3UI);
     pb_push(index);
     pb_push(type);
     pb_push(normalized);
@@ -4539,7 +5717,7 @@ void glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 
 void glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBP4UI);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBP4UI);
     pb_push(index);
     pb_push(type);
     pb_push(normalized);
@@ -4548,56 +5726,56 @@ void glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint
 
 void glVertexP2ui(GLenum type, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXP2UI);
+    glimpl_push_command(SGL_CMD_VERTEXP2UI);
     pb_push(type);
     pb_push(value);
 }
 
 void glVertexP3ui(GLenum type, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXP3UI);
+    glimpl_push_command(SGL_CMD_VERTEXP3UI);
     pb_push(type);
     pb_push(value);
 }
 
 void glVertexP4ui(GLenum type, GLuint value)
 {
-    pb_push(SGL_CMD_VERTEXP4UI);
+    glimpl_push_command(SGL_CMD_VERTEXP4UI);
     pb_push(type);
     pb_push(value);
 }
 
 void glTexCoordP1ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP1UI);
+    glimpl_push_command(SGL_CMD_TEXCOORDP1UI);
     pb_push(type);
     pb_push(coords);
 }
 
 void glTexCoordP2ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP2UI);
+    glimpl_push_command(SGL_CMD_TEXCOORDP2UI);
     pb_push(type);
     pb_push(coords);
 }
 
 void glTexCoordP3ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP3UI);
+    glimpl_push_command(SGL_CMD_TEXCOORDP3UI);
     pb_push(type);
     pb_push(coords);
 }
 
 void glTexCoordP4ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_TEXCOORDP4UI);
+    glimpl_push_command(SGL_CMD_TEXCOORDP4UI);
     pb_push(type);
     pb_push(coords);
 }
 
 void glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP1UI);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORDP1UI);
     pb_push(texture);
     pb_push(type);
     pb_push(coords);
@@ -4605,7 +5783,7 @@ void glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
 
 void glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP2UI);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORDP2UI);
     pb_push(texture);
     pb_push(type);
     pb_push(coords);
@@ -4613,7 +5791,7 @@ void glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
 
 void glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP3UI);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORDP3UI);
     pb_push(texture);
     pb_push(type);
     pb_push(coords);
@@ -4621,7 +5799,7 @@ void glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
 
 void glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_MULTITEXCOORDP4UI);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORDP4UI);
     pb_push(texture);
     pb_push(type);
     pb_push(coords);
@@ -4629,48 +5807,48 @@ void glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
 
 void glNormalP3ui(GLenum type, GLuint coords)
 {
-    pb_push(SGL_CMD_NORMALP3UI);
+    glimpl_push_command(SGL_CMD_NORMALP3UI);
     pb_push(type);
     pb_push(coords);
 }
 
 void glColorP3ui(GLenum type, GLuint color)
 {
-    pb_push(SGL_CMD_COLORP3UI);
+    glimpl_push_command(SGL_CMD_COLORP3UI);
     pb_push(type);
     pb_push(color);
 }
 
 void glColorP4ui(GLenum type, GLuint color)
 {
-    pb_push(SGL_CMD_COLORP4UI);
+    glimpl_push_command(SGL_CMD_COLORP4UI);
     pb_push(type);
     pb_push(color);
 }
 
 void glSecondaryColorP3ui(GLenum type, GLuint color)
 {
-    pb_push(SGL_CMD_SECONDARYCOLORP3UI);
+    glimpl_push_command(SGL_CMD_SECONDARYCOLORP3UI);
     pb_push(type);
     pb_push(color);
 }
 
 void glMinSampleShading(GLfloat value)
 {
-    pb_push(SGL_CMD_MINSAMPLESHADING);
+    glimpl_push_command(SGL_CMD_MINSAMPLESHADING);
     pb_pushf(value);
 }
 
 void glBlendEquationi(GLuint buf, GLenum mode)
 {
-    pb_push(SGL_CMD_BLENDEQUATIONI);
+    glimpl_push_command(SGL_CMD_BLENDEQUATIONI);
     pb_push(buf);
     pb_push(mode);
 }
 
 void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
-    pb_push(SGL_CMD_BLENDEQUATIONSEPARATEI);
+    glimpl_push_command(SGL_CMD_BLENDEQUATIONSEPARATEI);
     pb_push(buf);
     pb_push(modeRGB);
     pb_push(modeAlpha);
@@ -4678,7 +5856,7 @@ void glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 
 void glBlendFunci(GLuint buf, GLenum src, GLenum dst)
 {
-    pb_push(SGL_CMD_BLENDFUNCI);
+    glimpl_push_command(SGL_CMD_BLENDFUNCI);
     pb_push(buf);
     pb_push(src);
     pb_push(dst);
@@ -4686,7 +5864,7 @@ void glBlendFunci(GLuint buf, GLenum src, GLenum dst)
 
 void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
-    pb_push(SGL_CMD_BLENDFUNCSEPARATEI);
+    glimpl_push_command(SGL_CMD_BLENDFUNCSEPARATEI);
     pb_push(buf);
     pb_push(srcRGB);
     pb_push(dstRGB);
@@ -4696,14 +5874,14 @@ void glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAl
 
 void glUniform1d(GLint location, GLdouble x)
 {
-    pb_push(SGL_CMD_UNIFORM1D);
+    glimpl_push_command(SGL_CMD_UNIFORM1D);
     pb_push(location);
     pb_pushf(x);
 }
 
 void glUniform2d(GLint location, GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_UNIFORM2D);
+    glimpl_push_command(SGL_CMD_UNIFORM2D);
     pb_push(location);
     pb_pushf(x);
     pb_pushf(y);
@@ -4711,7 +5889,7 @@ void glUniform2d(GLint location, GLdouble x, GLdouble y)
 
 void glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_UNIFORM3D);
+    glimpl_push_command(SGL_CMD_UNIFORM3D);
     pb_push(location);
     pb_pushf(x);
     pb_pushf(y);
@@ -4720,7 +5898,7 @@ void glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z)
 
 void glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_UNIFORM4D);
+    glimpl_push_command(SGL_CMD_UNIFORM4D);
     pb_push(location);
     pb_pushf(x);
     pb_pushf(y);
@@ -4730,21 +5908,21 @@ void glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
 void glPatchParameteri(GLenum pname, GLint value)
 {
-    pb_push(SGL_CMD_PATCHPARAMETERI);
+    glimpl_push_command(SGL_CMD_PATCHPARAMETERI);
     pb_push(pname);
     pb_push(value);
 }
 
 void glBindTransformFeedback(GLenum target, GLuint id)
 {
-    pb_push(SGL_CMD_BINDTRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_BINDTRANSFORMFEEDBACK);
     pb_push(target);
     pb_push(id);
 }
 
 GLboolean glIsTransformFeedback(GLuint id)
 {
-    pb_push(SGL_CMD_ISTRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_ISTRANSFORMFEEDBACK);
     pb_push(id);
 
     glimpl_submit();
@@ -4753,24 +5931,24 @@ GLboolean glIsTransformFeedback(GLuint id)
 
 void glPauseTransformFeedback(void)
 {
-    pb_push(SGL_CMD_PAUSETRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_PAUSETRANSFORMFEEDBACK);
 }
 
 void glResumeTransformFeedback(void)
 {
-    pb_push(SGL_CMD_RESUMETRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_RESUMETRANSFORMFEEDBACK);
 }
 
 void glDrawTransformFeedback(GLenum mode, GLuint id)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACK);
+    glimpl_push_command(SGL_CMD_DRAWTRANSFORMFEEDBACK);
     pb_push(mode);
     pb_push(id);
 }
 
 void glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM);
+    glimpl_push_command(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM);
     pb_push(mode);
     pb_push(id);
     pb_push(stream);
@@ -4778,7 +5956,7 @@ void glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream)
 
 void glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
 {
-    pb_push(SGL_CMD_BEGINQUERYINDEXED);
+    glimpl_push_command(SGL_CMD_BEGINQUERYINDEXED);
     pb_push(target);
     pb_push(index);
     pb_push(id);
@@ -4786,32 +5964,35 @@ void glBeginQueryIndexed(GLenum target, GLuint index, GLuint id)
 
 void glEndQueryIndexed(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ENDQUERYINDEXED);
+    glimpl_push_command(SGL_CMD_ENDQUERYINDEXED);
     pb_push(target);
     pb_push(index);
 }
 
 void glReleaseShaderCompiler(void)
 {
-    pb_push(SGL_CMD_RELEASESHADERCOMPILER);
+    glimpl_push_command(SGL_CMD_RELEASESHADERCOMPILER);
 }
 
 void glDepthRangef(GLfloat n, GLfloat f)
 {
-    pb_push(SGL_CMD_DEPTHRANGEF);
+    glimpl_push_command(SGL_CMD_DEPTHRANGEF);
     pb_pushf(n);
     pb_pushf(f);
 }
 
 void glClearDepthf(GLfloat d)
 {
-    pb_push(SGL_CMD_CLEARDEPTHF);
+    glimpl_push_command(SGL_CMD_CLEARDEPTHF);
     pb_pushf(d);
+
+    GLfloat clamped = d < 0 ? 0 : d > 1 ? 1 : d;
+    state_set_floats(GL_DEPTH_CLEAR_VALUE, &clamped);
 }
 
 void glProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
-    pb_push(SGL_CMD_PROGRAMPARAMETERI);
+    glimpl_push_command(SGL_CMD_PROGRAMPARAMETERI);
     pb_push(program);
     pb_push(pname);
     pb_push(value);
@@ -4819,7 +6000,7 @@ void glProgramParameteri(GLuint program, GLenum pname, GLint value)
 
 void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
 {
-    pb_push(SGL_CMD_USEPROGRAMSTAGES);
+    glimpl_push_command(SGL_CMD_USEPROGRAMSTAGES);
     pb_push(pipeline);
     pb_push(stages);
     pb_push(program);
@@ -4827,20 +6008,20 @@ void glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
 
 void glActiveShaderProgram(GLuint pipeline, GLuint program)
 {
-    pb_push(SGL_CMD_ACTIVESHADERPROGRAM);
+    glimpl_push_command(SGL_CMD_ACTIVESHADERPROGRAM);
     pb_push(pipeline);
     pb_push(program);
 }
 
 void glBindProgramPipeline(GLuint pipeline)
 {
-    pb_push(SGL_CMD_BINDPROGRAMPIPELINE);
+    glimpl_push_command(SGL_CMD_BINDPROGRAMPIPELINE);
     pb_push(pipeline);
 }
 
 GLboolean glIsProgramPipeline(GLuint pipeline)
 {
-    pb_push(SGL_CMD_ISPROGRAMPIPELINE);
+    glimpl_push_command(SGL_CMD_ISPROGRAMPIPELINE);
     pb_push(pipeline);
 
     glimpl_submit();
@@ -4849,7 +6030,7 @@ GLboolean glIsProgramPipeline(GLuint pipeline)
 
 void glProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1I);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM1I);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4857,7 +6038,7 @@ void glProgramUniform1i(GLuint program, GLint location, GLint v0)
 
 void glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1F);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM1F);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4865,7 +6046,7 @@ void glProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 
 void glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1D);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM1D);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4873,7 +6054,7 @@ void glProgramUniform1d(GLuint program, GLint location, GLdouble v0)
 
 void glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM1UI);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM1UI);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4881,7 +6062,7 @@ void glProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 
 void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2I);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM2I);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4890,7 +6071,7 @@ void glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
 
 void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2F);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM2F);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4899,7 +6080,7 @@ void glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 
 void glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2D);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM2D);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4908,7 +6089,7 @@ void glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1
 
 void glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM2UI);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM2UI);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4917,7 +6098,7 @@ void glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
 
 void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3I);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM3I);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4927,7 +6108,7 @@ void glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLin
 
 void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3F);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM3F);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4937,7 +6118,7 @@ void glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1,
 
 void glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3D);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM3D);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4947,7 +6128,7 @@ void glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1
 
 void glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM3UI);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM3UI);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4957,7 +6138,7 @@ void glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, G
 
 void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4I);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM4I);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -4968,7 +6149,7 @@ void glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLin
 
 void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4F);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM4F);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4979,7 +6160,7 @@ void glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1,
 
 void glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4D);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM4D);
     pb_push(program);
     pb_push(location);
     pb_pushf(v0);
@@ -4990,7 +6171,7 @@ void glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1
 
 void glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
-    pb_push(SGL_CMD_PROGRAMUNIFORM4UI);
+    glimpl_push_command(SGL_CMD_PROGRAMUNIFORM4UI);
     pb_push(program);
     pb_push(location);
     pb_push(v0);
@@ -5001,20 +6182,20 @@ void glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, G
 
 void glValidateProgramPipeline(GLuint pipeline)
 {
-    pb_push(SGL_CMD_VALIDATEPROGRAMPIPELINE);
+    glimpl_push_command(SGL_CMD_VALIDATEPROGRAMPIPELINE);
     pb_push(pipeline);
 }
 
 void glVertexAttribL1d(GLuint index, GLdouble x)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL1D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBL1D);
     pb_push(index);
     pb_pushf(x);
 }
 
 void glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL2D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBL2D);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -5022,7 +6203,7 @@ void glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
 
 void glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL3D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBL3D);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -5031,7 +6212,7 @@ void glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
 
 void glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 {
-    pb_push(SGL_CMD_VERTEXATTRIBL4D);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIBL4D);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
@@ -5041,27 +6222,31 @@ void glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdoubl
 
 void glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
 {
-    pb_push(SGL_CMD_VIEWPORTINDEXEDF);
+    glimpl_push_command(SGL_CMD_VIEWPORTINDEXEDF);
     pb_push(index);
     pb_pushf(x);
     pb_pushf(y);
     pb_pushf(w);
     pb_pushf(h);
+
+    state_forget(GL_VIEWPORT);
 }
 
 void glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_SCISSORINDEXED);
+    glimpl_push_command(SGL_CMD_SCISSORINDEXED);
     pb_push(index);
     pb_push(left);
     pb_push(bottom);
     pb_push(width);
     pb_push(height);
+
+    state_forget(GL_SCISSOR_BOX);
 }
 
 void glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
 {
-    pb_push(SGL_CMD_DEPTHRANGEINDEXED);
+    glimpl_push_command(SGL_CMD_DEPTHRANGEINDEXED);
     pb_push(index);
     pb_pushf(n);
     pb_pushf(f);
@@ -5069,7 +6254,7 @@ void glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
 
 void glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)
 {
-    pb_push(SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE);
+    glimpl_push_command(SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE);
     pb_push(mode);
     pb_push(first);
     pb_push(count);
@@ -5079,7 +6264,7 @@ void glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count,
 
 void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
 {
-    pb_push(SGL_CMD_BINDIMAGETEXTURE);
+    glimpl_push_command(SGL_CMD_BINDIMAGETEXTURE);
     pb_push(unit);
     pb_push(texture);
     pb_push(level);
@@ -5091,13 +6276,13 @@ void glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean laye
 
 void glMemoryBarrier(GLbitfield barriers)
 {
-    pb_push(SGL_CMD_MEMORYBARRIER);
+    glimpl_push_command(SGL_CMD_MEMORYBARRIER);
     pb_push(barriers);
 }
 
 void glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
 {
-    pb_push(SGL_CMD_TEXSTORAGE1D);
+    glimpl_push_command(SGL_CMD_TEXSTORAGE1D);
     pb_push(target);
     pb_push(levels);
     pb_push(internalformat);
@@ -5106,7 +6291,7 @@ void glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 
 void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_TEXSTORAGE2D);
+    glimpl_push_command(SGL_CMD_TEXSTORAGE2D);
     pb_push(target);
     pb_push(levels);
     pb_push(internalformat);
@@ -5116,7 +6301,7 @@ void glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 
 void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
-    pb_push(SGL_CMD_TEXSTORAGE3D);
+    glimpl_push_command(SGL_CMD_TEXSTORAGE3D);
     pb_push(target);
     pb_push(levels);
     pb_push(internalformat);
@@ -5127,7 +6312,7 @@ void glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsize
 
 void glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED);
+    glimpl_push_command(SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED);
     pb_push(mode);
     pb_push(id);
     pb_push(instancecount);
@@ -5135,7 +6320,7 @@ void glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instanceco
 
 void glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount)
 {
-    pb_push(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED);
+    glimpl_push_command(SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED);
     pb_push(mode);
     pb_push(id);
     pb_push(stream);
@@ -5144,13 +6329,13 @@ void glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint strea
 
 void glDispatchComputeIndirect(GLintptr indirect)
 {
-    pb_push(SGL_CMD_DISPATCHCOMPUTEINDIRECT);
+    glimpl_push_command(SGL_CMD_DISPATCHCOMPUTEINDIRECT);
     pb_push(indirect);
 }
 
 void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
 {
-    pb_push(SGL_CMD_COPYIMAGESUBDATA);
+    glimpl_push_command(SGL_CMD_COPYIMAGESUBDATA);
     pb_push(srcName);
     pb_push(srcTarget);
     pb_push(srcLevel);
@@ -5170,7 +6355,7 @@ void glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint
 
 void glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_FRAMEBUFFERPARAMETERI);
+    glimpl_push_command(SGL_CMD_FRAMEBUFFERPARAMETERI);
     pb_push(target);
     pb_push(pname);
     pb_push(param);
@@ -5178,7 +6363,7 @@ void glFramebufferParameteri(GLenum target, GLenum pname, GLint param)
 
 void glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
 {
-    pb_push(SGL_CMD_INVALIDATETEXSUBIMAGE);
+    glimpl_push_command(SGL_CMD_INVALIDATETEXSUBIMAGE);
     pb_push(texture);
     pb_push(level);
     pb_push(xoffset);
@@ -5191,14 +6376,14 @@ void glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint y
 
 void glInvalidateTexImage(GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_INVALIDATETEXIMAGE);
+    glimpl_push_command(SGL_CMD_INVALIDATETEXIMAGE);
     pb_push(texture);
     pb_push(level);
 }
 
 void glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length)
 {
-    pb_push(SGL_CMD_INVALIDATEBUFFERSUBDATA);
+    glimpl_push_command(SGL_CMD_INVALIDATEBUFFERSUBDATA);
     pb_push(buffer);
     pb_push(offset);
     pb_push(length);
@@ -5206,13 +6391,13 @@ void glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length
 
 void glInvalidateBufferData(GLuint buffer)
 {
-    pb_push(SGL_CMD_INVALIDATEBUFFERDATA);
+    glimpl_push_command(SGL_CMD_INVALIDATEBUFFERDATA);
     pb_push(buffer);
 }
 
 void glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
 {
-    pb_push(SGL_CMD_SHADERSTORAGEBLOCKBINDING);
+    glimpl_push_command(SGL_CMD_SHADERSTORAGEBLOCKBINDING);
     pb_push(program);
     pb_push(storageBlockIndex);
     pb_push(storageBlockBinding);
@@ -5220,7 +6405,7 @@ void glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuin
 
 void glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_TEXBUFFERRANGE);
+    glimpl_push_command(SGL_CMD_TEXBUFFERRANGE);
     pb_push(target);
     pb_push(internalformat);
     pb_push(buffer);
@@ -5230,7 +6415,7 @@ void glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLint
 
 void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXSTORAGE2DMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_TEXSTORAGE2DMULTISAMPLE);
     pb_push(target);
     pb_push(samples);
     pb_push(internalformat);
@@ -5241,7 +6426,7 @@ void glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalfo
 
 void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXSTORAGE3DMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_TEXSTORAGE3DMULTISAMPLE);
     pb_push(target);
     pb_push(samples);
     pb_push(internalformat);
@@ -5253,7 +6438,7 @@ void glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalfo
 
 void glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
 {
-    pb_push(SGL_CMD_TEXTUREVIEW);
+    glimpl_push_command(SGL_CMD_TEXTUREVIEW);
     pb_push(texture);
     pb_push(target);
     pb_push(origtexture);
@@ -5266,6 +6451,8 @@ void glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum int
 
 void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_BINDVERTEXBUFFER);
     pb_push(bindingindex);
     pb_push(buffer);
@@ -5275,6 +6462,8 @@ void glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLs
 
 void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXATTRIBFORMAT);
     pb_push(attribindex);
     pb_push(size);
@@ -5285,6 +6474,8 @@ void glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean
 
 void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXATTRIBIFORMAT);
     pb_push(attribindex);
     pb_push(size);
@@ -5294,6 +6485,8 @@ void glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint r
 
 void glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXATTRIBLFORMAT);
     pb_push(attribindex);
     pb_push(size);
@@ -5303,6 +6496,8 @@ void glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint r
 
 void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXATTRIBBINDING);
     pb_push(attribindex);
     pb_push(bindingindex);
@@ -5310,26 +6505,26 @@ void glVertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 
 void glVertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
-    pb_push(SGL_CMD_VERTEXBINDINGDIVISOR);
+    glimpl_push_command(SGL_CMD_VERTEXBINDINGDIVISOR);
     pb_push(bindingindex);
     pb_push(divisor);
 }
 
 void glPopDebugGroup(void)
 {
-    pb_push(SGL_CMD_POPDEBUGGROUP);
+    glimpl_push_command(SGL_CMD_POPDEBUGGROUP);
 }
 
 void glClipControl(GLenum origin, GLenum depth)
 {
-    pb_push(SGL_CMD_CLIPCONTROL);
+    glimpl_push_command(SGL_CMD_CLIPCONTROL);
     pb_push(origin);
     pb_push(depth);
 }
 
 void glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
 {
-    pb_push(SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE);
+    glimpl_push_command(SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE);
     pb_push(xfb);
     pb_push(index);
     pb_push(buffer);
@@ -5337,7 +6532,7 @@ void glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer)
 
 void glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE);
+    glimpl_push_command(SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE);
     pb_push(xfb);
     pb_push(index);
     pb_push(buffer);
@@ -5347,7 +6542,7 @@ void glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLi
 
 void glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_COPYNAMEDBUFFERSUBDATA);
+    glimpl_push_command(SGL_CMD_COPYNAMEDBUFFERSUBDATA);
     pb_push(readBuffer);
     pb_push(writeBuffer);
     pb_push(readOffset);
@@ -5367,7 +6562,7 @@ void glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr le
 
 void glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER);
     pb_push(framebuffer);
     pb_push(attachment);
     pb_push(renderbuffertarget);
@@ -5376,7 +6571,7 @@ void glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenu
 
 void glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI);
     pb_push(framebuffer);
     pb_push(pname);
     pb_push(param);
@@ -5384,7 +6579,7 @@ void glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param)
 
 void glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERTEXTURE);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERTEXTURE);
     pb_push(framebuffer);
     pb_push(attachment);
     pb_push(texture);
@@ -5393,7 +6588,7 @@ void glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint tex
 
 void glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER);
     pb_push(framebuffer);
     pb_push(attachment);
     pb_push(texture);
@@ -5403,21 +6598,21 @@ void glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuin
 
 void glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER);
     pb_push(framebuffer);
     pb_push(buf);
 }
 
 void glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER);
     pb_push(framebuffer);
     pb_push(src);
 }
 
 void glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
 {
-    pb_push(SGL_CMD_CLEARNAMEDFRAMEBUFFERFI);
+    glimpl_push_command(SGL_CMD_CLEARNAMEDFRAMEBUFFERFI);
     pb_push(framebuffer);
     pb_push(buffer);
     pb_push(drawbuffer);
@@ -5427,7 +6622,7 @@ void glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuff
 
 void glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
 {
-    pb_push(SGL_CMD_BLITNAMEDFRAMEBUFFER);
+    glimpl_push_command(SGL_CMD_BLITNAMEDFRAMEBUFFER);
     pb_push(readFramebuffer);
     pb_push(drawFramebuffer);
     pb_push(srcX0);
@@ -5444,7 +6639,7 @@ void glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLin
 
 GLenum glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
 {
-    pb_push(SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS);
+    glimpl_push_command(SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS);
     pb_push(framebuffer);
     pb_push(target);
 
@@ -5454,7 +6649,7 @@ GLenum glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
 
 void glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_NAMEDRENDERBUFFERSTORAGE);
+    glimpl_push_command(SGL_CMD_NAMEDRENDERBUFFERSTORAGE);
     pb_push(renderbuffer);
     pb_push(internalformat);
     pb_push(width);
@@ -5463,7 +6658,7 @@ void glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsi
 
 void glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE);
     pb_push(renderbuffer);
     pb_push(samples);
     pb_push(internalformat);
@@ -5473,7 +6668,7 @@ void glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples,
 
 void glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
 {
-    pb_push(SGL_CMD_TEXTUREBUFFER);
+    glimpl_push_command(SGL_CMD_TEXTUREBUFFER);
     pb_push(texture);
     pb_push(internalformat);
     pb_push(buffer);
@@ -5481,7 +6676,7 @@ void glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer)
 
 void glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
-    pb_push(SGL_CMD_TEXTUREBUFFERRANGE);
+    glimpl_push_command(SGL_CMD_TEXTUREBUFFERRANGE);
     pb_push(texture);
     pb_push(internalformat);
     pb_push(buffer);
@@ -5491,7 +6686,7 @@ void glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer,
 
 void glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE1D);
+    glimpl_push_command(SGL_CMD_TEXTURESTORAGE1D);
     pb_push(texture);
     pb_push(levels);
     pb_push(internalformat);
@@ -5500,7 +6695,7 @@ void glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, G
 
 void glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE2D);
+    glimpl_push_command(SGL_CMD_TEXTURESTORAGE2D);
     pb_push(texture);
     pb_push(levels);
     pb_push(internalformat);
@@ -5510,7 +6705,7 @@ void glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, G
 
 void glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE3D);
+    glimpl_push_command(SGL_CMD_TEXTURESTORAGE3D);
     pb_push(texture);
     pb_push(levels);
     pb_push(internalformat);
@@ -5521,7 +6716,7 @@ void glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, G
 
 void glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE);
     pb_push(texture);
     pb_push(samples);
     pb_push(internalformat);
@@ -5532,7 +6727,7 @@ void glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum inter
 
 void glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
 {
-    pb_push(SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE);
+    glimpl_push_command(SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE);
     pb_push(texture);
     pb_push(samples);
     pb_push(internalformat);
@@ -5544,7 +6739,7 @@ void glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum inter
 
 void glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
 {
-    pb_push(SGL_CMD_COPYTEXTURESUBIMAGE1D);
+    glimpl_push_command(SGL_CMD_COPYTEXTURESUBIMAGE1D);
     pb_push(texture);
     pb_push(level);
     pb_push(xoffset);
@@ -5555,7 +6750,7 @@ void glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x
 
 void glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXTURESUBIMAGE2D);
+    glimpl_push_command(SGL_CMD_COPYTEXTURESUBIMAGE2D);
     pb_push(texture);
     pb_push(level);
     pb_push(xoffset);
@@ -5568,7 +6763,7 @@ void glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint y
 
 void glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    pb_push(SGL_CMD_COPYTEXTURESUBIMAGE3D);
+    glimpl_push_command(SGL_CMD_COPYTEXTURESUBIMAGE3D);
     pb_push(texture);
     pb_push(level);
     pb_push(xoffset);
@@ -5582,7 +6777,7 @@ void glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint y
 
 void glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
 {
-    pb_push(SGL_CMD_TEXTUREPARAMETERF);
+    glimpl_push_command(SGL_CMD_TEXTUREPARAMETERF);
     pb_push(texture);
     pb_push(pname);
     pb_pushf(param);
@@ -5590,7 +6785,7 @@ void glTextureParameterf(GLuint texture, GLenum pname, GLfloat param)
 
 void glTextureParameteri(GLuint texture, GLenum pname, GLint param)
 {
-    pb_push(SGL_CMD_TEXTUREPARAMETERI);
+    glimpl_push_command(SGL_CMD_TEXTUREPARAMETERI);
     pb_push(texture);
     pb_push(pname);
     pb_push(param);
@@ -5598,40 +6793,44 @@ void glTextureParameteri(GLuint texture, GLenum pname, GLint param)
 
 void glGenerateTextureMipmap(GLuint texture)
 {
-    pb_push(SGL_CMD_GENERATETEXTUREMIPMAP);
+    glimpl_push_command(SGL_CMD_GENERATETEXTUREMIPMAP);
     pb_push(texture);
 }
 
 void glBindTextureUnit(GLuint unit, GLuint texture)
 {
-    pb_push(SGL_CMD_BINDTEXTUREUNIT);
+    glimpl_push_command(SGL_CMD_BINDTEXTUREUNIT);
     pb_push(unit);
     pb_push(texture);
+
+    state_bind_textures_unknown();
 }
 
 void glDisableVertexArrayAttrib(GLuint vaobj, GLuint index)
 {
-    pb_push(SGL_CMD_DISABLEVERTEXARRAYATTRIB);
+    glimpl_push_command(SGL_CMD_DISABLEVERTEXARRAYATTRIB);
     pb_push(vaobj);
     pb_push(index);
 }
 
 void glEnableVertexArrayAttrib(GLuint vaobj, GLuint index)
 {
-    pb_push(SGL_CMD_ENABLEVERTEXARRAYATTRIB);
+    glimpl_push_command(SGL_CMD_ENABLEVERTEXARRAYATTRIB);
     pb_push(vaobj);
     pb_push(index);
 }
 
 void glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
 {
-    pb_push(SGL_CMD_VERTEXARRAYELEMENTBUFFER);
+    glimpl_push_command(SGL_CMD_VERTEXARRAYELEMENTBUFFER);
     pb_push(vaobj);
     pb_push(buffer);
 }
 
 void glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXARRAYVERTEXBUFFER);
     pb_push(vaobj);
     pb_push(bindingindex);
@@ -5642,6 +6841,8 @@ void glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer,
 
 void glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXARRAYATTRIBBINDING);
     pb_push(vaobj);
     pb_push(attribindex);
@@ -5650,6 +6851,8 @@ void glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint binding
 
 void glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXARRAYATTRIBFORMAT);
     pb_push(vaobj);
     pb_push(attribindex);
@@ -5661,6 +6864,8 @@ void glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLe
 
 void glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXARRAYATTRIBIFORMAT);
     pb_push(vaobj);
     pb_push(attribindex);
@@ -5671,6 +6876,8 @@ void glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GL
 
 void glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXARRAYATTRIBLFORMAT);
     pb_push(vaobj);
     pb_push(attribindex);
@@ -5681,7 +6888,7 @@ void glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GL
 
 void glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor)
 {
-    pb_push(SGL_CMD_VERTEXARRAYBINDINGDIVISOR);
+    glimpl_push_command(SGL_CMD_VERTEXARRAYBINDINGDIVISOR);
     pb_push(vaobj);
     pb_push(bindingindex);
     pb_push(divisor);
@@ -5689,7 +6896,7 @@ void glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divis
 
 void glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTI64V);
+    glimpl_push_command(SGL_CMD_GETQUERYBUFFEROBJECTI64V);
     pb_push(id);
     pb_push(buffer);
     pb_push(pname);
@@ -5698,7 +6905,7 @@ void glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr
 
 void glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTIV);
+    glimpl_push_command(SGL_CMD_GETQUERYBUFFEROBJECTIV);
     pb_push(id);
     pb_push(buffer);
     pb_push(pname);
@@ -5707,7 +6914,7 @@ void glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr o
 
 void glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTUI64V);
+    glimpl_push_command(SGL_CMD_GETQUERYBUFFEROBJECTUI64V);
     pb_push(id);
     pb_push(buffer);
     pb_push(pname);
@@ -5716,7 +6923,7 @@ void glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintpt
 
 void glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
 {
-    pb_push(SGL_CMD_GETQUERYBUFFEROBJECTUIV);
+    glimpl_push_command(SGL_CMD_GETQUERYBUFFEROBJECTUIV);
     pb_push(id);
     pb_push(buffer);
     pb_push(pname);
@@ -5725,13 +6932,13 @@ void glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr
 
 void glMemoryBarrierByRegion(GLbitfield barriers)
 {
-    pb_push(SGL_CMD_MEMORYBARRIERBYREGION);
+    glimpl_push_command(SGL_CMD_MEMORYBARRIERBYREGION);
     pb_push(barriers);
 }
 
 GLenum glGetGraphicsResetStatus(void)
 {
-    pb_push(SGL_CMD_GETGRAPHICSRESETSTATUS);
+    glimpl_push_command(SGL_CMD_GETGRAPHICSRESETSTATUS);
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -5739,12 +6946,12 @@ GLenum glGetGraphicsResetStatus(void)
 
 void glTextureBarrier(void)
 {
-    pb_push(SGL_CMD_TEXTUREBARRIER);
+    glimpl_push_command(SGL_CMD_TEXTUREBARRIER);
 }
 
 void glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp)
 {
-    pb_push(SGL_CMD_POLYGONOFFSETCLAMP);
+    glimpl_push_command(SGL_CMD_POLYGONOFFSETCLAMP);
     pb_pushf(factor);
     pb_pushf(units);
     pb_pushf(clamp);
@@ -6732,7 +7939,7 @@ void glTexGeniv(GLenum coord, GLenum pname, const GLint* params)
 
 void glFeedbackBuffer(GLsizei size, GLenum type, GLfloat* buffer)
 {
-    pb_push(SGL_CMD_FEEDBACKBUFFER);
+    glimpl_push_command(SGL_CMD_FEEDBACKBUFFER);
     pb_push(size);
     pb_push(type);
 
@@ -6742,7 +7949,7 @@ void glFeedbackBuffer(GLsizei size, GLenum type, GLfloat* buffer)
 
 void glSelectBuffer(GLsizei size, GLuint* buffer)
 {
-    pb_push(SGL_CMD_SELECTBUFFER);
+    glimpl_push_command(SGL_CMD_SELECTBUFFER);
     pb_push(size);
 
     glimpl_submit();
@@ -6751,7 +7958,9 @@ void glSelectBuffer(GLsizei size, GLuint* buffer)
 
 void glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble* points)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    if (!glimpl_push_command_sized(SGL_CMD_VP_UPLOAD, order * sizeof(int)))
+        return;
+
     pb_push(order);
     for (int i = 0; i < order; i++)
         pb_pushf(points[i * stride]);
@@ -6766,7 +7975,9 @@ void glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order,
 
 void glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat* points)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    if (!glimpl_push_command_sized(SGL_CMD_VP_UPLOAD, order * sizeof(int)))
+        return;
+
     pb_push(order);
     for (int i = 0; i < order; i++)
         pb_pushf(points[i * stride]);
@@ -6799,10 +8010,7 @@ void glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder,
 
 void glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat* values)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(mapsize);
-    for (int i = 0; i < mapsize; i++)
-        pb_pushf(values[i]);
+    glimpl_upload_buffer(values, mapsize * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PIXELMAPFV);
     pb_push(map);
@@ -6811,10 +8019,7 @@ void glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat* values)
 
 void glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint* values)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(mapsize);
-    for (int i = 0; i < mapsize; i++)
-        pb_push(values[i]);
+    glimpl_upload_buffer(values, mapsize * sizeof(GLuint));
 
     pb_push(SGL_CMD_PIXELMAPUIV);
     pb_push(map);
@@ -6823,7 +8028,9 @@ void glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint* values)
 
 void glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort* values)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    if (!glimpl_push_command_sized(SGL_CMD_VP_UPLOAD, mapsize * sizeof(int)))
+        return;
+
     pb_push(mapsize);
     for (int i = 0; i < mapsize; i++)
         pb_push(values[i]);
@@ -6840,7 +8047,7 @@ void glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, con
 
 void glGetClipPlane(GLenum plane, GLdouble* equation)
 {
-    pb_push(SGL_CMD_GETCLIPPLANE);
+    glimpl_push_command(SGL_CMD_GETCLIPPLANE);
     pb_push(plane);
     pb_push(0); /* is dst float? */
 
@@ -6850,7 +8057,7 @@ void glGetClipPlane(GLenum plane, GLdouble* equation)
 
 void glGetClipPlanef(GLenum plane, GLfloat* equation)
 {
-    pb_push(SGL_CMD_GETCLIPPLANE);
+    glimpl_push_command(SGL_CMD_GETCLIPPLANE);
     pb_push(plane);
     pb_push(1); /* is dst float? */
 
@@ -6987,7 +8194,7 @@ void glGetPolygonStipple(GLubyte* mask)
 
 void glGetTexEnvfv(GLenum target, GLenum pname, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETTEXENVFV);
+    glimpl_push_command(SGL_CMD_GETTEXENVFV);
     pb_push(target);
     pb_push(pname);
     
@@ -6997,7 +8204,7 @@ void glGetTexEnvfv(GLenum target, GLenum pname, GLfloat* params)
 
 void glGetTexEnviv(GLenum target, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETTEXENVIV);
+    glimpl_push_command(SGL_CMD_GETTEXENVIV);
     pb_push(target);
     pb_push(pname);
     
@@ -7007,7 +8214,7 @@ void glGetTexEnviv(GLenum target, GLenum pname, GLint* params)
 
 void glGetTexGendv(GLenum coord, GLenum pname, GLdouble* params)
 {
-    pb_push(SGL_CMD_GETTEXGENDV);
+    glimpl_push_command(SGL_CMD_GETTEXGENDV);
     pb_push(coord);
     pb_push(pname);
     
@@ -7017,7 +8224,7 @@ void glGetTexGendv(GLenum coord, GLenum pname, GLdouble* params)
 
 void glGetTexGenfv(GLenum coord, GLenum pname, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETTEXGENFV);
+    glimpl_push_command(SGL_CMD_GETTEXGENFV);
     pb_push(coord);
     pb_push(pname);
     
@@ -7027,7 +8234,7 @@ void glGetTexGenfv(GLenum coord, GLenum pname, GLfloat* params)
 
 void glGetTexGeniv(GLenum coord, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETTEXGENIV);
+    glimpl_push_command(SGL_CMD_GETTEXGENIV);
     pb_push(coord);
     pb_push(pname);
     
@@ -7128,7 +8335,7 @@ GLboolean glAreTexturesResident(GLsizei n, const GLuint* textures, GLboolean* re
     GLboolean *p = residences;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_ARETEXTURESRESIDENT);
+        glimpl_push_command(SGL_CMD_ARETEXTURESRESIDENT);
         pb_push(textures[i]);
 
         glimpl_submit();
@@ -7143,7 +8350,7 @@ GLboolean glAreTexturesResident(GLsizei n, const GLuint* textures, GLboolean* re
 void glPrioritizeTextures(GLsizei n, const GLuint* textures, const GLfloat* priorities)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_PRIORITIZETEXTURES);
+        glimpl_push_command(SGL_CMD_PRIORITIZETEXTURES);
         pb_push(textures[i]);
         pb_pushf(priorities[i]);
     }
@@ -7151,11 +8358,7 @@ void glPrioritizeTextures(GLsizei n, const GLuint* textures, const GLfloat* prio
 
 void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data)
 {
-    glimpl_submit();
-
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(imageSize / 4);
-    pb_memcpy((void*)data, imageSize);
+    glimpl_upload_buffer(data, imageSize);
 
     pb_push(SGL_CMD_COMPRESSEDTEXIMAGE3D);
     pb_push(target);
@@ -7172,11 +8375,7 @@ void glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, G
 
 void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data)
 {
-    glimpl_submit();
-
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(imageSize / 4);
-    pb_memcpy((void*)data, imageSize);
+    glimpl_upload_buffer(data, imageSize);
 
     pb_push(SGL_CMD_COMPRESSEDTEXIMAGE2D);
     pb_push(target);
@@ -7192,11 +8391,7 @@ void glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, G
 
 void glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void* data)
 {
-    glimpl_submit();
-
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(imageSize / 4);
-    pb_memcpy((void*)data, imageSize);
+    glimpl_upload_buffer(data, imageSize);
 
     pb_push(SGL_CMD_COMPRESSEDTEXIMAGE1D);
     pb_push(target);
@@ -7237,30 +8432,44 @@ void glGetCompressedTexImage(GLenum target, GLint level, void* img)
 
 void glLoadTransposeMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_LOADTRANSPOSEMATRIXF);
+    glimpl_push_command(SGL_CMD_LOADTRANSPOSEMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    state_load_transpose_matrix(m);
 }
 
 void glLoadTransposeMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_LOADTRANSPOSEMATRIXF);
+    glimpl_push_command(SGL_CMD_LOADTRANSPOSEMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    GLfloat mf[16];
+    for (int i = 0; i < 16; i++)
+        mf[i] = m[i];
+    state_load_transpose_matrix(mf);
 }
 
 void glMultTransposeMatrixf(const GLfloat* m)
 {
-    pb_push(SGL_CMD_MULTTRANSPOSEMATRIXF);
+    glimpl_push_command(SGL_CMD_MULTTRANSPOSEMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    state_mult_transpose_matrix(m);
 }
 
 void glMultTransposeMatrixd(const GLdouble* m)
 {
-    pb_push(SGL_CMD_MULTTRANSPOSEMATRIXF);
+    glimpl_push_command(SGL_CMD_MULTTRANSPOSEMATRIXF);
     for (int i = 0; i < 16; i++)
         pb_pushf(m[i]);
+
+    GLfloat mf[16];
+    for (int i = 0; i < 16; i++)
+        mf[i] = m[i];
+    state_mult_transpose_matrix(mf);
 }
 
 void glMultiDrawArrays(GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount)
@@ -7298,14 +8507,15 @@ void glFogCoorddv(const GLdouble* coord)
 void glDeleteQueries(GLsizei n, const GLuint* ids)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEQUERIES);
+        glimpl_push_command(SGL_CMD_DELETEQUERIES);
         pb_push(ids[i]);
+        names_free(NAMES_QUERY, ids[i]);
     }
 }
 
 void glGetQueryiv(GLenum target, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETQUERYIV);
+    glimpl_push_command(SGL_CMD_GETQUERYIV);
     pb_push(target);
     pb_push(pname);
 
@@ -7315,7 +8525,7 @@ void glGetQueryiv(GLenum target, GLenum pname, GLint* params)
 
 void glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETQUERYOBJECTIV);
+    glimpl_push_command(SGL_CMD_GETQUERYOBJECTIV);
     pb_push(id);
     pb_push(pname);
 
@@ -7325,7 +8535,7 @@ void glGetQueryObjectiv(GLuint id, GLenum pname, GLint* params)
 
 void glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params)
 {
-    pb_push(SGL_CMD_GETQUERYOBJECTUIV);
+    glimpl_push_command(SGL_CMD_GETQUERYOBJECTUIV);
     pb_push(id);
     pb_push(pname);
 
@@ -7360,7 +8570,7 @@ void glGetBufferPointerv(GLenum target, GLenum pname, void* *params)
 
 void glDrawBuffers(GLsizei n, const GLenum* bufs)
 {
-    pb_push(SGL_CMD_DRAWBUFFERS);
+    glimpl_push_command(SGL_CMD_DRAWBUFFERS);
     pb_push(n);
     for (int i = 0; i < n; i++)
         pb_push(bufs[i]);
@@ -7368,7 +8578,9 @@ void glDrawBuffers(GLsizei n, const GLenum* bufs)
 
 void glBindAttribLocation(GLuint program, GLuint index, const GLchar* name)
 {
-    pb_push(SGL_CMD_BINDATTRIBLOCATION);
+    if (!glimpl_push_command_sized(SGL_CMD_BINDATTRIBLOCATION, push_string_size(name)))
+        return;
+
     pb_push(program);
     pb_push(index);
     push_string(name);
@@ -7376,7 +8588,7 @@ void glBindAttribLocation(GLuint program, GLuint index, const GLchar* name)
 
 void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVEATTRIB);
+    glimpl_push_command(SGL_CMD_GETACTIVEATTRIB);
     pb_push(program);
     pb_push(index);
     pb_push(512); /* bufSize */
@@ -7394,7 +8606,7 @@ void glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei* l
 
 void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORM);
+    glimpl_push_command(SGL_CMD_GETACTIVEUNIFORM);
     pb_push(program);
     pb_push(index);
     pb_push(512); /* bufSize */
@@ -7412,7 +8624,7 @@ void glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei*
 
 void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders)
 {
-    pb_push(SGL_CMD_GETATTACHEDSHADERS);
+    glimpl_push_command(SGL_CMD_GETATTACHEDSHADERS);
     pb_push(program);
     pb_push(128); /* maxCount */
 
@@ -7427,7 +8639,7 @@ void glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei* count, GLui
 
 void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
 {
-    pb_push(SGL_CMD_GETPROGRAMINFOLOG);
+    glimpl_push_command(SGL_CMD_GETPROGRAMINFOLOG);
     pb_push(program);
     pb_push(512); /* bufSize */
 
@@ -7442,7 +8654,7 @@ void glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei* length, GLcha
 
 void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
 {
-    pb_push(SGL_CMD_GETSHADERINFOLOG);
+    glimpl_push_command(SGL_CMD_GETSHADERINFOLOG);
     pb_push(shader);
     pb_push(512); /* bufSize */
 
@@ -7457,7 +8669,7 @@ void glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar*
 
 void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source)
 {
-    pb_push(SGL_CMD_GETSHADERSOURCE);
+    glimpl_push_command(SGL_CMD_GETSHADERSOURCE);
     pb_push(shader);
     pb_push(3072); /* bufSize */
 
@@ -7472,7 +8684,7 @@ void glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar*
 
 void glGetUniformfv(GLuint program, GLint location, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMFV);
+    glimpl_push_command(SGL_CMD_GETUNIFORMFV);
     pb_push(program);
     pb_push(location);
 
@@ -7482,7 +8694,7 @@ void glGetUniformfv(GLuint program, GLint location, GLfloat* params)
 
 void glGetUniformiv(GLuint program, GLint location, GLint* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMIV);
+    glimpl_push_command(SGL_CMD_GETUNIFORMIV);
     pb_push(program);
     pb_push(location);
 
@@ -7492,7 +8704,7 @@ void glGetUniformiv(GLuint program, GLint location, GLint* params)
 
 void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble* params)
 {
-    pb_push(SGL_CMD_GETVERTEXATTRIBDV);
+    glimpl_push_command(SGL_CMD_GETVERTEXATTRIBDV);
     pb_push(index);
     pb_push(pname);
 
@@ -7502,7 +8714,7 @@ void glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble* params)
 
 void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat* params)
 {
-    pb_push(SGL_CMD_GETVERTEXATTRIBFV);
+    glimpl_push_command(SGL_CMD_GETVERTEXATTRIBFV);
     pb_push(index);
     pb_push(pname);
 
@@ -7512,7 +8724,7 @@ void glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat* params)
 
 void glGetVertexAttribiv(GLuint index, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETVERTEXATTRIBIV);
+    glimpl_push_command(SGL_CMD_GETVERTEXATTRIBIV);
     pb_push(index);
     pb_push(pname);
 
@@ -7527,10 +8739,7 @@ void glGetVertexAttribPointerv(GLuint index, GLenum pname, void* *pointer)
 
 void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 2);
-    for (int i = 0; i < count * 2 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 2 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX2FV);
     pb_push(location);
@@ -7540,10 +8749,7 @@ void glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, cons
 
 void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 3);
-    for (int i = 0; i < count * 3 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 3 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX3FV);
     pb_push(location);
@@ -7553,7 +8759,7 @@ void glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, cons
 
 void glVertexAttrib4Nbv(GLuint index, const GLbyte* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NBV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4NBV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7563,7 +8769,7 @@ void glVertexAttrib4Nbv(GLuint index, const GLbyte* v)
 
 void glVertexAttrib4Niv(GLuint index, const GLint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NIV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4NIV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7573,7 +8779,7 @@ void glVertexAttrib4Niv(GLuint index, const GLint* v)
 
 void glVertexAttrib4Nsv(GLuint index, const GLshort* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NSV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4NSV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7583,7 +8789,7 @@ void glVertexAttrib4Nsv(GLuint index, const GLshort* v)
 
 void glVertexAttrib4Nuiv(GLuint index, const GLuint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NUIV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4NUIV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7593,7 +8799,7 @@ void glVertexAttrib4Nuiv(GLuint index, const GLuint* v)
 
 void glVertexAttrib4Nusv(GLuint index, const GLushort* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4NUSV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4NUSV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7603,7 +8809,7 @@ void glVertexAttrib4Nusv(GLuint index, const GLushort* v)
 
 void glVertexAttrib4bv(GLuint index, const GLbyte* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4BV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4BV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7613,7 +8819,7 @@ void glVertexAttrib4bv(GLuint index, const GLbyte* v)
 
 void glVertexAttrib4iv(GLuint index, const GLint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4IV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4IV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7623,7 +8829,7 @@ void glVertexAttrib4iv(GLuint index, const GLint* v)
 
 void glVertexAttrib4ubv(GLuint index, const GLubyte* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4UBV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4UBV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7633,7 +8839,7 @@ void glVertexAttrib4ubv(GLuint index, const GLubyte* v)
 
 void glVertexAttrib4uiv(GLuint index, const GLuint* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4UIV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4UIV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7643,7 +8849,7 @@ void glVertexAttrib4uiv(GLuint index, const GLuint* v)
 
 void glVertexAttrib4usv(GLuint index, const GLushort* v)
 {
-    pb_push(SGL_CMD_VERTEXATTRIB4USV);
+    glimpl_push_command(SGL_CMD_VERTEXATTRIB4USV);
     pb_push(index);
     pb_push(v[0]);
     pb_push(v[1]);
@@ -7653,10 +8859,7 @@ void glVertexAttrib4usv(GLuint index, const GLushort* v)
 
 void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 3);
-    for (int i = 0; i < count * 2 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 3 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX2X3FV);
     pb_push(location);
@@ -7666,10 +8869,7 @@ void glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 2);
-    for (int i = 0; i < count * 3 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 2 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX3X2FV);
     pb_push(location);
@@ -7679,10 +8879,7 @@ void glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 4);
-    for (int i = 0; i < count * 2 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX2X4FV);
     pb_push(location);
@@ -7692,10 +8889,7 @@ void glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 4);
-    for (int i = 0; i < count * 2 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX4X2FV);
     pb_push(location);
@@ -7705,10 +8899,7 @@ void glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 4);
-    for (int i = 0; i < count * 3 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX3X4FV);
     pb_push(location);
@@ -7718,10 +8909,7 @@ void glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 4);
-    for (int i = 0; i < count * 3 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_UNIFORMMATRIX4X3FV);
     pb_push(location);
@@ -7731,7 +8919,7 @@ void glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint* value)
 {
-    pb_push(SGL_CMD_CLEARBUFFERIV);
+    glimpl_push_command(SGL_CMD_CLEARBUFFERIV);
     pb_push(buffer);
     pb_push(drawbuffer);
     
@@ -7753,7 +8941,7 @@ void glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat* value)
 
 void glGetBooleani_v(GLenum target, GLuint index, GLboolean* data)
 {
-    pb_push(SGL_CMD_GETBOOLEANI_V);
+    glimpl_push_command(SGL_CMD_GETBOOLEANI_V);
     pb_push(target);
     pb_push(index);
     glimpl_submit();
@@ -7762,7 +8950,7 @@ void glGetBooleani_v(GLenum target, GLuint index, GLboolean* data)
 
 void glGetIntegeri_v(GLenum target, GLuint index, GLint* data)
 {
-    pb_push(SGL_CMD_GETINTEGERI_V);
+    glimpl_push_command(SGL_CMD_GETINTEGERI_V);
     pb_push(target);
     pb_push(index);
     glimpl_submit();
@@ -7774,7 +8962,9 @@ void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* co
     glimpl_submit();
 
     for (int i = 0; i < count; i++) {
-        pb_push(SGL_CMD_TRANSFORMFEEDBACKVARYINGS);
+        if (!glimpl_push_command_sized(SGL_CMD_TRANSFORMFEEDBACKVARYINGS, push_string_size(varyings[i])))
+            continue;
+
         pb_push(program);
         // pb_push(1);
         push_string(varyings[i]);
@@ -7786,7 +8976,7 @@ void glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar* co
 
 void glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKVARYING);
+    glimpl_push_command(SGL_CMD_GETTRANSFORMFEEDBACKVARYING);
     pb_push(program);
     pb_push(index);
     pb_push(bufSize);
@@ -7846,12 +9036,7 @@ void glGetUniformuiv(GLuint program, GLint location, GLuint* params)
 
 GLint glGetFragDataLocation(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETFRAGDATALOCATION);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETFRAGDATALOCATION, LOCATION_FRAG_DATA, program, name);
 }
 
 void glTexParameterIiv(GLenum target, GLenum pname, const GLint* params)
@@ -7878,22 +9063,21 @@ void glDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
 {
     // to-do: should glDelete* end w/ submit?
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETERENDERBUFFERS);
+        glimpl_push_command(SGL_CMD_DELETERENDERBUFFERS);
         // pb_push(1);
         pb_push(renderbuffers[i]);
+        names_free(NAMES_RENDERBUFFER, renderbuffers[i]);
     }
+
+    state_delete_renderbuffers(n, renderbuffers);
 }
 
 void glGenRenderbuffers(GLsizei n, GLuint* renderbuffers)
 {
-    GLuint *p = renderbuffers;
-    
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENRENDERBUFFERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        renderbuffers[i] = names_alloc(NAMES_RENDERBUFFER);
+        glimpl_push_command(SGL_CMD_GENRENDERBUFFERS);
+        pb_push(renderbuffers[i]);
     }
 }
 
@@ -7905,10 +9089,13 @@ void glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint* params)
 void glDeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEFRAMEBUFFERS);
+        glimpl_push_command(SGL_CMD_DELETEFRAMEBUFFERS);
         // pb_push(1);
         pb_push(framebuffers[i]);
+        names_free(NAMES_FRAMEBUFFER, framebuffers[i]);
     }
+
+    state_delete_framebuffers(n, framebuffers);
 }
 
 void glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint* params)
@@ -7942,7 +9129,11 @@ void glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar* con
     GLuint *p = uniformIndices;
     
     for (int i = 0; i < uniformCount; i++) {
-        pb_push(SGL_CMD_GETUNIFORMINDICES);
+        if (!glimpl_push_command_sized(SGL_CMD_GETUNIFORMINDICES, push_string_size(uniformNames[i]))) {
+            *p++ = GL_INVALID_INDEX;
+            continue;
+        }
+
         pb_push(program);
         // pb_push(1);
         push_string(uniformNames[i]);
@@ -7957,7 +9148,7 @@ void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* u
     GLint *p = params;
     
     for (int i = 0; i < uniformCount; i++) {
-        pb_push(SGL_CMD_GETACTIVEUNIFORMSIV);
+        glimpl_push_command(SGL_CMD_GETACTIVEUNIFORMSIV);
         pb_push(program);
         // pb_push(1);
         pb_push(uniformIndices[i]);
@@ -7970,7 +9161,7 @@ void glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint* u
 
 void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORMNAME);
+    glimpl_push_command(SGL_CMD_GETACTIVEUNIFORMNAME);
     pb_push(program);
     pb_push(uniformIndex);
     pb_push(bufSize);
@@ -7989,17 +9180,12 @@ void glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize
 
 GLuint glGetUniformBlockIndex(GLuint program, const GLchar* uniformBlockName)
 {
-    pb_push(SGL_CMD_GETUNIFORMBLOCKINDEX);
-    pb_push(program);
-    push_string(uniformBlockName);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return (GLuint)glimpl_get_location(SGL_CMD_GETUNIFORMBLOCKINDEX, LOCATION_UNIFORM_BLOCK, program, uniformBlockName);
 }
 
 void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORMBLOCKIV);
+    glimpl_push_command(SGL_CMD_GETACTIVEUNIFORMBLOCKIV);
     pb_push(program);
     pb_push(uniformBlockIndex);
     pb_push(pname);
@@ -8010,7 +9196,7 @@ void glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum
 
 void glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName)
 {
-    pb_push(SGL_CMD_GETACTIVEUNIFORMBLOCKNAME);
+    glimpl_push_command(SGL_CMD_GETACTIVEUNIFORMBLOCKNAME);
     pb_push(program);
     pb_push(uniformBlockIndex);
     pb_push(bufSize);
@@ -8051,8 +9237,8 @@ void glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsize
         return;
     }
 
-    glimpl_push_vertex_attrib_pointers(count);
-    glimpl_push_client_pointers(mode, count);
+    bool staged = glimpl_push_vertex_attrib_pointers(0, count, 0);
+    glimpl_push_client_pointers(mode, 0, count, staged);
 
     pb_push(SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX);
     pb_push(mode);
@@ -8175,7 +9361,7 @@ void glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64* params)
 
 void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat* val)
 {
-    pb_push(SGL_CMD_GETMULTISAMPLEFV);
+    glimpl_push_command(SGL_CMD_GETMULTISAMPLEFV);
     pb_push(pname);
     pb_push(index);
 
@@ -8186,7 +9372,9 @@ void glGetMultisamplefv(GLenum pname, GLuint index, GLfloat* val)
 
 void glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar* name)
 {
-    pb_push(SGL_CMD_BINDFRAGDATALOCATIONINDEXED);
+    if (!glimpl_push_command_sized(SGL_CMD_BINDFRAGDATALOCATIONINDEXED, push_string_size(name)))
+        return;
+
     pb_push(program);
     pb_push(colorNumber);
     pb_push(index);
@@ -8195,13 +9383,7 @@ void glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint in
 
 GLint glGetFragDataIndex(GLuint program, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETFRAGDATAINDEX);
-    pb_push(program);
-    push_string(name);
-
-    glimpl_submit();
-
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL); 
+    return glimpl_get_location(SGL_CMD_GETFRAGDATAINDEX, LOCATION_FRAG_DATA_INDEX, program, name);
 }
 
 void glGenSamplers(GLsizei count, GLuint* samplers)
@@ -8209,7 +9391,7 @@ void glGenSamplers(GLsizei count, GLuint* samplers)
     GLuint *p = samplers;
 
     for (int i = 0; i < count; i++) {
-        pb_push(SGL_CMD_GENSAMPLERS);
+        glimpl_push_command(SGL_CMD_GENSAMPLERS);
         // pb_push(1);
 
         glimpl_submit();
@@ -8220,7 +9402,7 @@ void glGenSamplers(GLsizei count, GLuint* samplers)
 void glDeleteSamplers(GLsizei count, const GLuint* samplers)
 {
     for (int i = 0; i < count; i++) {
-        pb_push(SGL_CMD_DELETESAMPLERS);
+        glimpl_push_command(SGL_CMD_DELETESAMPLERS);
         // pb_push(1);
 
         pb_push(samplers[i]);
@@ -8363,7 +9545,7 @@ void glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei strid
         .normalized = GL_FALSE,
         .stride = stride,
         .ptr = (void*)pointer,
-        .enabled = false,
+        .enabled = glimpl_vaps[index].enabled,
         .client_managed = client_managed
     };
 
@@ -8486,7 +9668,7 @@ void glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, co
 
 void glGetUniformdv(GLuint program, GLint location, GLdouble* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMDV);
+    glimpl_push_command(SGL_CMD_GETUNIFORMDV);
     pb_push(program);
     pb_push(location);
 
@@ -8496,7 +9678,9 @@ void glGetUniformdv(GLuint program, GLint location, GLdouble* params)
 
 GLint glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETSUBROUTINEUNIFORMLOCATION);
+    if (!glimpl_push_command_sized(SGL_CMD_GETSUBROUTINEUNIFORMLOCATION, push_string_size(name)))
+        return -1;
+
     pb_push(program);
     pb_push(shadertype);
     push_string(name);
@@ -8507,7 +9691,9 @@ GLint glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GL
 
 GLuint glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETSUBROUTINEINDEX);
+    if (!glimpl_push_command_sized(SGL_CMD_GETSUBROUTINEINDEX, push_string_size(name)))
+        return GL_INVALID_INDEX;
+
     pb_push(program);
     pb_push(shadertype);
     push_string(name);
@@ -8518,7 +9704,7 @@ GLuint glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar* nam
 
 void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint* values)
 {
-    pb_push(SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV);
+    glimpl_push_command(SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV);
     pb_push(program);
     pb_push(shadertype);
     pb_push(index);
@@ -8541,7 +9727,7 @@ void glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint in
 
 void glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei* length, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME);
+    glimpl_push_command(SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME);
     pb_push(program);
     pb_push(shadertype);
     pb_push(index);
@@ -8561,7 +9747,7 @@ void glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint
 
 void glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei* length, GLchar* name)
 {
-    pb_push(SGL_CMD_GETACTIVESUBROUTINENAME);
+    glimpl_push_command(SGL_CMD_GETACTIVESUBROUTINENAME);
     pb_push(program);
     pb_push(shadertype);
     pb_push(index);
@@ -8581,7 +9767,7 @@ void glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index,
 
 void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint* indices)
 {
-    pb_push(SGL_CMD_UNIFORMSUBROUTINESUIV);
+    glimpl_push_command(SGL_CMD_UNIFORMSUBROUTINESUIV);
     pb_push(shadertype);
     pb_push(count);
 
@@ -8591,7 +9777,7 @@ void glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint* ind
 
 void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint* params)
 {
-    pb_push(SGL_CMD_GETUNIFORMSUBROUTINEUIV);
+    glimpl_push_command(SGL_CMD_GETUNIFORMSUBROUTINEUIV);
     pb_push(shadertype);
     pb_push(location);
 
@@ -8601,7 +9787,7 @@ void glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint* params
 
 void glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint* values)
 {
-    pb_push(SGL_CMD_GETPROGRAMSTAGEIV);
+    glimpl_push_command(SGL_CMD_GETPROGRAMSTAGEIV);
     pb_push(program);
     pb_push(shadertype);
     pb_push(pname);
@@ -8625,7 +9811,7 @@ void glPatchParameterfv(GLenum pname, const GLfloat* values)
 void glDeleteTransformFeedbacks(GLsizei n, const GLuint* ids)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETETRANSFORMFEEDBACKS);
+        glimpl_push_command(SGL_CMD_DELETETRANSFORMFEEDBACKS);
         // pb_push(1);
 
         pb_push(ids[i]);
@@ -8637,7 +9823,7 @@ void glGenTransformFeedbacks(GLsizei n, GLuint* ids)
     GLuint *p = ids;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENTRANSFORMFEEDBACKS);
+        glimpl_push_command(SGL_CMD_GENTRANSFORMFEEDBACKS);
         // pb_push(1);
 
         glimpl_submit();
@@ -8647,7 +9833,7 @@ void glGenTransformFeedbacks(GLsizei n, GLuint* ids)
 
 void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETQUERYINDEXEDIV);
+    glimpl_push_command(SGL_CMD_GETQUERYINDEXEDIV);
     pb_push(target);
     pb_push(index);
     pb_push(pname);
@@ -8658,7 +9844,7 @@ void glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint* param
 
 void glShaderBinary(GLsizei count, const GLuint* shaders, GLenum binaryformat, const void* binary, GLsizei length)
 {
-    pb_push(SGL_CMD_SHADERBINARY);
+    glimpl_push_command(SGL_CMD_SHADERBINARY);
     pb_push(count);
     pb_push(binaryformat);
     pb_push(length);
@@ -8669,7 +9855,7 @@ void glShaderBinary(GLsizei count, const GLuint* shaders, GLenum binaryformat, c
 
 void glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint* range, GLint* precision)
 {
-    pb_push(SGL_CMD_GETSHADERPRECISIONFORMAT);
+    glimpl_push_command(SGL_CMD_GETSHADERPRECISIONFORMAT);
     pb_push(shadertype);
     pb_push(precisiontype);
     pb_push(range[0]);
@@ -8690,6 +9876,8 @@ void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length, GLenum
 
 void glProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length)
 {
+    locations_forget(program);
+
     pb_push(SGL_CMD_SHADERBINARY);
     pb_push(program);
     pb_push(binaryFormat);
@@ -8699,7 +9887,7 @@ void glProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GL
 
 GLuint glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar* const*strings)
 {
-    pb_push(SGL_CMD_CREATESHADERPROGRAMV);
+    glimpl_push_command(SGL_CMD_CREATESHADERPROGRAMV);
     pb_push(type);
     pb_push(count);
 
@@ -8711,7 +9899,7 @@ GLuint glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar* const*st
 void glDeleteProgramPipelines(GLsizei n, const GLuint* pipelines)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEPROGRAMPIPELINES);
+        glimpl_push_command(SGL_CMD_DELETEPROGRAMPIPELINES);
         // pb_push(1);
 
         pb_push(pipelines[i]);
@@ -8723,7 +9911,7 @@ void glGenProgramPipelines(GLsizei n, GLuint* pipelines)
     GLuint *p = pipelines;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENPROGRAMPIPELINES);
+        glimpl_push_command(SGL_CMD_GENPROGRAMPIPELINES);
         // pb_push(1);
 
         glimpl_submit();
@@ -8733,7 +9921,7 @@ void glGenProgramPipelines(GLsizei n, GLuint* pipelines)
 
 void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMPIPELINEIV);
+    glimpl_push_command(SGL_CMD_GETPROGRAMPIPELINEIV);
     pb_push(pipeline);
     pb_push(pname);
 
@@ -8743,10 +9931,7 @@ void glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint* params)
 
 void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 2);
-    for (int i = 0; i < count * 2 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 2 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX2FV);
     pb_push(program);
@@ -8757,10 +9942,7 @@ void glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GL
 
 void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 3);
-    for (int i = 0; i < count * 3 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 3 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX3FV);
     pb_push(program);
@@ -8771,10 +9953,7 @@ void glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GL
 
 void glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 4);
-    for (int i = 0; i < count * 4 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 4 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX4FV);
     pb_push(program);
@@ -8809,10 +9988,7 @@ void glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GL
 
 void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 3);
-    for (int i = 0; i < count * 2 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 3 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX2X3FV);
     pb_push(program);
@@ -8823,10 +9999,7 @@ void glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count,
 
 void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 2);
-    for (int i = 0; i < count * 3 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 2 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV);
     pb_push(program);
@@ -8837,10 +10010,7 @@ void glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count,
 
 void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 2 * 4);
-    for (int i = 0; i < count * 2 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 2 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV);
     pb_push(program);
@@ -8851,10 +10021,7 @@ void glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count,
 
 void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 2);
-    for (int i = 0; i < count * 4 * 2; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 4 * 2 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV);
     pb_push(program);
@@ -8865,10 +10032,7 @@ void glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count,
 
 void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 3 * 4);
-    for (int i = 0; i < count * 3 * 4; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 3 * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV);
     pb_push(program);
@@ -8879,10 +10043,7 @@ void glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count,
 
 void glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4 * 3);
-    for (int i = 0; i < count * 4 * 3; i++)
-        pb_pushf(value[i]);
+    glimpl_upload_buffer(value, count * 4 * 3 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV);
     pb_push(program);
@@ -8941,7 +10102,7 @@ void glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count,
 
 void glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
 {
-    pb_push(SGL_CMD_GETPROGRAMPIPELINEINFOLOG);
+    glimpl_push_command(SGL_CMD_GETPROGRAMPIPELINEINFOLOG);
     pb_push(pipeline);
     pb_push(bufSize);
     
@@ -8968,7 +10129,7 @@ void glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei strid
         .normalized = GL_FALSE,
         .stride = stride,
         .ptr = (void*)pointer,
-        .enabled = false,
+        .enabled = glimpl_vaps[index].enabled,
         .client_managed = client_managed
     };
 
@@ -8990,14 +10151,13 @@ void glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble* params)
 
 void glViewportArrayv(GLuint first, GLsizei count, const GLfloat* v)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count * 4);
-    for (int i = 0; i < count * 4; i++)
-        pb_pushf(v[i]);
+    glimpl_upload_buffer(v, count * 4 * sizeof(GLfloat));
 
     pb_push(SGL_CMD_VIEWPORTARRAYV);
     pb_push(first);
     pb_push(count);
+
+    state_forget(GL_VIEWPORT);
 }
 
 void glViewportIndexedfv(GLuint index, const GLfloat* v)
@@ -9007,7 +10167,9 @@ void glViewportIndexedfv(GLuint index, const GLfloat* v)
 
 void glScissorArrayv(GLuint first, GLsizei count, const GLint* v)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    if (!glimpl_push_command_sized(SGL_CMD_VP_UPLOAD, count * 4 * sizeof(int)))
+        return;
+
     pb_push(count * 4);
     for (int i = 0; i < count * 4; i++)
         pb_pushf(v[i]);
@@ -9015,22 +10177,28 @@ void glScissorArrayv(GLuint first, GLsizei count, const GLint* v)
     pb_push(SGL_CMD_SCISSORARRAYV);
     pb_push(first);
     pb_push(count);
+
+    state_forget(GL_SCISSOR_BOX);
 }
 
 void glScissorIndexedv(GLuint index, const GLint* v)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    glimpl_push_command(SGL_CMD_VP_UPLOAD);
     pb_push(4);
     for (int i = 0; i < 4; i++)
         pb_pushf(v[i]);
 
     pb_push(SGL_CMD_SCISSORINDEXEDV);
     pb_push(index);
+
+    state_forget(GL_SCISSOR_BOX);
 }
 
 void glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble* v)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
+    if (!glimpl_push_command_sized(SGL_CMD_VP_UPLOAD, count * 2 * sizeof(int)))
+        return;
+
     pb_push(count * 2);
     for (int i = 0; i < count * 2; i++)
         pb_pushf(v[i]);
@@ -9042,7 +10210,7 @@ void glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble* v)
 
 void glGetFloati_v(GLenum target, GLuint index, GLfloat* data)
 {
-    pb_push(SGL_CMD_GETINTEGERI_V);
+    glimpl_push_command(SGL_CMD_GETINTEGERI_V);
     pb_push(target);
     pb_push(index);
     glimpl_submit();
@@ -9051,7 +10219,7 @@ void glGetFloati_v(GLenum target, GLuint index, GLfloat* data)
 
 void glGetDoublei_v(GLenum target, GLuint index, GLdouble* data)
 {
-    pb_push(SGL_CMD_GETDOUBLEI_V);
+    glimpl_push_command(SGL_CMD_GETDOUBLEI_V);
     pb_push(target);
     pb_push(index);
     glimpl_submit();
@@ -9098,7 +10266,7 @@ void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, G
 
 void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint* params)
 {
-    pb_push(SGL_CMD_GETINTERNALFORMATIV);
+    glimpl_push_command(SGL_CMD_GETINTERNALFORMATIV);
     pb_push(target);
     pb_push(internalformat);
     pb_push(pname);
@@ -9110,7 +10278,7 @@ void glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, G
 
 void glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV);
+    glimpl_push_command(SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV);
     pb_push(program);
     pb_push(bufferIndex);
     pb_push(pname);
@@ -9149,7 +10317,7 @@ void glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint* params)
 
 void glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64* params)
 {
-    pb_push(SGL_CMD_GETINTERNALFORMATI64V);
+    glimpl_push_command(SGL_CMD_GETINTERNALFORMATI64V);
     pb_push(target);
     pb_push(internalformat);
     pb_push(pname);
@@ -9183,7 +10351,7 @@ void glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void* indirect,
 
 void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMINTERFACEIV);
+    glimpl_push_command(SGL_CMD_GETPROGRAMINTERFACEIV);
     pb_push(program);
     pb_push(programInterface);
     pb_push(pname);
@@ -9194,7 +10362,9 @@ void glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pna
 
 GLuint glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCEINDEX);
+    if (!glimpl_push_command_sized(SGL_CMD_GETPROGRAMRESOURCEINDEX, push_string_size(name)))
+        return GL_INVALID_INDEX;
+
     pb_push(program);
     pb_push(programInterface);
     push_string(name);
@@ -9205,7 +10375,7 @@ GLuint glGetProgramResourceIndex(GLuint program, GLenum programInterface, const
 
 void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCENAME);
+    glimpl_push_command(SGL_CMD_GETPROGRAMRESOURCENAME);
     pb_push(program);
     pb_push(programInterface);
     pb_push(index);
@@ -9225,10 +10395,7 @@ void glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint in
 
 void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum* props, GLsizei bufSize, GLsizei* length, GLint* params)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(propCount);
-    for (int i = 0; i < propCount; i++)
-        pb_push(props[i]);
+    glimpl_upload_buffer(props, propCount * sizeof(GLenum));
 
     pb_push(SGL_CMD_GETPROGRAMRESOURCEIV);
     pb_push(program);
@@ -9251,7 +10418,9 @@ void glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint inde
 
 GLint glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCELOCATION);
+    if (!glimpl_push_command_sized(SGL_CMD_GETPROGRAMRESOURCELOCATION, push_string_size(name)))
+        return -1;
+
     pb_push(program);
     pb_push(programInterface);
     push_string(name);
@@ -9262,7 +10431,9 @@ GLint glGetProgramResourceLocation(GLuint program, GLenum programInterface, cons
 
 GLint glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar* name)
 {
-    pb_push(SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX);
+    if (!glimpl_push_command_sized(SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX, push_string_size(name)))
+        return -1;
+
     pb_push(program);
     pb_push(programInterface);
     push_string(name);
@@ -9325,7 +10496,7 @@ void glBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfiel
 
 void glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void* data)
 {
-    pb_push(SGL_CMD_CLEARTEXIMAGE);
+    glimpl_push_command(SGL_CMD_CLEARTEXIMAGE);
     pb_push(texture);
     pb_push(level);
     pb_push(format);
@@ -9335,7 +10506,7 @@ void glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, co
 
 void glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* data)
 {
-    pb_push(SGL_CMD_CLEARTEXSUBIMAGE);
+    glimpl_push_command(SGL_CMD_CLEARTEXSUBIMAGE);
     pb_push(texture);
     pb_push(level);
     pb_push(xoffset);
@@ -9351,7 +10522,7 @@ void glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffse
 
 void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes)
 {
-    pb_push(SGL_CMD_BINDBUFFERSRANGE);
+    glimpl_push_command(SGL_CMD_BINDBUFFERSRANGE);
     pb_push(target);
     pb_push(first);
     pb_push(count);
@@ -9360,6 +10531,8 @@ void glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint
         pb_push(offsets[i]);
         pb_push(sizes[i]);
     }
+
+    state_forget(target);
 }
 
 void glBindTextures(GLuint first, GLsizei count, const GLuint* textures)
@@ -9370,22 +10543,18 @@ void glBindTextures(GLuint first, GLsizei count, const GLuint* textures)
     //     glBindTexture(GL_TEXTURE_2D, textures[i]);
     // }
 
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count);
-    for (int i = 0; i < count; i++)
-        pb_push(textures[i]);
+    glimpl_upload_buffer(textures, count * sizeof(GLuint));
 
     pb_push(SGL_CMD_BINDTEXTURES);
     pb_push(first);
     pb_push(count);
+
+    state_bind_textures_unknown();
 }
 
 void glBindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count);
-    for (int i = 0; i < count; i++)
-        pb_push(samplers[i]);
+    glimpl_upload_buffer(samplers, count * sizeof(GLuint));
 
     pb_push(SGL_CMD_BINDSAMPLERS);
     pb_push(first);
@@ -9394,10 +10563,7 @@ void glBindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
 
 void glBindImageTextures(GLuint first, GLsizei count, const GLuint* textures)
 {
-    pb_push(SGL_CMD_VP_UPLOAD);
-    pb_push(count);
-    for (int i = 0; i < count; i++)
-        pb_push(textures[i]);
+    glimpl_upload_buffer(textures, count * sizeof(GLuint));
 
     pb_push(SGL_CMD_BINDIMAGETEXTURES);
     pb_push(first);
@@ -9406,6 +10572,8 @@ void glBindImageTextures(GLuint first, GLsizei count, const GLuint* textures)
 
 void glBindVertexBuffers(GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_BINDVERTEXBUFFERS);
     pb_push(first);
     pb_push(count);
@@ -9423,7 +10591,7 @@ void glCreateTransformFeedbacks(GLsizei n, GLuint* ids)
     GLuint *p = ids;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATETRANSFORMFEEDBACKS);
+        glimpl_push_command(SGL_CMD_CREATETRANSFORMFEEDBACKS);
         // pb_push(1);
 
         glimpl_submit();
@@ -9433,7 +10601,7 @@ void glCreateTransformFeedbacks(GLsizei n, GLuint* ids)
 
 void glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint* param)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKIV);
+    glimpl_push_command(SGL_CMD_GETTRANSFORMFEEDBACKIV);
     pb_push(xfb);
     pb_push(pname);
     
@@ -9443,7 +10611,7 @@ void glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint* param)
 
 void glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint* param)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKI_V);
+    glimpl_push_command(SGL_CMD_GETTRANSFORMFEEDBACKI_V);
     pb_push(xfb);
     pb_push(pname);
     pb_push(index);
@@ -9454,7 +10622,7 @@ void glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint* pa
 
 void glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64* param)
 {
-    pb_push(SGL_CMD_GETTRANSFORMFEEDBACKI64_V);
+    glimpl_push_command(SGL_CMD_GETTRANSFORMFEEDBACKI64_V);
     pb_push(xfb);
     pb_push(pname);
     pb_push(index);
@@ -9465,14 +10633,10 @@ void glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64
 
 void glCreateBuffers(GLsizei n, GLuint* buffers)
 {
-    GLuint *p = buffers;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEBUFFERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        buffers[i] = names_alloc(NAMES_BUFFER);
+        glimpl_push_command(SGL_CMD_CREATEBUFFERS);
+        pb_push(buffers[i]);
     }
 }
 
@@ -9541,20 +10705,16 @@ void glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, vo
 
 void glCreateFramebuffers(GLsizei n, GLuint* framebuffers)
 {
-    GLuint *p = framebuffers;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEFRAMEBUFFERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        framebuffers[i] = names_alloc(NAMES_FRAMEBUFFER);
+        glimpl_push_command(SGL_CMD_CREATEFRAMEBUFFERS);
+        pb_push(framebuffers[i]);
     }
 }
 
 void glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum* bufs)
 {
-    pb_push(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS);
+    glimpl_push_command(SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS);
     pb_push(framebuffer);
     pb_push(n);
     for (int i = 0; i < n; i++)
@@ -9600,14 +10760,10 @@ void glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attac
 
 void glCreateRenderbuffers(GLsizei n, GLuint* renderbuffers)
 {
-    GLuint *p = renderbuffers;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATERENDERBUFFERS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        renderbuffers[i] = names_alloc(NAMES_RENDERBUFFER);
+        glimpl_push_command(SGL_CMD_CREATERENDERBUFFERS);
+        pb_push(renderbuffers[i]);
     }
 }
 
@@ -9618,15 +10774,11 @@ void glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint*
 
 void glCreateTextures(GLenum target, GLsizei n, GLuint* textures)
 {
-    GLuint *p = textures;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATETEXTURES);
+        textures[i] = names_alloc(NAMES_TEXTURE);
+        glimpl_push_command(SGL_CMD_CREATETEXTURES);
         pb_push(target);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        pb_push(textures[i]);
     }
 }
 
@@ -9734,19 +10886,17 @@ void glGetTextureParameteriv(GLuint texture, GLenum pname, GLint* params)
 
 void glCreateVertexArrays(GLsizei n, GLuint* arrays)
 {
-    GLuint *p = arrays;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEVERTEXARRAYS);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        arrays[i] = names_alloc(NAMES_VERTEX_ARRAY);
+        glimpl_push_command(SGL_CMD_CREATEVERTEXARRAYS);
+        pb_push(arrays[i]);
     }
 }
 
 void glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides)
 {
+    glimpl_vertex_bindings_used = true;
+
     pb_push(SGL_CMD_VERTEXARRAYVERTEXBUFFERS);
     pb_push(vaobj);
     pb_push(first);
@@ -9760,7 +10910,7 @@ void glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const
 
 void glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint* param)
 {
-    pb_push(SGL_CMD_GETVERTEXARRAYIV);
+    glimpl_push_command(SGL_CMD_GETVERTEXARRAYIV);
     pb_push(vaobj);
     pb_push(pname);
     
@@ -9770,7 +10920,7 @@ void glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint* param)
 
 void glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint* param)
 {
-    pb_push(SGL_CMD_GETVERTEXARRAYINDEXEDIV);
+    glimpl_push_command(SGL_CMD_GETVERTEXARRAYINDEXEDIV);
     pb_push(vaobj);
     pb_push(index);
     pb_push(pname);
@@ -9781,7 +10931,7 @@ void glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint*
 
 void glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64* param)
 {
-    pb_push(SGL_CMD_GETVERTEXARRAYINDEXED64IV);
+    glimpl_push_command(SGL_CMD_GETVERTEXARRAYINDEXED64IV);
     pb_push(vaobj);
     pb_push(index);
     pb_push(pname);
@@ -9795,7 +10945,7 @@ void glCreateSamplers(GLsizei n, GLuint* samplers)
     GLuint *p = samplers;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATESAMPLERS);
+        glimpl_push_command(SGL_CMD_CREATESAMPLERS);
         // pb_push(1);
 
         glimpl_submit();
@@ -9808,7 +10958,7 @@ void glCreateProgramPipelines(GLsizei n, GLuint* pipelines)
     GLuint *p = pipelines;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEPROGRAMPIPELINES);
+        glimpl_push_command(SGL_CMD_CREATEPROGRAMPIPELINES);
         // pb_push(1);
 
         glimpl_submit();
@@ -9818,15 +10968,11 @@ void glCreateProgramPipelines(GLsizei n, GLuint* pipelines)
 
 void glCreateQueries(GLenum target, GLsizei n, GLuint* ids)
 {
-    GLuint *p = ids;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_CREATEQUERIES);
+        ids[i] = names_alloc(NAMES_QUERY);
+        glimpl_push_command(SGL_CMD_CREATEQUERIES);
         pb_push(target);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        pb_push(ids[i]);
     }
 }
 
@@ -9941,14 +11087,16 @@ void glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GL
 
 void glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
 {
-    pb_push(SGL_CMD_ATTACHOBJECTARB);
+    glimpl_push_command(SGL_CMD_ATTACHOBJECTARB);
     pb_push(containerObj);
     pb_push(obj);
 }
 
 void glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB* name)
 {
-    pb_push(SGL_CMD_BINDATTRIBLOCATIONARB);
+    if (!glimpl_push_command_sized(SGL_CMD_BINDATTRIBLOCATIONARB, push_string_size(name)))
+        return;
+
     pb_push(programObj);
     pb_push(index);
     push_string(name);
@@ -9956,14 +11104,17 @@ void glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharA
 
 void glBindBufferARB(GLenum target, GLuint buffer)
 {
-    pb_push(SGL_CMD_BINDBUFFERARB);
+    glimpl_push_command(SGL_CMD_BINDBUFFERARB);
     pb_push(target);
     pb_push(buffer);
+
+    state_bind_buffer(target, buffer);
+    names_reserve(NAMES_BUFFER, buffer);
 }
 
 void glBindProgramARB(GLenum target, GLuint program)
 {
-    pb_push(SGL_CMD_BINDPROGRAMARB);
+    glimpl_push_command(SGL_CMD_BINDPROGRAMARB);
     pb_push(target);
     pb_push(program);
 }
@@ -9980,13 +11131,13 @@ void glBufferSubDataARB(GLenum target, GLintptr offset, GLsizeiptr size, const v
 
 void glCompileShaderARB(GLhandleARB shaderObj)
 {
-    pb_push(SGL_CMD_COMPILESHADERARB);
+    glimpl_push_command(SGL_CMD_COMPILESHADERARB);
     pb_push(shaderObj);
 }
 
 GLhandleARB glCreateProgramObjectARB(void)
 {
-    pb_push(SGL_CMD_CREATEPROGRAMOBJECTARB);
+    glimpl_push_command(SGL_CMD_CREATEPROGRAMOBJECTARB);
 
     glimpl_submit();
     return pb_read(SGL_OFFSET_REGISTER_RETVAL);
@@ -9994,7 +11145,7 @@ GLhandleARB glCreateProgramObjectARB(void)
 
 GLhandleARB glCreateShaderObjectARB(GLenum shaderType)
 {
-    pb_push(SGL_CMD_CREATESHADEROBJECTARB);
+    glimpl_push_command(SGL_CMD_CREATESHADEROBJECTARB);
     pb_push(shaderType);
 
     glimpl_submit();
@@ -10004,13 +11155,19 @@ GLhandleARB glCreateShaderObjectARB(GLenum shaderType)
 void glDeleteBuffersARB(GLsizei n, const GLuint* buffers)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEBUFFERSARB);
+        glimpl_push_command(SGL_CMD_DELETEBUFFERSARB);
         pb_push(buffers[i]);
+        names_free(NAMES_BUFFER, buffers[i]);
     }
+
+    glimpl_map_windows_forget(n, buffers);
+    state_delete_buffers(n, buffers);
 }
 
 void glDeleteObjectARB(GLhandleARB obj)
 {
+    locations_forget(obj);
+
     pb_push(SGL_CMD_DELETEOBJECTARB);
     pb_push(obj);
 }
@@ -10018,7 +11175,7 @@ void glDeleteObjectARB(GLhandleARB obj)
 void glDeleteProgramsARB(GLsizei n, const GLuint* programs)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEPROGRAMSARB);
+        glimpl_push_command(SGL_CMD_DELETEPROGRAMSARB);
         pb_push(programs[i]);
     }
 }
@@ -10026,14 +11183,15 @@ void glDeleteProgramsARB(GLsizei n, const GLuint* programs)
 void glDeleteQueriesARB(GLsizei n, const GLuint* ids)
 {
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_DELETEQUERIESARB);
+        glimpl_push_command(SGL_CMD_DELETEQUERIESARB);
         pb_push(ids[i]);
+        names_free(NAMES_QUERY, ids[i]);
     }
 }
 
 void glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
 {
-    pb_push(SGL_CMD_DETACHOBJECTARB);
+    glimpl_push_command(SGL_CMD_DETACHOBJECTARB);
     pb_push(containerObj);
     pb_push(attachedObj);
 }
@@ -10045,14 +11203,10 @@ void glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
 
 void glGenBuffersARB(GLsizei n, GLuint* buffers)
 {
-    GLuint *p = buffers;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENBUFFERSARB);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        buffers[i] = names_alloc(NAMES_BUFFER);
+        glimpl_push_command(SGL_CMD_GENBUFFERSARB);
+        pb_push(buffers[i]);
     }
 }
 
@@ -10061,7 +11215,7 @@ void glGenProgramsARB(GLsizei n, GLuint* programs)
     GLuint *p = programs;
 
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENPROGRAMSARB);
+        glimpl_push_command(SGL_CMD_GENPROGRAMSARB);
         // pb_push(1);
 
         glimpl_submit();
@@ -10071,20 +11225,16 @@ void glGenProgramsARB(GLsizei n, GLuint* programs)
 
 void glGenQueriesARB(GLsizei n, GLuint* ids)
 {
-    GLuint *p = ids;
-
     for (int i = 0; i < n; i++) {
-        pb_push(SGL_CMD_GENQUERIESARB);
-        // pb_push(1);
-
-        glimpl_submit();
-        *p++ = pb_read(SGL_OFFSET_REGISTER_RETVAL);
+        ids[i] = names_alloc(NAMES_QUERY);
+        glimpl_push_command(SGL_CMD_GENQUERIESARB);
+        pb_push(ids[i]);
     }
 }
 
 void glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei* length, GLcharARB* infoLog)
 {
-    pb_push(SGL_CMD_GETINFOLOGARB);
+    glimpl_push_command(SGL_CMD_GETINFOLOGARB);
     pb_push(obj);
     pb_push(maxLength);
     
@@ -10102,7 +11252,7 @@ void glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei* length, GLchar
 
 void glGetProgramivARB(GLenum target, GLenum pname, GLint* params)
 {
-    pb_push(SGL_CMD_GETPROGRAMIVARB);
+    glimpl_push_command(SGL_CMD_GETPROGRAMIVARB);
     pb_push(target);
     pb_push(pname);
 
@@ -10112,16 +11262,13 @@ void glGetProgramivARB(GLenum target, GLenum pname, GLint* params)
 
 GLint glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB* name)
 {
-    pb_push(SGL_CMD_GETUNIFORMLOCATIONARB);
-    pb_push(programObj);
-    push_string(name);
-
-    glimpl_submit();
-    return pb_read(SGL_OFFSET_REGISTER_RETVAL);
+    return glimpl_get_location(SGL_CMD_GETUNIFORMLOCATIONARB, LOCATION_UNIFORM, programObj, name);
 }
 
 void glLinkProgramARB(GLhandleARB programObj)
 {
+    locations_forget(programObj);
+
     pb_push(SGL_CMD_LINKPROGRAMARB);
     pb_push(programObj);
 }
@@ -10133,7 +11280,9 @@ void* glMapBufferARB(GLenum target, GLenum access)
 
 void glProgramStringARB(GLenum target, GLenum format, GLsizei len, const void* string) 
 {
-    pb_push(SGL_CMD_PROGRAMSTRINGARB);
+    if (!glimpl_push_command_sized(SGL_CMD_PROGRAMSTRINGARB, push_string_size(string)))
+        return;
+
     pb_push(target);
     pb_push(format);
     pb_push(len);
@@ -10142,7 +11291,13 @@ void glProgramStringARB(GLenum target, GLenum format, GLsizei len, const void* s
 
 void glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* *string, const GLint* length)
 {
-    pb_push(SGL_CMD_SHADERSOURCEARB);
+    size_t size = 0;
+    for (int i = 0; i < count; i++)
+        size += push_string_size(string[i]);
+
+    if (!glimpl_push_command_sized(SGL_CMD_SHADERSOURCEARB, size))
+        return;
+
     pb_push(shaderObj);
     pb_push(count);
 
@@ -10154,14 +11309,14 @@ void glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB* *s
 
 void glUniform1iARB(GLint location, GLint v0)
 {
-    pb_push(SGL_CMD_UNIFORM1IARB);
+    glimpl_push_command(SGL_CMD_UNIFORM1IARB);
     pb_push(location);
     pb_push(v0);
 }
 
 void glProgramEnvParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat* params)
 {
-    pb_push(SGL_CMD_PROGRAMENVPARAMETERS4FVEXT);
+    glimpl_push_command(SGL_CMD_PROGRAMENVPARAMETERS4FVEXT);
     pb_push(target);
     pb_push(index);
     pb_push(count);
@@ -10170,7 +11325,7 @@ void glProgramEnvParameters4fvEXT(GLenum target, GLuint index, GLsizei count, co
 
 void glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
-    pb_push(SGL_CMD_COLORMASKINDEXEDEXT);
+    glimpl_push_command(SGL_CMD_COLORMASKINDEXEDEXT);
     pb_push(index);
     pb_push(r);
     pb_push(g);
@@ -10180,21 +11335,25 @@ void glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b,
 
 void glEnableIndexedEXT(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_ENABLEINDEXEDEXT);
+    glimpl_push_command(SGL_CMD_ENABLEINDEXEDEXT);
     pb_push(target);
     pb_push(index);
+
+    state_enable_indexed(target);
 }
 
 void glDisableIndexedEXT(GLenum target, GLuint index)
 {
-    pb_push(SGL_CMD_DISABLEINDEXEDEXT);
+    glimpl_push_command(SGL_CMD_DISABLEINDEXEDEXT);
     pb_push(target);
     pb_push(index);
+
+    state_enable_indexed(target);
 }
 
 void glGetBooleanIndexedvEXT(GLenum target, GLuint index, GLboolean* data)
 {
-    pb_push(SGL_CMD_GETBOOLEANINDEXEDVEXT);
+    glimpl_push_command(SGL_CMD_GETBOOLEANINDEXEDVEXT);
     pb_push(target);
     pb_push(index);
 
@@ -10204,13 +11363,15 @@ void glGetBooleanIndexedvEXT(GLenum target, GLuint index, GLboolean* data)
 
 void glActiveTextureARB(GLenum texture)
 {
-    pb_push(SGL_CMD_ACTIVETEXTUREARB);
+    glimpl_push_command(SGL_CMD_ACTIVETEXTUREARB);
     pb_push(texture);
+
+    state_active_texture(texture);
 }
 
 void glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
 {
-    pb_push(SGL_CMD_MULTITEXCOORD2FARB);
+    glimpl_push_command(SGL_CMD_MULTITEXCOORD2FARB);
     pb_push(target);
     pb_pushf(s);
     pb_pushf(t);
@@ -0,0 +1,162 @@
+#include <client/indices.h>
+
+#include <stdint.h>
+
+/*
+ * 32-bit builds only get sse2 when the compiler is allowed to use it
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define INDICES_SSE2
+#endif
+
+#ifdef INDICES_SSE2
+/*
+ * sse2 only compares signed 16 and 32 bit integers, so unsigned indices
+ * are biased into the signed range first and unbiased once reduced
+ */
+static inline __m128i indices_max_epi32(__m128i a, __m128i b)
+{
+    __m128i mask = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static inline __m128i indices_min_epi32(__m128i a, __m128i b)
+{
+    __m128i mask = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+}
+
+static size_t indices_range_ubyte_sse2(const uint8_t *indices, size_t count, GLuint *min, GLuint *max)
+{
+    __m128i vmin = _mm_set1_epi8((char)0xFF),
+            vmax = _mm_setzero_si128();
+    uint8_t lo[16], hi[16];
+    size_t i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(indices + i));
+        vmin = _mm_min_epu8(vmin, v);
+        vmax = _mm_max_epu8(vmax, v);
+    }
+
+    _mm_storeu_si128((__m128i*)lo, vmin);
+    _mm_storeu_si128((__m128i*)hi, vmax);
+    for (int j = 0; j < 16 && i > 0; j++) {
+        *min = lo[j] < *min ? lo[j] : *min;
+        *max = hi[j] > *max ? hi[j] : *max;
+    }
+
+    return i;
+}
+
+static size_t indices_range_ushort_sse2(const uint16_t *indices, size_t count, GLuint *min, GLuint *max)
+{
+    const __m128i bias = _mm_set1_epi16((short)0x8000);
+    __m128i vmin = _mm_set1_epi16(0x7FFF),
+            vmax = _mm_set1_epi16((short)0x8000);
+    uint16_t lo[8], hi[8];
+    size_t i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(indices + i)), bias);
+        vmin = _mm_min_epi16(vmin, v);
+        vmax = _mm_max_epi16(vmax, v);
+    }
+
+    _mm_storeu_si128((__m128i*)lo, _mm_xor_si128(vmin, bias));
+    _mm_storeu_si128((__m128i*)hi, _mm_xor_si128(vmax, bias));
+    for (int j = 0; j < 8 && i > 0; j++) {
+        *min = lo[j] < *min ? lo[j] : *min;
+        *max = hi[j] > *max ? hi[j] : *max;
+    }
+
+    return i;
+}
+
+static size_t indices_range_uint_sse2(const uint32_t *indices, size_t count, GLuint *min, GLuint *max)
+{
+    const __m128i bias = _mm_set1_epi32((int)0x80000000);
+    __m128i vmin = _mm_set1_epi32(0x7FFFFFFF),
+            vmax = _mm_set1_epi32((int)0x80000000);
+    uint32_t lo[4], hi[4];
+    size_t i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(indices + i)), bias);
+        vmin = indices_min_epi32(vmin, v);
+        vmax = indices_max_epi32(vmax, v);
+    }
+
+    _mm_storeu_si128((__m128i*)lo, _mm_xor_si128(vmin, bias));
+    _mm_storeu_si128((__m128i*)hi, _mm_xor_si128(vmax, bias));
+    for (int j = 0; j < 4 && i > 0; j++) {
+        *min = lo[j] < *min ? lo[j] : *min;
+        *max = hi[j] > *max ? hi[j] : *max;
+    }
+
+    return i;
+}
+#endif
+
+#define INDICES_RANGE_SCALAR(indices, start, count, min, max) \
+    for (size_t i = start; i < count; i++) { \
+        if (indices[i] < *min) \
+            *min = indices[i]; \
+        if (indices[i] > *max) \
+            *max = indices[i]; \
+    }
+
+void indices_range(GLenum type, const void *indices, size_t count, GLuint *min, GLuint *max)
+{
+    size_t done = 0;
+
+    *min = 0xFFFFFFFF;
+    *max = 0;
+
+    switch (type) {
+    case GL_UNSIGNED_BYTE: {
+        const uint8_t *b = indices;
+#ifdef INDICES_SSE2
+        done = indices_range_ubyte_sse2(b, count, min, max);
+#endif
+        INDICES_RANGE_SCALAR(b, done, count, min, max);
+        break;
+    }
+    case GL_UNSIGNED_SHORT: {
+        const uint16_t *s = indices;
+#ifdef INDICES_SSE2
+        done = indices_range_ushort_sse2(s, count, min, max);
+#endif
+        INDICES_RANGE_SCALAR(s, done, count, min, max);
+        break;
+    }
+    case GL_UNSIGNED_INT: {
+        const uint32_t *u = indices;
+#ifdef INDICES_SSE2
+        done = indices_range_uint_sse2(u, count, min, max);
+#endif
+        INDICES_RANGE_SCALAR(u, done, count, min, max);
+        break;
+    }
+    }
+
+    if (*min > *max)
+        *min = 0;
+}
+
+#undef INDICES_RANGE_SCALAR
+
+size_t indices_type_size(GLenum type)
+{
+    switch (type) {
+    case GL_UNSIGNED_BYTE:
+        return sizeof(GLubyte);
+    case GL_UNSIGNED_SHORT:
+        return sizeof(GLushort);
+    case GL_UNSIGNED_INT:
+        return sizeof(GLuint);
+    }
+
+    return 0;
+}
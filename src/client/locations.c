@@ -0,0 +1,153 @@
+#include <client/locations.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * names past this are probably generated, start over
+ * rather than growing without bound
+ */
+#define LOCATIONS_MAX_ENTRIES 65536
+
+struct location_entry {
+    char *name;
+    GLuint program;
+    enum location_kind kind;
+    uint32_t hash;
+    GLint location;
+};
+
+/*
+ * open addressing, the capacity is always a power of two
+ */
+static struct location_entry *table;
+static size_t capacity;
+static size_t count;
+
+static uint32_t locations_hash(GLuint program, enum location_kind kind, const char *name)
+{
+    uint32_t hash = 0x811C9DC5 ^ (program * 0x9E3779B1) ^ kind;
+
+    for (; *name; name++)
+        hash = (hash ^ (unsigned char)*name) * 0x01000193;
+
+    return hash;
+}
+
+static struct location_entry *locations_slot(struct location_entry *entries, size_t size, uint32_t hash, GLuint program, enum location_kind kind, const char *name)
+{
+    for (size_t i = hash & (size - 1);; i = (i + 1) & (size - 1)) {
+        struct location_entry *entry = &entries[i];
+        if (entry->name == NULL)
+            return entry;
+        if (entry->hash == hash && entry->program == program && entry->kind == kind && strcmp(entry->name, name) == 0)
+            return entry;
+    }
+}
+
+/*
+ * moves every entry not belonging to forget into a table of the given size
+ */
+static void locations_rebuild(size_t size, GLuint forget)
+{
+    struct location_entry *entries = calloc(size, sizeof(*entries));
+    if (entries == NULL)
+        return;
+
+    count = 0;
+    for (size_t i = 0; i < capacity; i++) {
+        struct location_entry *entry = &table[i];
+        if (entry->name == NULL)
+            continue;
+
+        if (entry->program == forget) {
+            free(entry->name);
+            continue;
+        }
+
+        *locations_slot(entries, size, entry->hash, entry->program, entry->kind, entry->name) = *entry;
+        count++;
+    }
+
+    free(table);
+    table = entries;
+    capacity = size;
+}
+
+static void locations_clear(void)
+{
+    for (size_t i = 0; i < capacity; i++)
+        free(table[i].name);
+    free(table);
+
+    table = NULL;
+    capacity = 0;
+    count = 0;
+}
+
+bool locations_find(GLuint program, enum location_kind kind, const char *name, GLint *location)
+{
+    if (count == 0 || name == NULL)
+        return false;
+
+    struct location_entry *entry = locations_slot(table, capacity, locations_hash(program, kind, name), program, kind, name);
+    if (entry->name == NULL)
+        return false;
+
+    *location = entry->location;
+    return true;
+}
+
+void locations_add(GLuint program, enum location_kind kind, const char *name, GLint location)
+{
+    if (name == NULL)
+        return;
+
+    if (count >= LOCATIONS_MAX_ENTRIES)
+        locations_clear();
+
+    /*
+     * kept at most half full
+     */
+    if ((count + 1) * 2 > capacity)
+        locations_rebuild(capacity ? capacity * 2 : 64, 0);
+
+    if ((count + 1) * 2 > capacity)
+        return;
+
+    uint32_t hash = locations_hash(program, kind, name);
+    struct location_entry *entry = locations_slot(table, capacity, hash, program, kind, name);
+    if (entry->name != NULL) {
+        entry->location = location;
+        return;
+    }
+
+    size_t length = strlen(name) + 1;
+    char *copy = malloc(length);
+    if (copy == NULL)
+        return;
+    memcpy(copy, name, length);
+
+    *entry = (struct location_entry) {
+        /* name = */ copy,
+        /* program = */ program,
+        /* kind = */ kind,
+        /* hash = */ hash,
+        /* location = */ location
+    };
+    count++;
+}
+
+void locations_forget(GLuint program)
+{
+    if (count == 0 || program == 0)
+        return;
+
+    for (size_t i = 0; i < capacity; i++) {
+        if (table[i].name != NULL && table[i].program == program) {
+            locations_rebuild(capacity, program);
+            return;
+        }
+    }
+}
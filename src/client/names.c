@@ -0,0 +1,102 @@
+#include <client/names.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+struct names_pool {
+    /*
+     * live[name] is set for every name in use, names handed back are
+     * pushed onto the free stack and skipped on reuse if they came
+     * back to life through a bind in the meantime
+     */
+    unsigned char *live;
+    GLuint size;
+
+    GLuint *free;
+    GLuint free_count;
+    GLuint free_size;
+
+    GLuint next;
+};
+
+static struct names_pool pools[NAMES_TYPE_COUNT];
+
+static bool names_grow(struct names_pool *pool, GLuint name)
+{
+    if (name < pool->size)
+        return true;
+
+    GLuint size = pool->size ? pool->size : 256;
+    while (size <= name)
+        size *= 2;
+
+    unsigned char *live = realloc(pool->live, size);
+    if (live == NULL)
+        return false;
+
+    memset(live + pool->size, 0, size - pool->size);
+    pool->live = live;
+    pool->size = size;
+    return true;
+}
+
+GLuint names_alloc(enum names_type type)
+{
+    struct names_pool *pool = &pools[type];
+    GLuint name = 0;
+
+    while (pool->free_count) {
+        GLuint candidate = pool->free[--pool->free_count];
+        if (!pool->live[candidate]) {
+            name = candidate;
+            break;
+        }
+    }
+
+    if (name == 0) {
+        if (pool->next == 0)
+            pool->next = 1;
+        name = pool->next++;
+    }
+
+    if (names_grow(pool, name))
+        pool->live[name] = 1;
+
+    return name;
+}
+
+void names_free(enum names_type type, GLuint name)
+{
+    struct names_pool *pool = &pools[type];
+
+    if (name == 0 || name >= pool->size || !pool->live[name])
+        return;
+
+    if (pool->free_count == pool->free_size) {
+        GLuint size = pool->free_size ? pool->free_size * 2 : 256;
+        GLuint *free_names = realloc(pool->free, size * sizeof(GLuint));
+        if (free_names == NULL)
+            return;
+
+        pool->free = free_names;
+        pool->free_size = size;
+    }
+
+    pool->live[name] = 0;
+    pool->free[pool->free_count++] = name;
+}
+
+void names_reserve(enum names_type type, GLuint name)
+{
+    struct names_pool *pool = &pools[type];
+
+    if (name == 0 || (name < pool->size && pool->live[name]))
+        return;
+
+    if (names_grow(pool, name))
+        pool->live[name] = 1;
+
+    if (name >= pool->next)
+        pool->next = name + 1;
+}
\ No newline at end of file
@@ -1,13 +1,16 @@
 #include <sharedgl.h>
 #include <client/pb.h>
+#include <client/wait.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifndef _WIN32
 #define __USE_GNU
 #define _GNU_SOURCE
 #include <sys/mman.h>
+#define PB_BARRIER() __sync_synchronize()
 #else
 #include <windows.h>
 #include <SetupAPI.h>
@@ -19,6 +22,8 @@
 
 #pragma comment (lib, "Setupapi.lib")
 
+#define PB_BARRIER() MemoryBarrier()
+
 DEFINE_GUID(GUID_DEVINTERFACE_IVSHMEM,
     0xdf576976, 0x569d, 0x4672, 0x95, 0xa0, 0xf5, 0x7e, 0x4e, 0xa0, 0xb2, 0x10);
 
@@ -45,18 +50,49 @@ static HANDLE ivshmem_handle;
 #endif
 
 static void *ptr;
-static void *base;
-static int *cur;
+static void *slot;
+
+static void *ring;
+static uint32_t ring_size;
+static volatile uint32_t *ring_head;
+static volatile uint32_t *ring_tail;
+
+static volatile uint32_t *doorbell;
+static volatile int *server_sleeping;
+static volatile int *tail_sleeping;
+static volatile int *head_sleeping;
+
+static void *map_region;
+static size_t map_region_size;
+
+static void *download;
+static size_t download_size;
 
 static void *in_base;
 static int *in_cur;
-
-static bool using_direct_access = false;
+static size_t in_size;
 
 static struct pb_net_hooks net_hooks = { NULL };
 
+/*
+ * registers private to a client live in its slot, the
+ * rest are shared by all clients in the first page
+ */
+static inline void *pb_register_base(size_t offset)
+{
+    if (!SGL_IS_CLIENT_REGISTER(offset))
+        return ptr;
+
+    /*
+     * submits don't wait for the server, so the client registers only
+     * hold what we expect once the server has caught up with us
+     */
+    pb_wait_idle();
+    return slot;
+}
+
 #ifndef _WIN32
-void pb_set(int fd, bool direct_access)
+void pb_set(int fd)
 {
     uintptr_t alloc_size;
 
@@ -66,20 +102,14 @@ void pb_set(int fd, bool direct_access)
     munmap(ptr, 0x1000);
     ptr = mmap(NULL, alloc_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
 
-    base = ptr + 0x1000;
+    slot = ptr;
 
-    if (direct_access) {
-        using_direct_access = true;
-        in_base = base;
-        in_cur = base;
-    }
-    else {
-        in_base = mmap(NULL, alloc_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        in_cur = in_base;
-    }
+    in_base = mmap(NULL, alloc_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    in_cur = in_base;
+    in_size = alloc_size;
 }
 #else
-void pb_set(bool direct_access)
+void pb_set(void)
 {
     HDEVINFO device_info;
     PSP_DEVICE_INTERFACE_DETAIL_DATA inf_data;
@@ -123,16 +153,11 @@ void pb_set(bool direct_access)
         return;
 
     ptr = map.pointer;
-    base = (PVOID)((DWORD64)map.pointer + (DWORD64)0x1000);
+    slot = ptr;
 
-    if (direct_access) {
-        in_base = base;
-        in_cur = in_base;
-    }
-    else {
-        in_base = VirtualAlloc(NULL, map.size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
-        in_cur = in_base;
-    }
+    in_base = VirtualAlloc(NULL, map.size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    in_cur = in_base;
+    in_size = map.size;
 }
 
 void pb_unset(void)
@@ -142,9 +167,35 @@ void pb_unset(void)
 }
 #endif
 
-void pb_set_net(struct pb_net_hooks hooks, size_t internal_alloc_size)
+void pb_claim_slot(int index)
+{
+    size_t slot_start = *(uint64_t*)((size_t)ptr + SGL_OFFSET_REGISTER_SLOT_START);
+    size_t slot_size = *(uint64_t*)((size_t)ptr + SGL_OFFSET_REGISTER_SLOT_SIZE);
+
+    slot = (void*)((size_t)ptr + slot_start + index * slot_size);
+
+    download_size = *(uint64_t*)((size_t)ptr + SGL_OFFSET_REGISTER_DOWNLOAD_SIZE);
+    map_region_size = *(uint64_t*)((size_t)ptr + SGL_OFFSET_REGISTER_MAP_SIZE);
+
+    ring = (void*)((size_t)slot + SGL_OFFSET_COMMAND_START);
+    ring_size = slot_size - SGL_OFFSET_COMMAND_START - map_region_size - download_size;
+    map_region = (void*)((size_t)ring + ring_size);
+    download = (void*)((size_t)map_region + map_region_size);
+    ring_head = (uint32_t*)((size_t)slot + SGL_OFFSET_SLOT_RING_HEAD);
+    ring_tail = (uint32_t*)((size_t)slot + SGL_OFFSET_SLOT_RING_TAIL);
+
+    doorbell = (uint32_t*)((size_t)ptr + SGL_OFFSET_REGISTER_DOORBELL);
+    server_sleeping = (int*)((size_t)ptr + SGL_OFFSET_REGISTER_SERVER_SLEEPING);
+    tail_sleeping = (int*)((size_t)slot + SGL_OFFSET_SLOT_TAIL_SLEEPING);
+    head_sleeping = (int*)((size_t)slot + SGL_OFFSET_SLOT_HEAD_SLEEPING);
+
+    pb_reset();
+}
+
+void pb_set_net(struct pb_net_hooks hooks, size_t internal_alloc_size, size_t download_alloc_size)
 {
     net_hooks = hooks;
+    download_size = download_alloc_size;
 
 #ifndef _WIN32
     in_base = mmap(NULL, internal_alloc_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
@@ -153,14 +204,19 @@ void pb_set_net(struct pb_net_hooks hooks, size_t internal_alloc_size)
     in_base = VirtualAlloc(NULL, internal_alloc_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
     in_cur = in_base;
 #endif
+    in_size = internal_alloc_size;
 }
 
 void pb_reset()
 {
-    cur = base;
     in_cur = in_base;
 }
 
+void pb_truncate(size_t size)
+{
+    in_cur = (int*)((size_t)in_base + size);
+}
+
 void pb_push(int c)
 {
     *in_cur++ = c;
@@ -175,19 +231,19 @@ int pb_read(int s)
 {
     if (net_hooks._pb_read)
         return net_hooks._pb_read(s);
-    return *(int*)((size_t)ptr + s);
+    return *(int*)((size_t)pb_register_base(s) + s);
 }
 
 int64_t pb_read64(int s)
 {
     if (net_hooks._pb_read64)
         return net_hooks._pb_read64(s);
-    return *(int64_t*)((size_t)ptr + s);
+    return *(int64_t*)((size_t)pb_register_base(s) + s);
 }
 
 void pb_write(int s, int c)
 {
-    *(int*)((size_t)ptr + s) = c;
+    *(int*)((size_t)pb_register_base(s) + s) = c;
 }
 
 /*
@@ -224,7 +280,7 @@ void *pb_ptr(size_t offs)
 {
     if (net_hooks._pb_ptr)
         return net_hooks._pb_ptr(offs);
-    return (void*)((size_t)ptr + offs);
+    return (void*)((size_t)pb_register_base(offs) + offs);
 }
 
 void *pb_iptr(size_t offs)
@@ -237,8 +293,123 @@ size_t pb_size()
     return (size_t)in_cur - (size_t)in_base;
 }
 
+size_t pb_capacity()
+{
+    /*
+     * leaves room for the terminating 0, and in the ring
+     * for the batch size and a wrap marker
+     */
+    if (ring != NULL)
+        return ring_size - 4 * sizeof(int);
+    return in_size - sizeof(int);
+}
+
+size_t pb_download_capacity()
+{
+    return download_size;
+}
+
+void *pb_map_region()
+{
+    return map_region;
+}
+
+size_t pb_map_region_size()
+{
+    return map_region_size;
+}
+
+void pb_download(void *dst, size_t length)
+{
+    if (net_hooks._pb_download) {
+        net_hooks._pb_download(dst, length);
+        return;
+    }
+
+    pb_wait_idle();
+    memcpy(dst, download, length);
+}
+
+/*
+ * publishes a new tail to the server, everything
+ * written before it must be visible by then
+ */
+static inline void pb_publish_tail(uint32_t tail)
+{
+    PB_BARRIER();
+    *ring_tail = tail;
+
+#ifndef _WIN32
+    __sync_fetch_and_add(doorbell, 1);
+#else
+    InterlockedIncrement((volatile LONG*)doorbell);
+#endif
+
+    if (*server_sleeping)
+        wait_wake(doorbell);
+    if (*tail_sleeping)
+        wait_wake(ring_tail);
+}
+
 void pb_copy_to_shared()
 {
-    if (!using_direct_access)
-        memcpy(base, in_base, (size_t)in_cur - (size_t)in_base);
+    uint32_t size = sizeof(int) + pb_size();
+    uint32_t tail = *ring_tail;
+
+    /*
+     * the last word of the ring is always kept free
+     * so that there is room for a wrap marker. callers keep batches
+     * within pb_capacity, a bigger one has already overrun the buffer
+     */
+    if (size + sizeof(int) >= ring_size) {
+        fprintf(stderr, "pb_copy_to_shared: batch of %u bytes does not fit in the ring (%u bytes)\n", size, ring_size);
+        exit(1);
+    }
+
+    while (1) {
+        uint32_t head = *ring_head;
+
+        if (head <= tail && tail + size + sizeof(int) > ring_size) {
+            /*
+             * not enough room before the end of the ring, wrap around
+             * unless the server has yet to move past the start of it
+             */
+            if (head == 0) {
+                wait_change(ring_head, head, head_sleeping);
+                continue;
+            }
+
+            *(int*)((size_t)ring + tail) = SGL_RING_WRAP;
+            tail = 0;
+            pb_publish_tail(tail);
+            continue;
+        }
+
+        /*
+         * never let the tail catch up with the head, as the
+         * ring would then be indistinguishable from empty
+         */
+        if (head > tail && tail + size + sizeof(int) > head) {
+            wait_change(ring_head, head, head_sleeping);
+            continue;
+        }
+
+        break;
+    }
+
+    *(int*)((size_t)ring + tail) = size;
+    memcpy((void*)((size_t)ring + tail + sizeof(int)), in_base, size - sizeof(int));
+
+    pb_publish_tail(tail + size);
+}
+
+void pb_wait_idle()
+{
+    if (ring_head == NULL)
+        return;
+
+    uint32_t head;
+    while ((head = *ring_head) != *ring_tail)
+        wait_change(ring_head, head, head_sleeping);
+    PB_BARRIER();
 }
\ No newline at end of file
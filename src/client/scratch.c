@@ -11,8 +11,18 @@
 #include <sys/mman.h>
 #endif
 
-static void *address = NULL;
-static size_t current_size = 0;
+/*
+ * the server decodes clients on multiple threads, so
+ * each thread gets a scratch buffer of its own
+ */
+#ifdef _MSC_VER
+#define SCRATCH_THREAD_LOCAL __declspec(thread)
+#else
+#define SCRATCH_THREAD_LOCAL __thread
+#endif
+
+static SCRATCH_THREAD_LOCAL void *address = NULL;
+static SCRATCH_THREAD_LOCAL size_t current_size = 0;
 
 static inline uintptr_t align_to_4kb(uintptr_t ptr)
 {
@@ -73,4 +83,19 @@ void *scratch_buffer_get(size_t size)
         
         return address;
     }
+}
+
+void scratch_buffer_release(void)
+{
+    if (!current_size)
+        return;
+
+#ifdef _WIN32
+    VirtualFree(address, 0, MEM_RELEASE);
+#else
+    munmap(address, current_size);
+#endif
+
+    address = NULL;
+    current_size = 0;
 }
\ No newline at end of file
@@ -0,0 +1,863 @@
+#include <client/state.h>
+
+#include <math.h>
+#include <string.h>
+
+#define STATE_MAX_VALUES 16
+#define STATE_MAX_TEXTURE_UNITS 32
+#define STATE_MATRIX_STACK_DEPTH 32
+
+#define STATE_PI 3.14159265358979323846f
+
+#define STATE_FLOAT     (1 << 0)
+#define STATE_IMMUTABLE (1 << 1)
+#define STATE_CAP       (1 << 2)
+
+struct state_desc {
+    GLenum pname;
+    int count;
+    int flags;
+};
+
+struct state_value {
+    bool known;
+    union {
+        GLint i[STATE_MAX_VALUES];
+        GLfloat f[STATE_MAX_VALUES];
+    };
+};
+
+struct state_matrix {
+    bool known;
+    GLfloat m[16];
+};
+
+/*
+ * we don't know how deep the server's stack is, only what we pushed
+ * onto it since we started following it. popping past that leaves the
+ * top unknown
+ */
+struct state_matrix_stack {
+    struct state_matrix top;
+    struct state_matrix saved[STATE_MATRIX_STACK_DEPTH];
+    int saved_count;
+};
+
+static const struct state_desc descs[] = {
+    /* enable caps */
+    { GL_ALPHA_TEST,                            1, STATE_CAP },
+    { GL_BLEND,                                 1, STATE_CAP },
+    { GL_COLOR_LOGIC_OP,                        1, STATE_CAP },
+    { GL_COLOR_MATERIAL,                        1, STATE_CAP },
+    { GL_CULL_FACE,                             1, STATE_CAP },
+    { GL_DEPTH_CLAMP,                           1, STATE_CAP },
+    { GL_DEPTH_TEST,                            1, STATE_CAP },
+    { GL_DITHER,                                1, STATE_CAP },
+    { GL_FOG,                                   1, STATE_CAP },
+    { GL_FRAMEBUFFER_SRGB,                      1, STATE_CAP },
+    { GL_LIGHTING,                              1, STATE_CAP },
+    { GL_LIGHT0,                                1, STATE_CAP },
+    { GL_LIGHT1,                                1, STATE_CAP },
+    { GL_LIGHT2,                                1, STATE_CAP },
+    { GL_LIGHT3,                                1, STATE_CAP },
+    { GL_LIGHT4,                                1, STATE_CAP },
+    { GL_LIGHT5,                                1, STATE_CAP },
+    { GL_LIGHT6,                                1, STATE_CAP },
+    { GL_LIGHT7,                                1, STATE_CAP },
+    { GL_LINE_SMOOTH,                           1, STATE_CAP },
+    { GL_MULTISAMPLE,                           1, STATE_CAP },
+    { GL_NORMALIZE,                             1, STATE_CAP },
+    { GL_POINT_SMOOTH,                          1, STATE_CAP },
+    { GL_POLYGON_OFFSET_FILL,                   1, STATE_CAP },
+    { GL_POLYGON_OFFSET_LINE,                   1, STATE_CAP },
+    { GL_POLYGON_SMOOTH,                        1, STATE_CAP },
+    { GL_PRIMITIVE_RESTART,                     1, STATE_CAP },
+    { GL_PRIMITIVE_RESTART_FIXED_INDEX,         1, STATE_CAP },
+    { GL_PROGRAM_POINT_SIZE,                    1, STATE_CAP },
+    { GL_RASTERIZER_DISCARD,                    1, STATE_CAP },
+    { GL_RESCALE_NORMAL,                        1, STATE_CAP },
+    { GL_SAMPLE_ALPHA_TO_COVERAGE,              1, STATE_CAP },
+    { GL_SCISSOR_TEST,                          1, STATE_CAP },
+    { GL_STENCIL_TEST,                          1, STATE_CAP },
+    { GL_TEXTURE_CUBE_MAP_SEAMLESS,             1, STATE_CAP },
+
+    /* bindings */
+    { GL_ACTIVE_TEXTURE,                        1, 0 },
+    { GL_ARRAY_BUFFER_BINDING,                  1, 0 },
+    { GL_ELEMENT_ARRAY_BUFFER_BINDING,          1, 0 },
+    { GL_UNIFORM_BUFFER_BINDING,                1, 0 },
+    { GL_PIXEL_PACK_BUFFER_BINDING,             1, 0 },
+    { GL_PIXEL_UNPACK_BUFFER_BINDING,           1, 0 },
+    { GL_COPY_READ_BUFFER_BINDING,              1, 0 },
+    { GL_COPY_WRITE_BUFFER_BINDING,             1, 0 },
+    { GL_DRAW_INDIRECT_BUFFER_BINDING,          1, 0 },
+    { GL_SHADER_STORAGE_BUFFER_BINDING,         1, 0 },
+    { GL_VERTEX_ARRAY_BINDING,                  1, 0 },
+    { GL_CURRENT_PROGRAM,                       1, 0 },
+    { GL_DRAW_FRAMEBUFFER_BINDING,              1, 0 },
+    { GL_READ_FRAMEBUFFER_BINDING,              1, 0 },
+    { GL_RENDERBUFFER_BINDING,                  1, 0 },
+    { GL_MATRIX_MODE,                           1, 0 },
+
+    /* viewport, scissor, clear values */
+    { GL_VIEWPORT,                              4, 0 },
+    { GL_SCISSOR_BOX,                           4, 0 },
+    { GL_COLOR_CLEAR_VALUE,                     4, STATE_FLOAT },
+    { GL_DEPTH_CLEAR_VALUE,                     1, STATE_FLOAT },
+    { GL_STENCIL_CLEAR_VALUE,                   1, 0 },
+
+    /* implementation limits */
+    { GL_MAX_TEXTURE_SIZE,                      1, STATE_IMMUTABLE },
+    { GL_MAX_3D_TEXTURE_SIZE,                   1, STATE_IMMUTABLE },
+    { GL_MAX_CUBE_MAP_TEXTURE_SIZE,             1, STATE_IMMUTABLE },
+    { GL_MAX_ARRAY_TEXTURE_LAYERS,              1, STATE_IMMUTABLE },
+    { GL_MAX_RENDERBUFFER_SIZE,                 1, STATE_IMMUTABLE },
+    { GL_MAX_VIEWPORT_DIMS,                     2, STATE_IMMUTABLE },
+    { GL_MAX_TEXTURE_UNITS,                     1, STATE_IMMUTABLE },
+    { GL_MAX_TEXTURE_COORDS,                    1, STATE_IMMUTABLE },
+    { GL_MAX_TEXTURE_IMAGE_UNITS,               1, STATE_IMMUTABLE },
+    { GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS,        1, STATE_IMMUTABLE },
+    { GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS,      1, STATE_IMMUTABLE },
+    { GL_MAX_VERTEX_ATTRIBS,                    1, STATE_IMMUTABLE },
+    { GL_MAX_VERTEX_UNIFORM_COMPONENTS,         1, STATE_IMMUTABLE },
+    { GL_MAX_FRAGMENT_UNIFORM_COMPONENTS,       1, STATE_IMMUTABLE },
+    { GL_MAX_VERTEX_UNIFORM_VECTORS,            1, STATE_IMMUTABLE },
+    { GL_MAX_FRAGMENT_UNIFORM_VECTORS,          1, STATE_IMMUTABLE },
+    { GL_MAX_VARYING_COMPONENTS,                1, STATE_IMMUTABLE },
+    { GL_MAX_VARYING_VECTORS,                   1, STATE_IMMUTABLE },
+    { GL_MAX_UNIFORM_BLOCK_SIZE,                1, STATE_IMMUTABLE },
+    { GL_MAX_UNIFORM_BUFFER_BINDINGS,           1, STATE_IMMUTABLE },
+    { GL_MAX_VERTEX_UNIFORM_BLOCKS,             1, STATE_IMMUTABLE },
+    { GL_MAX_FRAGMENT_UNIFORM_BLOCKS,           1, STATE_IMMUTABLE },
+    { GL_MAX_COMBINED_UNIFORM_BLOCKS,           1, STATE_IMMUTABLE },
+    { GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,       1, STATE_IMMUTABLE },
+    { GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS,    1, STATE_IMMUTABLE },
+    { GL_MAX_DRAW_BUFFERS,                      1, STATE_IMMUTABLE },
+    { GL_MAX_COLOR_ATTACHMENTS,                 1, STATE_IMMUTABLE },
+    { GL_MAX_SAMPLES,                           1, STATE_IMMUTABLE },
+    { GL_MAX_COLOR_TEXTURE_SAMPLES,             1, STATE_IMMUTABLE },
+    { GL_MAX_DEPTH_TEXTURE_SAMPLES,             1, STATE_IMMUTABLE },
+    { GL_MAX_INTEGER_SAMPLES,                   1, STATE_IMMUTABLE },
+    { GL_MAX_ELEMENTS_VERTICES,                 1, STATE_IMMUTABLE },
+    { GL_MAX_ELEMENTS_INDICES,                  1, STATE_IMMUTABLE },
+    { GL_MAX_TEXTURE_BUFFER_SIZE,               1, STATE_IMMUTABLE },
+    { GL_MAX_CLIP_PLANES,                       1, STATE_IMMUTABLE },
+    { GL_MAX_LIGHTS,                            1, STATE_IMMUTABLE },
+    { GL_MAX_MODELVIEW_STACK_DEPTH,             1, STATE_IMMUTABLE },
+    { GL_MAX_PROJECTION_STACK_DEPTH,            1, STATE_IMMUTABLE },
+    { GL_MAX_ATTRIB_STACK_DEPTH,                1, STATE_IMMUTABLE },
+    { GL_MAX_IMAGE_UNITS,                       1, STATE_IMMUTABLE },
+    { GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS,    1, STATE_IMMUTABLE },
+    { GL_SUBPIXEL_BITS,                         1, STATE_IMMUTABLE },
+    { GL_MAX_TEXTURE_MAX_ANISOTROPY,            1, STATE_IMMUTABLE | STATE_FLOAT },
+};
+
+#define STATE_NUM_VALUES (sizeof(descs) / sizeof(*descs))
+
+static struct state_value values[STATE_NUM_VALUES];
+
+/*
+ * GL_TEXTURE_BINDING_2D is per texture unit
+ */
+static GLint texture_bindings[STATE_MAX_TEXTURE_UNITS];
+static bool texture_bindings_known[STATE_MAX_TEXTURE_UNITS];
+
+static struct state_matrix_stack modelview, projection;
+
+/*
+ * commands inside a display list being compiled aren't executed
+ */
+static bool compiling = false;
+
+static int state_find(GLenum pname)
+{
+    for (int i = 0; i < STATE_NUM_VALUES; i++)
+        if (descs[i].pname == pname)
+            return i;
+    return -1;
+}
+
+static struct state_value *state_known(GLenum pname, int *index)
+{
+    int i = state_find(pname);
+
+    if (i == -1 || !values[i].known)
+        return NULL;
+
+    *index = i;
+    return &values[i];
+}
+
+static void state_forget_matrices(void)
+{
+    modelview.top.known = false;
+    modelview.saved_count = 0;
+    projection.top.known = false;
+    projection.saved_count = 0;
+}
+
+void state_invalidate(void)
+{
+    for (int i = 0; i < STATE_NUM_VALUES; i++)
+        if (!(descs[i].flags & STATE_IMMUTABLE))
+            values[i].known = false;
+
+    memset(texture_bindings_known, 0, sizeof(texture_bindings_known));
+    state_forget_matrices();
+}
+
+void state_new_list(GLenum mode)
+{
+    compiling = mode == GL_COMPILE;
+}
+
+void state_end_list(void)
+{
+    compiling = false;
+}
+
+/*
+ * queries
+ */
+
+static struct state_matrix *state_matrix_for_pname(GLenum pname)
+{
+    switch (pname) {
+    case GL_MODELVIEW_MATRIX:
+        return modelview.top.known ? &modelview.top : NULL;
+    case GL_PROJECTION_MATRIX:
+        return projection.top.known ? &projection.top : NULL;
+    }
+
+    return NULL;
+}
+
+/*
+ * number of values returned for a tracked pname
+ */
+static int state_count(GLenum pname)
+{
+    int i;
+
+    switch (pname) {
+    case GL_MODELVIEW_MATRIX:
+    case GL_PROJECTION_MATRIX:
+        return 16;
+    case GL_TEXTURE_BINDING_2D:
+        return 1;
+    }
+
+    i = state_find(pname);
+    return i != -1 ? descs[i].count : 0;
+}
+
+static int state_active_unit(void)
+{
+    int i;
+    struct state_value *value = state_known(GL_ACTIVE_TEXTURE, &i);
+
+    if (value == NULL || value->i[0] - GL_TEXTURE0 >= STATE_MAX_TEXTURE_UNITS)
+        return -1;
+
+    return value->i[0] - GL_TEXTURE0;
+}
+
+bool state_is_enabled(GLenum cap, GLboolean *enabled)
+{
+    int i;
+    struct state_value *value = state_known(cap, &i);
+
+    if (value == NULL || !(descs[i].flags & STATE_CAP))
+        return false;
+
+    *enabled = value->i[0] ? GL_TRUE : GL_FALSE;
+    return true;
+}
+
+bool state_get_integers(GLenum pname, GLint *data)
+{
+    int i;
+    struct state_value *value;
+
+    if (pname == GL_TEXTURE_BINDING_2D) {
+        int unit = state_active_unit();
+        if (unit == -1 || !texture_bindings_known[unit])
+            return false;
+
+        data[0] = texture_bindings[unit];
+        return true;
+    }
+
+    /*
+     * floats would have to be converted according to the rules of
+     * glGetIntegerv, which is the server's business
+     */
+    value = state_known(pname, &i);
+    if (value == NULL || descs[i].flags & STATE_FLOAT)
+        return false;
+
+    memcpy(data, value->i, sizeof(GLint) * descs[i].count);
+    return true;
+}
+
+bool state_get_floats(GLenum pname, GLfloat *data)
+{
+    int i;
+    struct state_value *value;
+    struct state_matrix *matrix = state_matrix_for_pname(pname);
+
+    if (matrix != NULL) {
+        memcpy(data, matrix->m, sizeof(matrix->m));
+        return true;
+    }
+
+    if (pname == GL_TEXTURE_BINDING_2D) {
+        GLint binding;
+        if (!state_get_integers(pname, &binding))
+            return false;
+
+        data[0] = binding;
+        return true;
+    }
+
+    value = state_known(pname, &i);
+    if (value == NULL)
+        return false;
+
+    for (int j = 0; j < descs[i].count; j++)
+        data[j] = descs[i].flags & STATE_FLOAT ? value->f[j] : value->i[j];
+
+    return true;
+}
+
+bool state_get_booleans(GLenum pname, GLboolean *data)
+{
+    GLfloat f[STATE_MAX_VALUES];
+    int count = state_count(pname);
+
+    if (!state_get_floats(pname, f))
+        return false;
+
+    for (int j = 0; j < count; j++)
+        data[j] = f[j] != 0.0f ? GL_TRUE : GL_FALSE;
+
+    return true;
+}
+
+bool state_get_doubles(GLenum pname, GLdouble *data)
+{
+    GLfloat f[STATE_MAX_VALUES];
+    int count = state_count(pname);
+
+    if (!state_get_floats(pname, f))
+        return false;
+
+    for (int j = 0; j < count; j++)
+        data[j] = f[j];
+
+    return true;
+}
+
+void state_cache_integers(GLenum pname, const GLint *data)
+{
+    int i = state_find(pname);
+
+    if (pname == GL_TEXTURE_BINDING_2D) {
+        int unit = state_active_unit();
+        if (unit != -1) {
+            texture_bindings[unit] = data[0];
+            texture_bindings_known[unit] = true;
+        }
+        return;
+    }
+
+    if (i == -1 || descs[i].flags & STATE_FLOAT)
+        return;
+
+    memcpy(values[i].i, data, sizeof(GLint) * descs[i].count);
+    values[i].known = true;
+}
+
+void state_cache_floats(GLenum pname, const GLfloat *data)
+{
+    int i = state_find(pname);
+    struct state_matrix *matrix = NULL;
+
+    if (pname == GL_MODELVIEW_MATRIX)
+        matrix = &modelview.top;
+    else if (pname == GL_PROJECTION_MATRIX)
+        matrix = &projection.top;
+
+    if (matrix != NULL) {
+        memcpy(matrix->m, data, sizeof(matrix->m));
+        matrix->known = true;
+        return;
+    }
+
+    if (i == -1 || !(descs[i].flags & STATE_FLOAT))
+        return;
+
+    memcpy(values[i].f, data, sizeof(GLfloat) * descs[i].count);
+    values[i].known = true;
+}
+
+void state_cache_enabled(GLenum cap, GLboolean enabled)
+{
+    int i = state_find(cap);
+
+    if (i == -1 || !(descs[i].flags & STATE_CAP))
+        return;
+
+    values[i].i[0] = enabled != GL_FALSE;
+    values[i].known = true;
+}
+
+/*
+ * state changes
+ */
+
+void state_enable(GLenum cap, bool enabled)
+{
+    if (!compiling)
+        state_cache_enabled(cap, enabled);
+}
+
+void state_enable_indexed(GLenum cap)
+{
+    /*
+     * index 0 is what glIsEnabled reports
+     */
+    state_forget(cap);
+}
+
+void state_set_integers(GLenum pname, const GLint *data)
+{
+    if (!compiling)
+        state_cache_integers(pname, data);
+}
+
+void state_set_floats(GLenum pname, const GLfloat *data)
+{
+    if (!compiling)
+        state_cache_floats(pname, data);
+}
+
+void state_forget(GLenum pname)
+{
+    int i = state_find(pname);
+
+    if (i != -1 && !(descs[i].flags & STATE_IMMUTABLE))
+        values[i].known = false;
+}
+
+GLenum state_buffer_binding_pname(GLenum target)
+{
+    switch (target) {
+    case GL_ARRAY_BUFFER:               return GL_ARRAY_BUFFER_BINDING;
+    case GL_ELEMENT_ARRAY_BUFFER:       return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+    case GL_UNIFORM_BUFFER:             return GL_UNIFORM_BUFFER_BINDING;
+    case GL_PIXEL_PACK_BUFFER:          return GL_PIXEL_PACK_BUFFER_BINDING;
+    case GL_PIXEL_UNPACK_BUFFER:        return GL_PIXEL_UNPACK_BUFFER_BINDING;
+    case GL_COPY_READ_BUFFER:           return GL_COPY_READ_BUFFER_BINDING;
+    case GL_COPY_WRITE_BUFFER:          return GL_COPY_WRITE_BUFFER_BINDING;
+    case GL_DRAW_INDIRECT_BUFFER:       return GL_DRAW_INDIRECT_BUFFER_BINDING;
+    case GL_SHADER_STORAGE_BUFFER:      return GL_SHADER_STORAGE_BUFFER_BINDING;
+    }
+
+    return 0;
+}
+
+void state_bind_buffer(GLenum target, GLuint buffer)
+{
+    GLint binding = buffer;
+    GLenum pname = state_buffer_binding_pname(target);
+
+    if (pname != 0)
+        state_set_integers(pname, &binding);
+}
+
+void state_bind_texture(GLenum target, GLuint texture)
+{
+    int unit;
+
+    if (compiling || target != GL_TEXTURE_2D)
+        return;
+
+    unit = state_active_unit();
+    if (unit == -1) {
+        /*
+         * can't tell which unit this went to
+         */
+        memset(texture_bindings_known, 0, sizeof(texture_bindings_known));
+        return;
+    }
+
+    texture_bindings[unit] = texture;
+    texture_bindings_known[unit] = true;
+}
+
+void state_bind_textures_unknown(void)
+{
+    if (!compiling)
+        memset(texture_bindings_known, 0, sizeof(texture_bindings_known));
+}
+
+void state_bind_framebuffer(GLenum target, GLuint framebuffer)
+{
+    GLint binding = framebuffer;
+
+    if (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)
+        state_set_integers(GL_DRAW_FRAMEBUFFER_BINDING, &binding);
+    if (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)
+        state_set_integers(GL_READ_FRAMEBUFFER_BINDING, &binding);
+}
+
+void state_bind_renderbuffer(GLuint renderbuffer)
+{
+    GLint binding = renderbuffer;
+    state_set_integers(GL_RENDERBUFFER_BINDING, &binding);
+}
+
+void state_bind_vertex_array(GLuint array)
+{
+    int i;
+    GLint binding = array;
+    struct state_value *value;
+
+    if (compiling)
+        return;
+
+    /*
+     * the element array binding belongs to the vertex array
+     */
+    value = state_known(GL_VERTEX_ARRAY_BINDING, &i);
+    if (value == NULL || value->i[0] != binding)
+        state_forget(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+
+    state_set_integers(GL_VERTEX_ARRAY_BINDING, &binding);
+}
+
+void state_active_texture(GLenum texture)
+{
+    GLint unit = texture;
+    state_set_integers(GL_ACTIVE_TEXTURE, &unit);
+}
+
+/*
+ * deleting a bound object reverts its binding to zero
+ */
+static void state_unbind_deleted(GLenum pname, GLsizei n, const GLuint *names)
+{
+    int i;
+    struct state_value *value = state_known(pname, &i);
+
+    if (value == NULL)
+        return;
+
+    for (int j = 0; j < n; j++)
+        if (value->i[0] == names[j])
+            value->i[0] = 0;
+}
+
+void state_delete_buffers(GLsizei n, const GLuint *buffers)
+{
+    static const GLenum pnames[] = {
+        GL_ARRAY_BUFFER_BINDING, GL_ELEMENT_ARRAY_BUFFER_BINDING, GL_UNIFORM_BUFFER_BINDING,
+        GL_PIXEL_PACK_BUFFER_BINDING, GL_PIXEL_UNPACK_BUFFER_BINDING, GL_COPY_READ_BUFFER_BINDING,
+        GL_COPY_WRITE_BUFFER_BINDING, GL_DRAW_INDIRECT_BUFFER_BINDING, GL_SHADER_STORAGE_BUFFER_BINDING
+    };
+
+    if (compiling)
+        return;
+
+    for (int i = 0; i < sizeof(pnames) / sizeof(*pnames); i++)
+        state_unbind_deleted(pnames[i], n, buffers);
+}
+
+void state_delete_textures(GLsizei n, const GLuint *textures)
+{
+    if (compiling)
+        return;
+
+    for (int i = 0; i < STATE_MAX_TEXTURE_UNITS; i++)
+        for (int j = 0; j < n; j++)
+            if (texture_bindings_known[i] && texture_bindings[i] == textures[j])
+                texture_bindings[i] = 0;
+}
+
+void state_delete_framebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    if (compiling)
+        return;
+
+    state_unbind_deleted(GL_DRAW_FRAMEBUFFER_BINDING, n, framebuffers);
+    state_unbind_deleted(GL_READ_FRAMEBUFFER_BINDING, n, framebuffers);
+}
+
+void state_delete_renderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    if (compiling)
+        return;
+
+    state_unbind_deleted(GL_RENDERBUFFER_BINDING, n, renderbuffers);
+}
+
+void state_delete_vertex_arrays(GLsizei n, const GLuint *arrays)
+{
+    int i;
+    struct state_value *value;
+
+    if (compiling)
+        return;
+
+    value = state_known(GL_VERTEX_ARRAY_BINDING, &i);
+    if (value == NULL)
+        return;
+
+    for (int j = 0; j < n; j++) {
+        if (value->i[0] == arrays[j]) {
+            value->i[0] = 0;
+            state_forget(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+        }
+    }
+}
+
+/*
+ * matrices
+ */
+
+static struct state_matrix_stack *state_current_stack(bool *unknown)
+{
+    int i;
+    struct state_value *value = state_known(GL_MATRIX_MODE, &i);
+
+    *unknown = value == NULL;
+    if (value == NULL)
+        return NULL;
+
+    switch (value->i[0]) {
+    case GL_MODELVIEW:
+        return &modelview;
+    case GL_PROJECTION:
+        return &projection;
+    }
+
+    return NULL;
+}
+
+/*
+ * returns the matrix to be modified, or NULL if it isn't one we follow.
+ * if we can't tell which matrix is current, all of them are forgotten
+ */
+static struct state_matrix *state_current_matrix(void)
+{
+    bool unknown;
+    struct state_matrix_stack *stack;
+
+    if (compiling)
+        return NULL;
+
+    stack = state_current_stack(&unknown);
+    if (unknown)
+        state_forget_matrices();
+
+    return stack != NULL ? &stack->top : NULL;
+}
+
+void state_matrix_mode(GLenum mode)
+{
+    GLint value = mode;
+    state_set_integers(GL_MATRIX_MODE, &value);
+}
+
+void state_load_matrix(const GLfloat *m)
+{
+    struct state_matrix *matrix = state_current_matrix();
+
+    if (matrix == NULL)
+        return;
+
+    memcpy(matrix->m, m, sizeof(matrix->m));
+    matrix->known = true;
+}
+
+void state_load_identity(void)
+{
+    static const GLfloat identity[16] = {
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1
+    };
+
+    state_load_matrix(identity);
+}
+
+void state_mult_matrix(const GLfloat *m)
+{
+    struct state_matrix *matrix = state_current_matrix();
+    GLfloat result[16];
+
+    if (matrix == NULL || !matrix->known)
+        return;
+
+    /*
+     * column-major, current = current * m
+     */
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            GLfloat sum = 0;
+            for (int k = 0; k < 4; k++)
+                sum += matrix->m[k * 4 + row] * m[col * 4 + k];
+            result[col * 4 + row] = sum;
+        }
+    }
+
+    memcpy(matrix->m, result, sizeof(result));
+}
+
+static void state_transpose(const GLfloat *m, GLfloat *out)
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            out[i * 4 + j] = m[j * 4 + i];
+}
+
+void state_load_transpose_matrix(const GLfloat *m)
+{
+    GLfloat t[16];
+    state_transpose(m, t);
+    state_load_matrix(t);
+}
+
+void state_mult_transpose_matrix(const GLfloat *m)
+{
+    GLfloat t[16];
+    state_transpose(m, t);
+    state_mult_matrix(t);
+}
+
+void state_translate(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLfloat m[16] = {
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        x, y, z, 1
+    };
+
+    state_mult_matrix(m);
+}
+
+void state_scale(GLfloat x, GLfloat y, GLfloat z)
+{
+    GLfloat m[16] = {
+        x, 0, 0, 0,
+        0, y, 0, 0,
+        0, 0, z, 0,
+        0, 0, 0, 1
+    };
+
+    state_mult_matrix(m);
+}
+
+void state_rotate(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+    GLfloat length = sqrtf(x * x + y * y + z * z);
+    GLfloat radians = angle * STATE_PI / 180.0f;
+    GLfloat c = cosf(radians), s = sinf(radians), ic = 1.0f - c;
+
+    /*
+     * rotating around a zero vector leaves the matrix untouched
+     */
+    if (length == 0.0f)
+        return;
+
+    x /= length;
+    y /= length;
+    z /= length;
+
+    GLfloat m[16] = {
+        x * x * ic + c,     y * x * ic + z * s, x * z * ic - y * s, 0,
+        x * y * ic - z * s, y * y * ic + c,     y * z * ic + x * s, 0,
+        x * z * ic + y * s, y * z * ic - x * s, z * z * ic + c,     0,
+        0,                  0,                  0,                  1
+    };
+
+    state_mult_matrix(m);
+}
+
+void state_ortho(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near_val, GLfloat far_val)
+{
+    if (left == right || bottom == top || near_val == far_val)
+        return;
+
+    GLfloat m[16] = {
+        2.0f / (right - left), 0, 0, 0,
+        0, 2.0f / (top - bottom), 0, 0,
+        0, 0, -2.0f / (far_val - near_val), 0,
+        -(right + left) / (right - left), -(top + bottom) / (top - bottom), -(far_val + near_val) / (far_val - near_val), 1
+    };
+
+    state_mult_matrix(m);
+}
+
+void state_frustum(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near_val, GLfloat far_val)
+{
+    if (near_val <= 0 || far_val <= 0 || left == right || bottom == top || near_val == far_val)
+        return;
+
+    GLfloat m[16] = {
+        2.0f * near_val / (right - left), 0, 0, 0,
+        0, 2.0f * near_val / (top - bottom), 0, 0,
+        (right + left) / (right - left), (top + bottom) / (top - bottom), -(far_val + near_val) / (far_val - near_val), -1,
+        0, 0, -2.0f * far_val * near_val / (far_val - near_val), 0
+    };
+
+    state_mult_matrix(m);
+}
+
+void state_push_matrix(void)
+{
+    bool unknown;
+    struct state_matrix_stack *stack;
+
+    if (compiling)
+        return;
+
+    stack = state_current_stack(&unknown);
+    if (unknown)
+        state_forget_matrices();
+    if (stack == NULL)
+        return;
+
+    if (stack->saved_count < STATE_MATRIX_STACK_DEPTH)
+        stack->saved[stack->saved_count] = stack->top;
+    stack->saved_count++;
+}
+
+void state_pop_matrix(void)
+{
+    bool unknown;
+    struct state_matrix_stack *stack;
+
+    if (compiling)
+        return;
+
+    stack = state_current_stack(&unknown);
+    if (unknown)
+        state_forget_matrices();
+    if (stack == NULL)
+        return;
+
+    if (stack->saved_count == 0) {
+        stack->top.known = false;
+        return;
+    }
+
+    stack->saved_count--;
+    if (stack->saved_count < STATE_MATRIX_STACK_DEPTH)
+        stack->top = stack->saved[stack->saved_count];
+    else
+        stack->top.known = false;
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include <client/wait.h>
+#include <sharedgl.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(i386) || defined(__i386__) || defined(__i386) || defined(_M_IX86)
+#include <emmintrin.h>
+#else
+#define _mm_pause() asm volatile("yield");
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#define WAIT_BARRIER() MemoryBarrier()
+#else
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#define WAIT_BARRIER() __sync_synchronize()
+#endif
+
+static uint64_t wait_time_us(void)
+{
+#ifndef _WIN32
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#else
+    static LARGE_INTEGER frequency = { 0 };
+    LARGE_INTEGER now;
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&now);
+    return (uint64_t)(now.QuadPart / MAX(frequency.QuadPart / 1000000, 1));
+#endif
+}
+
+static void wait_sleep(volatile uint32_t *word, uint32_t value, int timeout_us)
+{
+#ifndef _WIN32
+    /*
+     * not a private futex, the word is shared with other processes
+     */
+    struct timespec timeout = { 0, timeout_us * 1000 };
+    syscall(SYS_futex, word, FUTEX_WAIT, value, &timeout, NULL, 0);
+#else
+    /*
+     * windows clients always run in a vm, nothing can wake them.
+     * Sleep rounds up to the timer resolution, so it is left for
+     * when the wait has gone on for a while
+     */
+    if (timeout_us < SGL_WAIT_MAX_SLEEP_US)
+        SwitchToThread();
+    else
+        Sleep(1);
+#endif
+}
+
+void wait_change(volatile uint32_t *word, uint32_t value, volatile int *sleeping)
+{
+    wait_change_timeout(word, value, sleeping, UINT64_MAX);
+}
+
+bool wait_change_timeout(volatile uint32_t *word, uint32_t value, volatile int *sleeping, uint64_t timeout_us)
+{
+    uint64_t start = wait_time_us();
+
+    for (int i = 1; *word == value; i++) {
+        _mm_pause();
+        if (i % 64 == 0 && wait_time_us() - start >= SGL_WAIT_SPIN_US)
+            break;
+    }
+
+    for (int timeout = SGL_WAIT_MIN_SLEEP_US; *word == value; timeout = MIN(timeout * 2, SGL_WAIT_MAX_SLEEP_US)) {
+        uint64_t waited = wait_time_us() - start;
+        if (waited >= timeout_us)
+            break;
+
+        *sleeping = 1;
+        WAIT_BARRIER();
+        if (*word == value)
+            wait_sleep(word, value, (int)MIN((uint64_t)timeout, timeout_us - waited));
+        *sleeping = 0;
+    }
+
+    WAIT_BARRIER();
+    return *word != value;
+}
+
+void wait_wake(volatile uint32_t *word)
+{
+#ifndef _WIN32
+    syscall(SYS_futex, word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+}
@@ -0,0 +1,318 @@
+#include <network/fbcodec.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define FB_MODE_RAW 0
+#define FB_MODE_RUNS 1
+
+/*
+ * compressed tiles are a sequence of 32-bit words, each operation
+ * word holds the operation in the upper two bits and a pixel count
+ */
+#define FB_OP_LITERAL 0u
+#define FB_OP_RUN 1u
+#define FB_OP_COPY_UP 2u
+
+#define FB_OP(op, count) (((op) << 30) | (uint32_t)(count))
+#define FB_OP_TYPE(word) ((word) >> 30)
+#define FB_OP_COUNT(word) ((word) & 0x3FFFFFFF)
+
+/*
+ * shorter runs are cheaper to send as literals
+ */
+#define FB_MIN_RUN 3
+
+struct fb_tile_header {
+    uint32_t index;
+    uint16_t mode;
+    uint16_t words;
+};
+
+bool fb_encoder_init(struct fb_encoder *enc, unsigned int max_width, unsigned int max_height, size_t payload_capacity, int tile_size, int level, int keyframe_interval)
+{
+    size_t tile_pixels = (size_t)tile_size * tile_size;
+
+    memset(enc, 0, sizeof(*enc));
+
+    if (tile_size < FB_CODEC_MIN_TILE_SIZE || tile_size > FB_CODEC_MAX_TILE_SIZE)
+        return false;
+    if (payload_capacity < sizeof(struct fb_tile_header) + tile_pixels * sizeof(uint32_t))
+        return false;
+
+    enc->max_pixels = (size_t)max_width * max_height;
+    enc->previous = calloc(enc->max_pixels, sizeof(uint32_t));
+    enc->tile = malloc(tile_pixels * sizeof(uint32_t));
+    enc->encoded = malloc(tile_pixels * sizeof(uint32_t));
+    enc->payload = malloc(payload_capacity);
+    enc->payload_capacity = payload_capacity;
+
+    enc->tile_size = tile_size;
+    enc->level = level < 0 ? 0 : level > FB_CODEC_MAX_LEVEL ? FB_CODEC_MAX_LEVEL : level;
+    enc->keyframe_interval = keyframe_interval;
+
+    if (enc->previous == NULL || enc->tile == NULL || enc->encoded == NULL || enc->payload == NULL) {
+        fb_encoder_free(enc);
+        return false;
+    }
+
+    return true;
+}
+
+void fb_encoder_free(struct fb_encoder *enc)
+{
+    free(enc->previous);
+    free(enc->tile);
+    free(enc->encoded);
+    free(enc->payload);
+    memset(enc, 0, sizeof(*enc));
+}
+
+void fb_encoder_invalidate(struct fb_encoder *enc)
+{
+    enc->width = 0;
+    enc->height = 0;
+}
+
+/*
+ * returns the amount of words written, or -1 if the result
+ * wouldn't be smaller than the raw tile
+ */
+static int fb_encode_runs(const uint32_t *px, int width, int n, bool rows, uint32_t *out)
+{
+    int words = 0, literal = 0, i = 0;
+
+/* flushes pending literals, bails out once compression stops paying off */
+#define FB_FLUSH_LITERAL() \
+    if (literal < i) { \
+        if (words + 1 + (i - literal) >= n) \
+            return -1; \
+        out[words++] = FB_OP(FB_OP_LITERAL, i - literal); \
+        memcpy(&out[words], &px[literal], (i - literal) * sizeof(uint32_t)); \
+        words += i - literal; \
+    }
+
+    while (i < n) {
+        int run = 1, up = 0;
+
+        while (i + run < n && px[i + run] == px[i])
+            run++;
+        if (rows && i >= width)
+            while (i + up < n && px[i + up] == px[i + up - width])
+                up++;
+
+        if (run < FB_MIN_RUN && up < FB_MIN_RUN) {
+            i++;
+            continue;
+        }
+
+        FB_FLUSH_LITERAL();
+
+        if (words + 2 >= n)
+            return -1;
+
+        if (up >= run) {
+            out[words++] = FB_OP(FB_OP_COPY_UP, up);
+            i += up;
+        }
+        else {
+            out[words++] = FB_OP(FB_OP_RUN, run);
+            out[words++] = px[i];
+            i += run;
+        }
+
+        literal = i;
+    }
+
+    FB_FLUSH_LITERAL();
+
+#undef FB_FLUSH_LITERAL
+
+    return words;
+}
+
+/*
+ * payloads aren't necessarily aligned
+ */
+static uint32_t fb_read_word(const uint8_t *in, int w)
+{
+    uint32_t word;
+    memcpy(&word, in + (size_t)w * sizeof(uint32_t), sizeof(word));
+    return word;
+}
+
+static bool fb_decode_runs(const uint8_t *in, int words, uint32_t *px, int width, int n)
+{
+    int i = 0, w = 0;
+
+    while (w < words) {
+        uint32_t word = fb_read_word(in, w);
+        uint32_t op = FB_OP_TYPE(word);
+        int count = FB_OP_COUNT(word);
+        w++;
+
+        if (count > n - i)
+            return false;
+
+        switch (op) {
+        case FB_OP_LITERAL:
+            if (count > words - w)
+                return false;
+            memcpy(&px[i], in + (size_t)w * sizeof(uint32_t), count * sizeof(uint32_t));
+            w += count;
+            break;
+        case FB_OP_RUN:
+            if (w >= words)
+                return false;
+            word = fb_read_word(in, w);
+            for (int j = 0; j < count; j++)
+                px[i + j] = word;
+            w++;
+            break;
+        case FB_OP_COPY_UP:
+            if (i < width)
+                return false;
+            for (int j = 0; j < count; j++)
+                px[i + j] = px[i + j - width];
+            break;
+        default:
+            return false;
+        }
+
+        i += count;
+    }
+
+    return i == n;
+}
+
+int fb_encoder_encode(struct fb_encoder *enc, const uint32_t *frame, unsigned int width, unsigned int height, unsigned int stride, fb_encoder_emit_fn emit, void *user)
+{
+    int ts = enc->tile_size;
+    int tiles_x = (width + ts - 1) / ts,
+        tiles_y = (height + ts - 1) / ts;
+    size_t used = 0;
+    int tile_count = 0, payloads = 0;
+    bool keyframe;
+
+    if (width > stride || (size_t)stride * height > enc->max_pixels)
+        return 0;
+
+    /*
+     * the previous frame is meaningless after a resize
+     */
+    keyframe = width != enc->width || height != enc->height || stride != enc->stride;
+    if (enc->keyframe_interval > 0 && ++enc->frames_since_keyframe >= enc->keyframe_interval)
+        keyframe = true;
+    if (keyframe)
+        enc->frames_since_keyframe = 0;
+
+    enc->width = width;
+    enc->height = height;
+    enc->stride = stride;
+
+    for (int ty = 0; ty < tiles_y; ty++) {
+        for (int tx = 0; tx < tiles_x; tx++) {
+            int x0 = tx * ts,
+                y0 = ty * ts;
+            int tw = width - x0 < ts ? width - x0 : ts,
+                th = height - y0 < ts ? height - y0 : ts;
+            bool dirty = keyframe;
+
+            for (int r = 0; r < th && !dirty; r++) {
+                size_t offset = (size_t)(y0 + r) * stride + x0;
+                dirty = memcmp(&frame[offset], &enc->previous[offset], tw * sizeof(uint32_t)) != 0;
+            }
+
+            if (!dirty)
+                continue;
+
+            for (int r = 0; r < th; r++) {
+                size_t offset = (size_t)(y0 + r) * stride + x0;
+                memcpy(&enc->previous[offset], &frame[offset], tw * sizeof(uint32_t));
+                memcpy(&enc->tile[r * tw], &frame[offset], tw * sizeof(uint32_t));
+            }
+
+            struct fb_tile_header header = {
+                /* index = */   ty * tiles_x + tx,
+                /* mode = */    FB_MODE_RAW,
+                /* words = */   tw * th
+            };
+            const uint32_t *data = enc->tile;
+
+            if (enc->level > 0) {
+                int words = fb_encode_runs(enc->tile, tw, tw * th, enc->level > 1, enc->encoded);
+                if (words != -1) {
+                    header.mode = FB_MODE_RUNS;
+                    header.words = words;
+                    data = enc->encoded;
+                }
+            }
+
+            size_t size = sizeof(header) + header.words * sizeof(uint32_t);
+            if (used + size > enc->payload_capacity) {
+                emit(enc->payload, used, tile_count, user);
+                payloads++;
+                used = 0;
+                tile_count = 0;
+            }
+
+            memcpy(enc->payload + used, &header, sizeof(header));
+            memcpy(enc->payload + used + sizeof(header), data, header.words * sizeof(uint32_t));
+            used += size;
+            tile_count++;
+        }
+    }
+
+    if (tile_count > 0) {
+        emit(enc->payload, used, tile_count, user);
+        payloads++;
+    }
+
+    return payloads;
+}
+
+bool fb_decode(const void *data, size_t size, int tile_size, int tile_count, uint32_t *frame, unsigned int width, unsigned int height, unsigned int stride)
+{
+    static uint32_t tile[FB_CODEC_MAX_TILE_SIZE * FB_CODEC_MAX_TILE_SIZE];
+    const uint8_t *p = data, *end = p + size;
+    int ts = tile_size;
+
+    if (ts < FB_CODEC_MIN_TILE_SIZE || ts > FB_CODEC_MAX_TILE_SIZE || width > stride)
+        return false;
+
+    int tiles_x = (width + ts - 1) / ts,
+        tiles_y = (height + ts - 1) / ts;
+
+    for (int i = 0; i < tile_count; i++) {
+        struct fb_tile_header header;
+
+        if (end - p < (ptrdiff_t)sizeof(header))
+            return false;
+        memcpy(&header, p, sizeof(header));
+        p += sizeof(header);
+
+        if (header.index >= (uint32_t)(tiles_x * tiles_y) || end - p < (ptrdiff_t)(header.words * sizeof(uint32_t)))
+            return false;
+
+        int x0 = (header.index % tiles_x) * ts,
+            y0 = (header.index / tiles_x) * ts;
+        int tw = width - x0 < ts ? width - x0 : ts,
+            th = height - y0 < ts ? height - y0 : ts;
+
+        if (header.mode == FB_MODE_RAW) {
+            if (header.words != tw * th)
+                return false;
+            memcpy(tile, p, header.words * sizeof(uint32_t));
+        }
+        else if (header.words > tw * th || !fb_decode_runs(p, header.words, tile, tw, tw * th)) {
+            return false;
+        }
+
+        for (int r = 0; r < th; r++)
+            memcpy(&frame[(size_t)(y0 + r) * stride + x0], &tile[r * tw], tw * sizeof(uint32_t));
+
+        p += header.words * sizeof(uint32_t);
+    }
+
+    return true;
+}
\ No newline at end of file
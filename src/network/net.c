@@ -18,6 +18,8 @@
 #include <netdb.h>
 #include <poll.h>
 #include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/uio.h>
 #else
 #include <winsock2.h>
 #include <Ws2tcpip.h>
@@ -54,9 +56,19 @@ struct net_context {
     struct sockaddr_in server;
 
 #ifndef _WIN32
-    struct pollfd fds[SOMAXCONN + 2];
-    bool in_use[SOMAXCONN + 2];
-    int n_fds;
+    int epoll_fd;
+
+    /*
+     * client sockets are edge triggered, so a socket that still has
+     * data after being read from won't be reported again. such sockets
+     * wait in a queue, in the order they became readable. ready is
+     * indexed by socket, each socket is queued at most once
+     */
+    bool *ready;
+    int *queue;
+    int queue_head;
+    int queue_count;
+    int capacity;
 #endif
 };
 
@@ -119,6 +131,19 @@ static bool set_reuse_addr(sockfd_t socket)
     return ret == 0;
 }
 
+/*
+ * frames are sent as bursts of large datagrams, the default
+ * buffers only hold a fraction of one
+ */
+#define NET_UDP_BUFFER_SIZE (8 * 1024 * 1024)
+
+static void set_udp_buffer_sizes(sockfd_t socket)
+{
+    int size = NET_UDP_BUFFER_SIZE;
+    setsockopt(socket, SOL_SOCKET, SO_RCVBUF, (char *)&size, sizeof(int));
+    setsockopt(socket, SOL_SOCKET, SO_SNDBUF, (char *)&size, sizeof(int));
+}
+
 static char *net_create_sockets(struct net_context *nctx, int port)
 {
     nctx->udp_socket = socket(AF_INET, SOCK_DGRAM, 0);
@@ -187,6 +212,7 @@ char *net_init_server(struct net_context **ctx, int port)
     set_nonblocking(nctx->tcp_socket);
     set_no_delay(nctx->tcp_socket);
     set_no_delay(nctx->udp_socket);
+    set_udp_buffer_sizes(nctx->udp_socket);
     set_reuse_addr(nctx->tcp_socket);
     set_reuse_addr(nctx->udp_socket);
 
@@ -203,12 +229,25 @@ char *net_init_server(struct net_context **ctx, int port)
      * will cause errors on windows build
      */
 #ifndef _WIN32
-    memset(nctx->fds, 0, sizeof(nctx->fds));
-    nctx->fds[0].fd = nctx->tcp_socket;
-    nctx->fds[0].events = POLLIN;
-    nctx->fds[1].fd = nctx->udp_socket;
-    nctx->fds[1].events = POLLIN;
-    nctx->n_fds = 2;
+    nctx->epoll_fd = epoll_create1(0);
+    if (nctx->epoll_fd < 0)
+        return error_messages[ERR_FAILED_TO_LISTEN];
+
+    nctx->ready = NULL;
+    nctx->queue = NULL;
+    nctx->queue_head = 0;
+    nctx->queue_count = 0;
+    nctx->capacity = 0;
+
+    /*
+     * one connection is accepted and one datagram is read per poll,
+     * so these two stay level triggered
+     */
+    struct epoll_event listener = { .events = EPOLLIN, .data.fd = nctx->tcp_socket };
+    struct epoll_event datagrams = { .events = EPOLLIN, .data.fd = nctx->udp_socket };
+    if (epoll_ctl(nctx->epoll_fd, EPOLL_CTL_ADD, nctx->tcp_socket, &listener) < 0 ||
+        epoll_ctl(nctx->epoll_fd, EPOLL_CTL_ADD, nctx->udp_socket, &datagrams) < 0)
+        return error_messages[ERR_FAILED_TO_LISTEN];
 #endif
 
     /*
@@ -240,6 +279,7 @@ char *net_init_client(struct net_context **ctx, char *hostname, int port)
     set_nonblocking(nctx->tcp_socket);
     set_no_delay(nctx->tcp_socket);
     set_no_delay(nctx->udp_socket);
+    set_udp_buffer_sizes(nctx->udp_socket);
 
     if (connect(nctx->tcp_socket, (struct sockaddr *) &nctx->server, sizeof(nctx->server)) < 0) {
 #ifdef _WIN32
@@ -290,25 +330,80 @@ char *net_init_client(struct net_context **ctx, char *hostname, int port)
 
 #ifndef _WIN32
 /*
- * fds[0]       = tcp
- * fds[1]       = udp
- * fds[2...]    = clients
+ * events taken from the kernel per poll, more are left for the next
+ */
+#define NET_POLL_EVENTS 64
+
+/*
+ * makes room for sockets up to fd in the ready table and the queue,
+ * the queue is straightened out while at it
  */
-enum net_poll_reason net_poll(struct net_context *ctx)
+static bool net_reserve(struct net_context *ctx, int fd)
 {
+    if (fd < ctx->capacity)
+        return true;
+
+    int capacity = ctx->capacity ? ctx->capacity : 64;
+    while (capacity <= fd)
+        capacity *= 2;
+
+    bool *ready = calloc(capacity, sizeof(bool));
+    int *queue = malloc(capacity * sizeof(int));
+    if (ready == NULL || queue == NULL) {
+        free(ready);
+        free(queue);
+        return false;
+    }
+
+    if (ctx->capacity > 0)
+        memcpy(ready, ctx->ready, ctx->capacity * sizeof(bool));
+    for (int i = 0; i < ctx->queue_count; i++)
+        queue[i] = ctx->queue[(ctx->queue_head + i) % ctx->capacity];
+
+    free(ctx->ready);
+    free(ctx->queue);
+    ctx->ready = ready;
+    ctx->queue = queue;
+    ctx->queue_head = 0;
+    ctx->capacity = capacity;
+
+    return true;
+}
+
+static void net_queue_ready(struct net_context *ctx, int fd)
+{
+    if (fd >= ctx->capacity || ctx->ready[fd])
+        return;
+
+    ctx->ready[fd] = true;
+    ctx->queue[(ctx->queue_head + ctx->queue_count++) % ctx->capacity] = fd;
+}
+
+enum net_poll_reason net_poll(struct net_context *ctx, int timeout_ms)
+{
+    struct epoll_event events[NET_POLL_EVENTS];
     enum net_poll_reason reason = NET_POLL_FAILED;
-    if (poll(ctx->fds, ctx->n_fds, -1) < 0)
+
+    /*
+     * sockets left in the queue are served without blocking
+     */
+    int count = epoll_wait(ctx->epoll_fd, events, NET_POLL_EVENTS, ctx->queue_count > 0 ? 0 : timeout_ms);
+    if (count < 0 && errno != EINTR)
         return reason;
 
-    if (ctx->fds[0].revents & POLLIN)
-        reason |= NET_POLL_INCOMING_CONNECTION;
-    if (ctx->fds[1].revents & POLLIN)
-        reason |= NET_POLL_INCOMING_UDP;
-    for (int i = 2; i < ctx->n_fds; i++)
-        if (ctx->fds[i].revents & POLLIN) {
-            reason |= NET_POLL_INCOMING_TCP;
-            break;
-        }
+    for (int i = 0; i < count; i++) {
+        int fd = events[i].data.fd;
+
+        if (fd == ctx->tcp_socket)
+            reason |= NET_POLL_INCOMING_CONNECTION;
+        else if (fd == ctx->udp_socket)
+            reason |= NET_POLL_INCOMING_UDP;
+        else
+            net_queue_ready(ctx, fd);
+    }
+
+    if (ctx->queue_count > 0)
+        reason |= NET_POLL_INCOMING_TCP;
 
     return reason;
 }
@@ -322,29 +417,61 @@ net_socket net_accept(struct net_context *ctx)
     set_nonblocking(socket);
     set_no_delay(socket);
 
-    ctx->fds[ctx->n_fds].fd = socket;
-    ctx->fds[ctx->n_fds].events = POLLIN;
-    ctx->in_use[ctx->n_fds] = true;
+    /*
+     * hangups count as readable, the read that follows fails
+     * and the client is dropped
+     */
+    struct epoll_event event = { .events = EPOLLIN | EPOLLRDHUP | EPOLLET, .data.fd = socket };
+    if (!net_reserve(ctx, socket) || epoll_ctl(ctx->epoll_fd, EPOLL_CTL_ADD, socket, &event) < 0) {
+        close(socket);
+        return NET_SOCKET_NONE;
+    }
 
-    return ctx->n_fds++;
+    return socket;
 }
 
-int net_fd_count(struct net_context *ctx)
+net_socket net_next_tcp(struct net_context *ctx)
 {
-    return ctx->n_fds;
+    if (ctx->queue_count == 0)
+        return NET_SOCKET_NONE;
+
+    int fd = ctx->queue[ctx->queue_head];
+    ctx->queue_head = (ctx->queue_head + 1) % ctx->capacity;
+    ctx->queue_count--;
+    ctx->ready[fd] = false;
+
+    return fd;
 }
 
-bool net_did_event_happen_here(struct net_context *ctx, int fd)
+void net_tcp_done(struct net_context *ctx, net_socket fd)
 {
-    return ctx->in_use[fd] && ctx->fds[fd].revents & POLLIN;
+    char byte;
+    if (recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT) >= 0)
+        net_queue_ready(ctx, fd);
 }
 
 void net_close(struct net_context *ctx, int fd)
 {
-    ctx->in_use[fd] = false;
-    ctx->fds[fd].revents = 0;
-    ctx->fds[fd].fd = -1;
-    close(ctx->fds[fd].fd);
+    if (fd < 0)
+        return;
+
+    /*
+     * the descriptor is likely to be handed to the next client,
+     * which mustn't inherit this one's place in the queue
+     */
+    if (fd < ctx->capacity && ctx->ready[fd]) {
+        int count = ctx->queue_count;
+        ctx->queue_count = 0;
+        for (int i = 0; i < count; i++) {
+            int queued = ctx->queue[(ctx->queue_head + i) % ctx->capacity];
+            if (queued != fd)
+                ctx->queue[(ctx->queue_head + ctx->queue_count++) % ctx->capacity] = queued;
+        }
+        ctx->ready[fd] = false;
+    }
+
+    epoll_ctl(ctx->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    close(fd);
 }
 #endif
 
@@ -402,6 +529,22 @@ long net_recv_udp_timeout(struct net_context *ctx, void *__restrict __buf, size_
     return res;
 }
 
+long net_recv_udp_from(struct net_context *ctx, void *__restrict __buf, size_t __n, int __flags, struct net_address *from)
+{
+    _Static_assert(sizeof(struct sockaddr_in) <= sizeof(struct net_address), "net_address too small");
+
+    long res = recvfrom(ctx->udp_socket, __buf, __n, __flags, (struct sockaddr *) &ctx->client, &(socklen_t){ sizeof(ctx->client) });
+    if (res >= 0 && from != NULL)
+        memcpy(from, &ctx->client, sizeof(ctx->client));
+
+    return res;
+}
+
+long net_send_udp_to(struct net_context *ctx, const struct net_address *to, const void *__buf, size_t __n, int __flags)
+{
+    return sendto(ctx->udp_socket, __buf, __n, __flags, (const struct sockaddr *) to, sizeof(struct sockaddr_in));
+}
+
 // struct {
 //     size_t size;
 //     char name[32];
@@ -428,7 +571,7 @@ bool net_recv_tcp(struct net_context *ctx, int fd, void *__restrict __buf, size_
 #ifdef _WIN32
     sockfd_t socket = ctx->tcp_socket;
 #else
-    sockfd_t socket = fd != NET_SOCKET_SERVER ? ctx->fds[fd].fd : ctx->tcp_socket;
+    sockfd_t socket = fd != NET_SOCKET_SERVER ? fd : ctx->tcp_socket;
 #endif
 
     // for (int i = 0; i < 5; i++)
@@ -439,7 +582,7 @@ bool net_recv_tcp(struct net_context *ctx, int fd, void *__restrict __buf, size_
     size_t bytes_recv = 0;
     while (bytes_recv < __n) {
         sockret_t n = recv(socket, (char *)__buf + bytes_recv, __n - bytes_recv, MSG_NOSIGNAL);
-        if (was_operation_invalid(n))
+        if (was_operation_invalid(n) || n == 0)
             return false;
         else if (n == INVALID_RETURN_VALUE)
             continue;
@@ -458,7 +601,7 @@ bool net_send_tcp(struct net_context *ctx, int fd, const void *__buf, size_t __n
 #ifdef _WIN32
     sockfd_t socket = ctx->tcp_socket;
 #else
-    sockfd_t socket = fd != NET_SOCKET_SERVER ? ctx->fds[fd].fd : ctx->tcp_socket;
+    sockfd_t socket = fd != NET_SOCKET_SERVER ? fd : ctx->tcp_socket;
 #endif
 
     // for (int i = 0; i < 5; i++)
@@ -485,12 +628,80 @@ bool net_send_tcp(struct net_context *ctx, int fd, const void *__buf, size_t __n
     return true;
 }
 
+bool net_send_tcp_buffers(struct net_context *ctx, int fd, const struct net_buffer *buffers, int count)
+{
+#ifdef _WIN32
+    sockfd_t socket = ctx->tcp_socket;
+    WSABUF vectors[NET_MAX_BUFFERS];
+#else
+    sockfd_t socket = fd != NET_SOCKET_SERVER ? fd : ctx->tcp_socket;
+    struct iovec vectors[NET_MAX_BUFFERS];
+#endif
+    int first = 0;
+
+    if (count > NET_MAX_BUFFERS)
+        return false;
+
+    for (int i = 0; i < count; i++) {
+#ifdef _WIN32
+        vectors[i].buf = (char *)buffers[i].data;
+        vectors[i].len = buffers[i].size;
+#else
+        vectors[i].iov_base = (void *)buffers[i].data;
+        vectors[i].iov_len = buffers[i].size;
+#endif
+    }
+
+    while (first < count) {
+#ifdef _WIN32
+        DWORD sent = 0;
+        sockret_t n = WSASend(socket, vectors + first, count - first, &sent, 0, NULL, NULL);
+        if (n == 0)
+            n = sent;
+#else
+        struct msghdr message = { .msg_iov = vectors + first, .msg_iovlen = count - first };
+        sockret_t n = sendmsg(socket, &message, MSG_NOSIGNAL);
+#endif
+        if (was_operation_invalid(n))
+            return false;
+        else if (n == INVALID_RETURN_VALUE)
+            continue;
+
+        /*
+         * skip what went out, a buffer may have been sent partially
+         */
+        size_t remaining = n;
+        while (first < count) {
+#ifdef _WIN32
+            size_t size = vectors[first].len;
+#else
+            size_t size = vectors[first].iov_len;
+#endif
+            if (remaining < size) {
+#ifdef _WIN32
+                vectors[first].buf += remaining;
+                vectors[first].len -= remaining;
+#else
+                vectors[first].iov_base = (char *)vectors[first].iov_base + remaining;
+                vectors[first].iov_len -= remaining;
+#endif
+                break;
+            }
+
+            remaining -= size;
+            first++;
+        }
+    }
+
+    return true;
+}
+
 bool net_recv_tcp_timeout(struct net_context *ctx, int fd, void *__restrict __buf, size_t __n, size_t timeout_ms)
 {
 #ifdef _WIN32
     sockfd_t socket = ctx->tcp_socket;
 #else
-    sockfd_t socket = fd != NET_SOCKET_SERVER ? ctx->fds[fd].fd : ctx->tcp_socket;
+    sockfd_t socket = fd != NET_SOCKET_SERVER ? fd : ctx->tcp_socket;
 #endif
     size_t initial = time_ms();
 
@@ -502,7 +713,7 @@ bool net_recv_tcp_timeout(struct net_context *ctx, int fd, void *__restrict __bu
     size_t bytes_recv = 0;
     while (bytes_recv < __n) {
         sockret_t n = recv(socket, (char *)__buf + bytes_recv, __n - bytes_recv, 0);
-        if (was_operation_invalid(n))
+        if (was_operation_invalid(n) || n == 0)
             return false;
         else {
             if (time_ms() - initial > timeout_ms) {
@@ -520,4 +731,26 @@ bool net_recv_tcp_timeout(struct net_context *ctx, int fd, void *__restrict __bu
     }
 
     return true;
+}
+
+bool net_wait_tcp(struct net_context *ctx, int fd, size_t timeout_ms)
+{
+#ifdef _WIN32
+    sockfd_t socket = ctx->tcp_socket;
+
+    fd_set readfds;
+    FD_ZERO(&readfds);
+    FD_SET(socket, &readfds);
+
+    struct timeval timeout;
+    timeout.tv_sec = timeout_ms / 1000;
+    timeout.tv_usec = (timeout_ms % 1000) * 1000;
+
+    return select(0, &readfds, NULL, NULL, &timeout) > 0;
+#else
+    sockfd_t socket = fd != NET_SOCKET_SERVER ? fd : ctx->tcp_socket;
+    struct pollfd pfd = { socket, POLLIN, 0 };
+
+    return poll(&pfd, 1, timeout_ms) > 0;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,251 @@
+#define SHAREDGL_HOST
+
+#include <sharedgl.h>
+#include <sgldebug.h>
+
+#include <server/processor.h>
+#include <server/context.h>
+#include <server/programcache.h>
+#include <server/trace.h>
+
+#include <network/fbcodec.h>
+
+#include <signal.h>
+#include <time.h>
+
+#include <sys/mman.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static int *internal_cmd_ptr;
+
+static const char *usage =
+    "usage: sglreplay [-h] [-e MODE] [-l FRAMES] [-d DIR] [-b SIZE] [-f FILE] FILE\n"
+    "\n"
+    "decodes a trace recorded with sglrenderer -w as fast as possible\n"
+    "\n"
+    "options:\n"
+    "    -h                 display help information\n"
+    "    -e [MODE]          when to check for gl errors: off, submit or command (default: submit)\n"
+    "    -l [FRAMES]        frames of latency to allow when reading back frames, 0-%d, higher is faster (default: 0)\n"
+    "    -d [DIR]           directory to cache linked program binaries in (default: none)\n"
+    "    -b [SIZE]          max megabytes of program binaries to cache (default: %d)\n"
+    "    -f [FILE]          profile decoding per client and command, written to FILE and the log once done\n";
+
+struct replay_stats {
+    struct timespec start, last_frame;
+
+    unsigned long batches;
+    unsigned long commands;
+    unsigned long windows;
+
+    double *frame_times;
+    size_t frame_count, frame_capacity;
+};
+
+static double elapsed_ms(const struct timespec *from, const struct timespec *to)
+{
+    return (to->tv_sec - from->tv_sec) * 1000.0 + (to->tv_nsec - from->tv_nsec) / 1000000.0;
+}
+
+static void replay_record(const struct sgl_trace_record *record, void *user)
+{
+    struct replay_stats *stats = user;
+
+    if (record->type == SGL_TRACE_WINDOW) {
+        stats->windows++;
+        return;
+    }
+
+    stats->batches++;
+    stats->commands += record->commands;
+
+    if (record->swaps == 0)
+        return;
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    if (stats->frame_count == stats->frame_capacity) {
+        size_t capacity = stats->frame_capacity ? stats->frame_capacity * 2 : 1024;
+        double *frame_times = realloc(stats->frame_times, capacity * sizeof(double));
+        if (frame_times == NULL)
+            return;
+        stats->frame_times = frame_times;
+        stats->frame_capacity = capacity;
+    }
+
+    stats->frame_times[stats->frame_count++] = elapsed_ms(&stats->last_frame, &now);
+    stats->last_frame = now;
+}
+
+static int compare_times(const void *a, const void *b)
+{
+    double x = *(const double*)a,
+           y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void term_handler(int sig)
+{
+    int icmd = *internal_cmd_ptr;
+    PRINT_LOG("replay stopped! segmentation fault on %s (%d)\n", sgl_cmd2str(icmd), icmd);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    enum sgl_error_check error_check = SGL_ERROR_CHECK_SUBMIT;
+    const char *program_cache_directory = NULL;
+    int program_cache_size = SGL_PROGRAM_CACHE_DEFAULT_SIZE;
+    const char *profile_path = NULL;
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            path = argv[i];
+            continue;
+        }
+
+        if (argv[i][1] != 'h' && i + 1 == argc) {
+            PRINT_LOG("expected second argument\n");
+            return 1;
+        }
+
+        switch (argv[i][1]) {
+        case 'h':
+            fprintf(stderr, usage, SGL_READBACK_MAX_LATENCY, SGL_PROGRAM_CACHE_DEFAULT_SIZE);
+            return 0;
+        case 'e':
+            if (strcmp(argv[i + 1], "off") == 0)
+                error_check = SGL_ERROR_CHECK_OFF;
+            else if (strcmp(argv[i + 1], "submit") == 0)
+                error_check = SGL_ERROR_CHECK_SUBMIT;
+            else if (strcmp(argv[i + 1], "command") == 0)
+                error_check = SGL_ERROR_CHECK_COMMAND;
+            else
+                PRINT_LOG("unrecognized error check mode '%s'\n", argv[i + 1]);
+            i++;
+            break;
+        case 'l': {
+            int latency = atoi(argv[i + 1]);
+            if (latency < 0 || latency > SGL_READBACK_MAX_LATENCY) {
+                PRINT_LOG("readback latency must be between 0 and %d\n", SGL_READBACK_MAX_LATENCY);
+                return 1;
+            }
+            sgl_set_readback_latency(latency);
+            i++;
+            break;
+        }
+        case 'd':
+            program_cache_directory = argv[i + 1];
+            i++;
+            break;
+        case 'b':
+            program_cache_size = atoi(argv[i + 1]);
+            if (program_cache_size < 0) {
+                PRINT_LOG("program cache size may not be negative\n");
+                return 1;
+            }
+            i++;
+            break;
+        case 'f':
+            profile_path = argv[i + 1];
+            i++;
+            break;
+        default:
+            PRINT_LOG("unrecognized command-line option '%s'\n", argv[i]);
+        }
+    }
+
+    if (path == NULL) {
+        fprintf(stderr, usage, SGL_READBACK_MAX_LATENCY, SGL_PROGRAM_CACHE_DEFAULT_SIZE);
+        return 1;
+    }
+
+    struct sgl_trace trace;
+    if (!sgl_trace_load(&trace, path))
+        return 1;
+
+    const struct sgl_trace_header *header = trace.header;
+
+    /*
+     * the fifo, the persistent mappings and the framebuffer live where
+     * they did when recording, but nobody else needs to see them
+     */
+    size_t memory_size = header->memory_size;
+    void *memory = mmap(NULL, memory_size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0);
+    if (memory == MAP_FAILED) {
+        PRINT_LOG("failed to allocate %ld MiB for replaying\n", memory_size / 1024 / 1024);
+        return 1;
+    }
+
+    sgl_set_max_resolution(header->max_width, header->max_height);
+
+    /*
+     * without a directory, every program is compiled and linked
+     * like it was the first time
+     */
+    sgl_program_cache_init(program_cache_directory, (size_t)program_cache_size * 1024 * 1024);
+
+    struct sgl_cmd_processor_args args = {
+        .base_address = memory,
+        .memory_size = memory_size,
+
+        .network_over_shared = header->network,
+
+        .gl_major = header->gl_major,
+        .gl_minor = header->gl_minor,
+
+        .max_clients = header->max_clients,
+        .error_check = error_check,
+
+        .fb_tile_size = FB_CODEC_DEFAULT_TILE_SIZE,
+        .fb_compression_level = FB_CODEC_DEFAULT_LEVEL,
+        .fb_keyframe_interval = FB_CODEC_DEFAULT_KEYFRAME_INTERVAL,
+
+        .profile_path = profile_path,
+
+        .internal_cmd_ptr = &internal_cmd_ptr,
+    };
+
+    signal(SIGSEGV, term_handler);
+
+    PRINT_LOG("replaying %s, %ld MiB of memory, %d clients, %dx%d\n", path, memory_size / 1024 / 1024, header->max_clients, header->max_width, header->max_height);
+
+    struct replay_stats stats = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &stats.start);
+    stats.last_frame = stats.start;
+
+    sgl_cmd_processor_replay(args, &trace, replay_record, &stats);
+
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = elapsed_ms(&stats.start, &end) / 1000.0;
+
+    PRINT_LOG("--------------------------------------------------------\n");
+    PRINT_LOG("%lu batches, %lu commands, %lu mapping updates in %.3f s\n", stats.batches, stats.commands, stats.windows, seconds);
+    PRINT_LOG("%.0f commands/s, %.0f submits/s\n", stats.commands / seconds, stats.batches / seconds);
+
+    if (stats.frame_count > 0) {
+        double total = 0;
+        for (size_t i = 0; i < stats.frame_count; i++)
+            total += stats.frame_times[i];
+
+        qsort(stats.frame_times, stats.frame_count, sizeof(double), compare_times);
+
+        PRINT_LOG("%lu frames, %.1f fps\n", stats.frame_count, stats.frame_count / seconds);
+        PRINT_LOG("frame times: mean %.3f ms, median %.3f ms, 99th percentile %.3f ms, max %.3f ms\n",
+            total / stats.frame_count,
+            stats.frame_times[stats.frame_count / 2],
+            stats.frame_times[(stats.frame_count * 99) / 100],
+            stats.frame_times[stats.frame_count - 1]);
+    }
+
+    free(stats.frame_times);
+    sgl_trace_unload(&trace);
+    munmap(memory, memory_size);
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include <server/cmdtable.h>
+
+/*
+ * strings are padded to whole words, the word holding
+ * the terminator is the last one of the string
+ */
+static bool sgl_has_terminator(int word)
+{
+    return (word & 0xFF) == 0 || ((word >> 8) & 0xFF) == 0 || ((word >> 16) & 0xFF) == 0 || ((word >> 24) & 0xFF) == 0;
+}
+
+static size_t sgl_string_length(const int *pb, size_t available)
+{
+    for (size_t i = 0; i < available; i++)
+        if (sgl_has_terminator(pb[i]))
+            return i + 1;
+    return 0;
+}
+
+size_t sgl_cmd_length(const int *pb, size_t available)
+{
+    if (available == 0 || (unsigned int)pb[0] >= SGL_CMD_MAX)
+        return 0;
+
+    const struct sgl_cmd_desc *desc = &sgl_cmd_table[pb[0]];
+    if (!desc->handled)
+        return 0;
+
+    size_t length = 1 + desc->args;
+    if (length > available)
+        return 0;
+
+    const int *args = pb + 1;
+    switch (desc->rule) {
+    case SGL_CMD_RULE_NONE:
+        break;
+    case SGL_CMD_RULE_WORDS:
+        length += (size_t)(unsigned int)args[desc->count] * desc->scale;
+        break;
+    case SGL_CMD_RULE_BYTES:
+        length += ((size_t)(unsigned int)args[desc->count] + 3) / 4;
+        break;
+    case SGL_CMD_RULE_WORDS_BYTES:
+        length += (size_t)(unsigned int)args[desc->count] * desc->scale;
+        length += ((size_t)(unsigned int)args[desc->bytes] + 3) / 4;
+        break;
+    case SGL_CMD_RULE_STRING:
+    case SGL_CMD_RULE_STRINGS: {
+        unsigned int strings = desc->rule == SGL_CMD_RULE_STRING ? 1 : (unsigned int)args[desc->count];
+        for (unsigned int i = 0; i < strings; i++) {
+            size_t string = length < available ? sgl_string_length(pb + length, available - length) : 0;
+            if (string == 0)
+                return 0;
+            length += string;
+        }
+        break;
+    }
+    }
+
+    length += desc->tail;
+    return length <= available ? length : 0;
+}
@@ -0,0 +1,841 @@
+/*
+ * generated by scripts/gencmdtable.py from src/server/processor.c, do not edit
+ */
+#include <sharedgl.h>
+#include <server/cmdtable.h>
+
+const struct sgl_cmd_desc sgl_cmd_table[SGL_CMD_MAX] = {
+    [SGL_CMD_VP_UPLOAD] = { 1, SGL_CMD_RULE_WORDS, 0, 1, 0, 0, true },
+    [SGL_CMD_VP_NULL] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_UPLOAD_STAY] = { 1, SGL_CMD_RULE_WORDS, 0, 1, 0, 0, true },
+    [SGL_CMD_VP_DOWNLOAD] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATE_CONTEXT] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_REPORT_DIMS] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GOODBYE_WORLD] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SWAP_BUFFERS] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_UPLOAD_CHUNK] = { 4, SGL_CMD_RULE_WORDS, 3, 1, 0, 0, true },
+    [SGL_CMD_VP_MAP_WINDOW] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_FLUSH_WINDOW] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_UNMAP_WINDOW] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_CACHE_STORE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_CACHE_BIND] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_CACHE_RELEASE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VP_DRAW_IMMEDIATE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CULLFACE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRONTFACE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_HINT] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LINEWIDTH] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POINTSIZE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POLYGONMODE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SCISSOR] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXPARAMETERF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXPARAMETERFV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXPARAMETERI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXPARAMETERIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXIMAGE1D] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXIMAGE2D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWBUFFER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEAR] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARCOLOR] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARSTENCIL] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARDEPTH] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_STENCILMASK] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLORMASK] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEPTHMASK] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISABLE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENABLE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FINISH] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FLUSH] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDFUNC] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LOGICOP] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_STENCILFUNC] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_STENCILOP] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEPTHFUNC] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELSTOREF] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELSTOREI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_READBUFFER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETBOOLEANV] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETDOUBLEV] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETERROR] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETFLOATV] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETINTEGERV] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETSTRING] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXIMAGE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXPARAMETERFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXLEVELPARAMETERFV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXLEVELPARAMETERIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISENABLED] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEPTHRANGE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VIEWPORT] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NEWLIST] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENDLIST] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CALLLIST] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETELISTS] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENLISTS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LISTBASE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BEGIN] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BITMAP] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3B] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3UB] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR3US] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4B] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4S] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4UB] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLOR4US] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EDGEFLAG] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_END] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INDEXD] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INDEXF] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INDEXI] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INDEXS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMAL3B] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMAL3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMAL3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMAL3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMAL3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS2D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS2F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS2I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS2S] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS4D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS4F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS4I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RASTERPOS4S] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RECTD] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RECTF] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RECTI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RECTS] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD1D] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD1F] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD1I] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD1S] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD2D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD2F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD2I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD2S] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD4D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD4F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD4I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORD4S] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX2D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX2F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX2I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX2S] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX4D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX4F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX4I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEX4S] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLIPPLANE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLORMATERIAL] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FOGF] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FOGFV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FOGI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LIGHTF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LIGHTFV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LIGHTI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LIGHTMODELF] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LIGHTMODELFV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LIGHTMODELI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LINESTIPPLE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MATERIALF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MATERIALFV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MATERIALI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POLYGONSTIPPLE] = { 1024, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SHADEMODEL] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXENVF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXENVFV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXENVI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXENVIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXGEND] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXGENF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXGENI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FEEDBACKBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SELECTBUFFER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RENDERMODE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INITNAMES] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LOADNAME] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PASSTHROUGH] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POPNAME] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PUSHNAME] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARACCUM] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARINDEX] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INDEXMASK] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ACCUM] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POPATTRIB] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PUSHATTRIB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAP1F] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPGRID1D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPGRID1F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPGRID2D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPGRID2F] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALCOORD1D] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALCOORD1F] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALCOORD2D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALCOORD2F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALMESH1] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALPOINT1] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALMESH2] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_EVALPOINT2] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ALPHAFUNC] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELZOOM] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELTRANSFERF] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELTRANSFERI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELMAPFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PIXELMAPUIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYPIXELS] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETCLIPPLANE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETLIGHTFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETLIGHTIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETMATERIALFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETMATERIALIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXENVFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXENVIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXGENDV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXGENFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXGENIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISLIST] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRUSTUM] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LOADIDENTITY] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LOADMATRIXF] = { 16, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LOADMATRIXD] = { 16, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MATRIXMODE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTMATRIXF] = { 16, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTMATRIXD] = { 16, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ORTHO] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POPMATRIX] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PUSHMATRIX] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ROTATED] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ROTATEF] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SCALED] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SCALEF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TRANSLATED] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TRANSLATEF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWARRAYS] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTS] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POLYGONOFFSET] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXIMAGE1D] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXIMAGE2D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXSUBIMAGE1D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXSUBIMAGE2D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSUBIMAGE1D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSUBIMAGE2D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDTEXTURE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETETEXTURES] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENTEXTURES] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISTEXTURE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ARRAYELEMENT] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLORPOINTER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISABLECLIENTSTATE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENABLECLIENTSTATE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMALPOINTER] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORDPOINTER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXPOINTER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ARETEXTURESRESIDENT] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PRIORITIZETEXTURES] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INDEXUB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POPCLIENTATTRIB] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PUSHCLIENTATTRIB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXIMAGE3D] = { 9, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSUBIMAGE3D] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXSUBIMAGE3D] = { 9, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ACTIVETEXTURE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SAMPLECOVERAGE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXIMAGE3D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXIMAGE2D] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXIMAGE1D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXSUBIMAGE3D] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXSUBIMAGE2D] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXSUBIMAGE1D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLIENTACTIVETEXTURE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD1D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD1F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD1I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD1S] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD2D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD2F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD2I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD2S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD3D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD3F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD3I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD3S] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD4D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD4F] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD4I] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD4S] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LOADTRANSPOSEMATRIXF] = { 16, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTTRANSPOSEMATRIXF] = { 16, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDFUNCSEPARATE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POINTPARAMETERF] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POINTPARAMETERI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FOGCOORDF] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FOGCOORDD] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3B] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3UB] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLOR3US] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS2D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS2F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS2I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS2S] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS3D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS3F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS3I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_WINDOWPOS3S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDCOLOR] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDEQUATION] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENQUERIES] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEQUERIES] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISQUERY] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BEGINQUERY] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENDQUERY] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYOBJECTIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYOBJECTUIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISBUFFER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BUFFERDATA] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BUFFERSUBDATA] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNMAPBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETBUFFERPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDEQUATIONSEPARATE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWBUFFERS] = { 1, SGL_CMD_RULE_WORDS, 0, 1, 0, 0, true },
+    [SGL_CMD_STENCILOPSEPARATE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_STENCILFUNCSEPARATE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_STENCILMASKSEPARATE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ATTACHSHADER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDATTRIBLOCATION] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPILESHADER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEPROGRAM] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATESHADER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEPROGRAM] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETESHADER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DETACHSHADER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISABLEVERTEXATTRIBARRAY] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENABLEVERTEXATTRIBARRAY] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEATTRIB] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEUNIFORM] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETATTACHEDSHADERS] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETATTRIBLOCATION] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMINFOLOG] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETSHADERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETSHADERINFOLOG] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETSHADERSOURCE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMLOCATION] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETVERTEXATTRIBDV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETVERTEXATTRIBFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETVERTEXATTRIBIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISPROGRAM] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISSHADER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_LINKPROGRAM] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SHADERSOURCE] = { 2, SGL_CMD_RULE_STRINGS, 1, 0, 0, 0, true },
+    [SGL_CMD_USEPROGRAM] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM1F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM2F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM3F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM4F] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM1I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM2I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM3I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM4I] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX2FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX3FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX4FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VALIDATEPROGRAM] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB1D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB1F] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB1S] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB2D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB2F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB2S] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB3D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB3F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB3S] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4NBV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4NIV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4NSV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4NUB] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4NUIV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4NUSV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4BV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4F] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4IV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4S] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4SV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4UIV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIB4USV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBPOINTER] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX2X3FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX3X2FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX2X4FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX4X2FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX3X4FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMMATRIX4X3FV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLORMASKI] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETBOOLEANI_V] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETINTEGERI_V] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENABLEI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISABLEI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISENABLEDI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BEGINTRANSFORMFEEDBACK] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENDTRANSFORMFEEDBACK] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDBUFFERRANGE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDBUFFERBASE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TRANSFORMFEEDBACKVARYINGS] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 1, true },
+    [SGL_CMD_GETTRANSFORMFEEDBACKVARYING] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLAMPCOLOR] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BEGINCONDITIONALRENDER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENDCONDITIONALRENDER] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBIPOINTER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI1I] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI2I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI3I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI4I] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI1UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI2UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI3UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBI4UI] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDFRAGDATALOCATION] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETFRAGDATALOCATION] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM1UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM2UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM3UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM4UI] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARBUFFERIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARBUFFERUIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARBUFFERFV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARBUFFERFI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISRENDERBUFFER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDRENDERBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETERENDERBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENRENDERBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RENDERBUFFERSTORAGE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETRENDERBUFFERPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISFRAMEBUFFER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDFRAMEBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEFRAMEBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENFRAMEBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CHECKFRAMEBUFFERSTATUS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERTEXTURE1D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERTEXTURE2D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERTEXTURE3D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERRENDERBUFFER] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETFRAMEBUFFERATTACHMENTPARAMETERIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENERATEMIPMAP] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLITFRAMEBUFFER] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RENDERBUFFERSTORAGEMULTISAMPLE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERTEXTURELAYER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPBUFFERRANGE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FLUSHMAPPEDBUFFERRANGE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDVERTEXARRAY] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEVERTEXARRAYS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENVERTEXARRAYS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISVERTEXARRAY] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWARRAYSINSTANCED] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTSINSTANCED] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXBUFFER] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PRIMITIVERESTARTINDEX] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYBUFFERSUBDATA] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMINDICES] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEUNIFORMSIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEUNIFORMNAME] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMBLOCKINDEX] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEUNIFORMBLOCKIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEUNIFORMBLOCKNAME] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMBLOCKBINDING] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTSBASEVERTEX] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWRANGEELEMENTSBASEVERTEX] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEX] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROVOKINGVERTEX] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FENCESYNC] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETESYNC] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLIENTWAITSYNC] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERTEXTURE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXIMAGE2DMULTISAMPLE] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXIMAGE3DMULTISAMPLE] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETMULTISAMPLEFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SAMPLEMASKI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDFRAGDATALOCATIONINDEXED] = { 3, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETFRAGDATAINDEX] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GENSAMPLERS] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETESAMPLERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISSAMPLER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDSAMPLER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SAMPLERPARAMETERI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SAMPLERPARAMETERF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_QUERYCOUNTER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYOBJECTUI64V] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBDIVISOR] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBP1UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBP2UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBP3UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBP4UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXP2UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXP3UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXP4UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORDP1UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORDP2UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORDP3UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXCOORDP4UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORDP1UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORDP2UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORDP3UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORDP4UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NORMALP3UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLORP3UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COLORP4UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SECONDARYCOLORP3UI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MINSAMPLESHADING] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDEQUATIONI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDEQUATIONSEPARATEI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDFUNCI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLENDFUNCSEPARATEI] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWARRAYSINDIRECT] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTSINDIRECT] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM1D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM2D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM3D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM4D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMDV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETSUBROUTINEUNIFORMLOCATION] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETSUBROUTINEINDEX] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVESUBROUTINEUNIFORMIV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVESUBROUTINEUNIFORMNAME] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVESUBROUTINENAME] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNIFORMSUBROUTINESUIV] = { 2, SGL_CMD_RULE_WORDS, 1, 1, 0, 0, true },
+    [SGL_CMD_GETUNIFORMSUBROUTINEUIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMSTAGEIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PATCHPARAMETERI] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PATCHPARAMETERFV] = { 2, SGL_CMD_RULE_WORDS, 1, 1, 0, 0, true },
+    [SGL_CMD_BINDTRANSFORMFEEDBACK] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETETRANSFORMFEEDBACKS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENTRANSFORMFEEDBACKS] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISTRANSFORMFEEDBACK] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PAUSETRANSFORMFEEDBACK] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RESUMETRANSFORMFEEDBACK] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWTRANSFORMFEEDBACK] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAM] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BEGINQUERYINDEXED] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENDQUERYINDEXED] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYINDEXEDIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_RELEASESHADERCOMPILER] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SHADERBINARY] = { 3, SGL_CMD_RULE_WORDS_BYTES, 0, 1, 2, 0, true },
+    [SGL_CMD_GETSHADERPRECISIONFORMAT] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEPTHRANGEF] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARDEPTHF] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMBINARY] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMBINARY] = { 3, SGL_CMD_RULE_BYTES, 2, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMPARAMETERI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_USEPROGRAMSTAGES] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ACTIVESHADERPROGRAM] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATESHADERPROGRAMV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDPROGRAMPIPELINE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEPROGRAMPIPELINES] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENPROGRAMPIPELINES] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ISPROGRAMPIPELINE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMPIPELINEIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM1I] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM1F] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM1D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM1UI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM2I] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM2F] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM2D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM2UI] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM3I] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM3F] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM3D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM3UI] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM4I] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM4F] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM4D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORM4UI] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX2FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX3FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX4FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX2DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX3DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX4DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX2X3FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX3X2FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX2X4FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX4X2FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX3X4FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX4X3FV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX2X3DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX3X2DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX2X4DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX4X2DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX3X4DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMUNIFORMMATRIX4X3DV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VALIDATEPROGRAMPIPELINE] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMPIPELINEINFOLOG] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBL1D] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBL2D] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBL3D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBL4D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBLPOINTER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VIEWPORTARRAYV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VIEWPORTINDEXEDF] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VIEWPORTINDEXEDFV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SCISSORARRAYV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SCISSORINDEXED] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_SCISSORINDEXEDV] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEPTHRANGEARRAYV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEPTHRANGEINDEXED] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETFLOATI_V] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETDOUBLEI_V] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWARRAYSINSTANCEDBASEINSTANCE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTSINSTANCEDBASEINSTANCE] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETINTERNALFORMATIV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETACTIVEATOMICCOUNTERBUFFERIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDIMAGETEXTURE] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MEMORYBARRIER] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSTORAGE1D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSTORAGE2D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSTORAGE3D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWTRANSFORMFEEDBACKINSTANCED] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DRAWTRANSFORMFEEDBACKSTREAMINSTANCED] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARBUFFERDATA] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARBUFFERSUBDATA] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISPATCHCOMPUTE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISPATCHCOMPUTEINDIRECT] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYIMAGESUBDATA] = { 15, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FRAMEBUFFERPARAMETERI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETFRAMEBUFFERPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETINTERNALFORMATI64V] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATETEXSUBIMAGE] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATETEXIMAGE] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATEBUFFERSUBDATA] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATEBUFFERDATA] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATEFRAMEBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATESUBFRAMEBUFFER] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTIDRAWARRAYSINDIRECT] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTIDRAWELEMENTSINDIRECT] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMINTERFACEIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMRESOURCEINDEX] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMRESOURCENAME] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMRESOURCEIV] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMRESOURCELOCATION] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMRESOURCELOCATIONINDEX] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_SHADERSTORAGEBLOCKBINDING] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXBUFFERRANGE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSTORAGE2DMULTISAMPLE] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXSTORAGE3DMULTISAMPLE] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREVIEW] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDVERTEXBUFFER] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBFORMAT] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBIFORMAT] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBLFORMAT] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXATTRIBBINDING] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXBINDINGDIVISOR] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEBUGMESSAGECONTROL] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEBUGMESSAGEINSERT] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DEBUGMESSAGECALLBACK] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETDEBUGMESSAGELOG] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PUSHDEBUGGROUP] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POPDEBUGGROUP] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_OBJECTLABEL] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETOBJECTLABEL] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_OBJECTPTRLABEL] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETOBJECTPTRLABEL] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BUFFERSTORAGE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARTEXIMAGE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARTEXSUBIMAGE] = { 11, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDBUFFERSBASE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDBUFFERSRANGE] = { 3, SGL_CMD_RULE_WORDS, 2, 3, 0, 0, true },
+    [SGL_CMD_BINDTEXTURES] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDSAMPLERS] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDIMAGETEXTURES] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDVERTEXBUFFERS] = { 2, SGL_CMD_RULE_WORDS, 1, 3, 0, 0, true },
+    [SGL_CMD_CLIPCONTROL] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATETRANSFORMFEEDBACKS] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TRANSFORMFEEDBACKBUFFERBASE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TRANSFORMFEEDBACKBUFFERRANGE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTRANSFORMFEEDBACKIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTRANSFORMFEEDBACKI_V] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTRANSFORMFEEDBACKI64_V] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDBUFFERSTORAGE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDBUFFERDATA] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDBUFFERSUBDATA] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYNAMEDBUFFERSUBDATA] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARNAMEDBUFFERDATA] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARNAMEDBUFFERSUBDATA] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPNAMEDBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPNAMEDBUFFERRANGE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_UNMAPNAMEDBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_FLUSHMAPPEDNAMEDBUFFERRANGE] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDBUFFERPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDBUFFERPARAMETERI64V] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDBUFFERPOINTERV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDBUFFERSUBDATA] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEFRAMEBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERRENDERBUFFER] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERPARAMETERI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERTEXTURE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERTEXTURELAYER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERDRAWBUFFERS] = { 2, SGL_CMD_RULE_WORDS, 1, 1, 0, 0, true },
+    [SGL_CMD_NAMEDFRAMEBUFFERREADBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATENAMEDFRAMEBUFFERDATA] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_INVALIDATENAMEDFRAMEBUFFERSUBDATA] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARNAMEDFRAMEBUFFERIV] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARNAMEDFRAMEBUFFERUIV] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARNAMEDFRAMEBUFFERFV] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CLEARNAMEDFRAMEBUFFERFI] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BLITNAMEDFRAMEBUFFER] = { 12, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CHECKNAMEDFRAMEBUFFERSTATUS] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDFRAMEBUFFERPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATERENDERBUFFERS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDRENDERBUFFERSTORAGE] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_NAMEDRENDERBUFFERSTORAGEMULTISAMPLE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNAMEDRENDERBUFFERPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATETEXTURES] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREBUFFER] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREBUFFERRANGE] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESTORAGE1D] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESTORAGE2D] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESTORAGE3D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESTORAGE2DMULTISAMPLE] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESTORAGE3DMULTISAMPLE] = { 7, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESUBIMAGE1D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESUBIMAGE2D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTURESUBIMAGE3D] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXTURESUBIMAGE1D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXTURESUBIMAGE2D] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPRESSEDTEXTURESUBIMAGE3D] = { 10, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXTURESUBIMAGE1D] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXTURESUBIMAGE2D] = { 8, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COPYTEXTURESUBIMAGE3D] = { 9, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREPARAMETERF] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREPARAMETERFV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREPARAMETERI] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREPARAMETERIIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREPARAMETERIUIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREPARAMETERIV] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENERATETEXTUREMIPMAP] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDTEXTUREUNIT] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTUREIMAGE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETCOMPRESSEDTEXTUREIMAGE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTURELEVELPARAMETERFV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTURELEVELPARAMETERIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTUREPARAMETERFV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTUREPARAMETERIIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTUREPARAMETERIUIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTUREPARAMETERIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEVERTEXARRAYS] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISABLEVERTEXARRAYATTRIB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENABLEVERTEXARRAYATTRIB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYELEMENTBUFFER] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYVERTEXBUFFER] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYVERTEXBUFFERS] = { 3, SGL_CMD_RULE_WORDS, 2, 3, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYATTRIBBINDING] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYATTRIBFORMAT] = { 6, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYATTRIBIFORMAT] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYATTRIBLFORMAT] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_VERTEXARRAYBINDINGDIVISOR] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETVERTEXARRAYIV] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETVERTEXARRAYINDEXEDIV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETVERTEXARRAYINDEXED64IV] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATESAMPLERS] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEPROGRAMPIPELINES] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEQUERIES] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYBUFFEROBJECTI64V] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYBUFFEROBJECTIV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYBUFFEROBJECTUI64V] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETQUERYBUFFEROBJECTUIV] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MEMORYBARRIERBYREGION] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETTEXTURESUBIMAGE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETCOMPRESSEDTEXTURESUBIMAGE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETGRAPHICSRESETSTATUS] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNCOMPRESSEDTEXIMAGE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNTEXIMAGE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNUNIFORMDV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNUNIFORMFV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNUNIFORMIV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNUNIFORMUIV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_READNPIXELS] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNMAPDV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNMAPFV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNMAPIV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNPIXELMAPFV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNPIXELMAPUIV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNPIXELMAPUSV] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNPOLYGONSTIPPLE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNCOLORTABLE] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNCONVOLUTIONFILTER] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNSEPARABLEFILTER] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNHISTOGRAM] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETNMINMAX] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_TEXTUREBARRIER] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_POLYGONOFFSETCLAMP] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETOBJECTPARAMETERIVARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ATTACHOBJECTARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDATTRIBLOCATIONARB] = { 2, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDBUFFERARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BINDPROGRAMARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BUFFERDATAARB] = { 4, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_COMPILESHADERARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATEPROGRAMOBJECTARB] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_CREATESHADEROBJECTARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEBUFFERSARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEOBJECTARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEPROGRAMSARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DELETEQUERIESARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DETACHOBJECTARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENBUFFERSARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENPROGRAMSARB] = { 0, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GENQUERIESARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETINFOLOGARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETPROGRAMIVARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETUNIFORMLOCATIONARB] = { 1, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_LINKPROGRAMARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MAPBUFFERARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMSTRINGARB] = { 3, SGL_CMD_RULE_STRING, 0, 0, 0, 0, true },
+    [SGL_CMD_SHADERSOURCEARB] = { 2, SGL_CMD_RULE_STRINGS, 1, 0, 0, 0, true },
+    [SGL_CMD_UNIFORM1IARB] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_PROGRAMENVPARAMETERS4FVEXT] = { 3, SGL_CMD_RULE_WORDS, 2, 4, 0, 0, true },
+    [SGL_CMD_COLORMASKINDEXEDEXT] = { 5, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ENABLEINDEXEDEXT] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_DISABLEINDEXEDEXT] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_GETBOOLEANINDEXEDVEXT] = { 2, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_ACTIVETEXTUREARB] = { 1, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_MULTITEXCOORD2FARB] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+    [SGL_CMD_BUFFERSUBDATAARB] = { 3, SGL_CMD_RULE_NONE, 0, 0, 0, 0, true },
+};
@@ -1,12 +1,12 @@
 #define SHAREDGL_HOST
 #include <sharedgl.h>
 #include <server/context.h>
-#include <server/overlay.h>
 
 static bool is_vid_init = false;
 static int mw = 1920;
 static int mh = 1080;
 static bool is_overlay_string_init = false;
+static int readback_latency = 0;
 
 void sgl_set_max_resolution(int width, int height)
 {
@@ -20,9 +20,14 @@ void sgl_get_max_resolution(int *width, int *height)
     *height = mh;
 }
 
+void sgl_set_readback_latency(int frames)
+{
+    readback_latency = frames;
+}
+
 struct sgl_host_context *sgl_context_create()
 {
-    struct sgl_host_context *context = (struct sgl_host_context *)malloc(sizeof(struct sgl_host_context));
+    struct sgl_host_context *context = (struct sgl_host_context *)calloc(1, sizeof(struct sgl_host_context));
 
     if (!is_vid_init) {
         SDL_Init(SDL_INIT_VIDEO);
@@ -77,6 +82,8 @@ void sgl_context_destroy(struct sgl_host_context *ctx)
     sgl_set_current(NULL);
     SDL_DestroyWindow(ctx->window);
     SDL_GL_DeleteContext(ctx->gl_context);
+    sgl_names_free(ctx->names);
+    sgl_program_cache_free(&ctx->programs);
     free(ctx);
 }
 
@@ -97,31 +104,229 @@ void sgl_set_current(struct sgl_host_context *ctx)
 #endif
 }
 
-void *sgl_read_pixels(unsigned int width, unsigned int height, void *data, int vflip, int format, size_t mem_usage)
+/*
+ * the client's pixel store state must not leak into our transfers
+ */
+struct sgl_pixel_store {
+    GLint buffer, row_length, skip_pixels, skip_rows, alignment;
+};
+
+static void sgl_pixel_store_save(struct sgl_pixel_store *store, bool pack)
 {
-    static struct overlay_context overlay_ctx = { 0 };
+    glGetIntegerv(pack ? GL_PIXEL_PACK_BUFFER_BINDING : GL_PIXEL_UNPACK_BUFFER_BINDING, &store->buffer);
+    glGetIntegerv(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, &store->row_length);
+    glGetIntegerv(pack ? GL_PACK_SKIP_PIXELS : GL_UNPACK_SKIP_PIXELS, &store->skip_pixels);
+    glGetIntegerv(pack ? GL_PACK_SKIP_ROWS : GL_UNPACK_SKIP_ROWS, &store->skip_rows);
+    glGetIntegerv(pack ? GL_PACK_ALIGNMENT : GL_UNPACK_ALIGNMENT, &store->alignment);
+}
 
-    overlay_stage1(&overlay_ctx);
+static void sgl_pixel_store_set(const struct sgl_pixel_store *store, bool pack)
+{
+    glBindBuffer(pack ? GL_PIXEL_PACK_BUFFER : GL_PIXEL_UNPACK_BUFFER, store->buffer);
+    glPixelStorei(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, store->row_length);
+    glPixelStorei(pack ? GL_PACK_SKIP_PIXELS : GL_UNPACK_SKIP_PIXELS, store->skip_pixels);
+    glPixelStorei(pack ? GL_PACK_SKIP_ROWS : GL_UNPACK_SKIP_ROWS, store->skip_rows);
+    glPixelStorei(pack ? GL_PACK_ALIGNMENT : GL_UNPACK_ALIGNMENT, store->alignment);
+}
 
-    glReadPixels(0, 0, mw, height, format, GL_UNSIGNED_BYTE, data); // GL_BGRA
-    int *pdata = data;
+/*
+ * the framebuffer in memory is always mw pixels wide
+ */
+static void sgl_copy_frame(void *data, const void *src, unsigned int width, unsigned int height)
+{
+    for (unsigned int y = 0; y < height; y++)
+        memcpy(data + (size_t)y * mw * 4, src + (size_t)y * width * 4, width * 4);
+}
+
+/*
+ * bind based gl 3.0 calls only, the host context may not have direct
+ * state access. the client's bindings are put back afterwards
+ */
+static void sgl_composite_init(struct sgl_host_context *ctx)
+{
+    struct sgl_pixel_store unpack, tight = { 0, 0, 0, 0, 4 };
+    GLint renderbuffer, texture, draw_framebuffer;
+
+    glGetIntegerv(GL_RENDERBUFFER_BINDING, &renderbuffer);
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture);
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_framebuffer);
 
-    if (vflip) {
-        for (int y = 0; y < height / 2; y++) {
-            for (int x = 0; x < mw; x++) {
-                int *ptop = &pdata[y * mw + x];
-                int *pbottom = &pdata[(height - y - 1) * mw + x];
+    glGenRenderbuffers(1, &ctx->composite_rbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, ctx->composite_rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, mw, mh);
+    glGenFramebuffers(1, &ctx->composite_fbo);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, ctx->composite_fbo);
+    glFramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, ctx->composite_rbo);
 
-                int vtop = *ptop;
-                int vbottom = *pbottom;
+    /*
+     * a bound unpack buffer would turn the NULL below into an offset
+     */
+    sgl_pixel_store_save(&unpack, false);
+    sgl_pixel_store_set(&tight, false);
+    glGenTextures(1, &ctx->overlay_texture);
+    glBindTexture(GL_TEXTURE_2D, ctx->overlay_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, OVERLAY_IMAGE_WIDTH, OVERLAY_IMAGE_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    sgl_pixel_store_set(&unpack, false);
+    glGenFramebuffers(1, &ctx->overlay_fbo);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, ctx->overlay_fbo);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, ctx->overlay_texture, 0);
 
-                *ptop = vbottom;
-                *pbottom = vtop;
-            }
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, draw_framebuffer);
+}
+
+/*
+ * flips the frame and draws the overlay on the gpu, returns the
+ * framebuffer to read back from. the read framebuffer is left to
+ * the caller
+ */
+static GLuint sgl_composite(struct sgl_host_context *ctx, GLuint source, unsigned int width, unsigned int height, int vflip, int format, bool overlay)
+{
+    if (ctx->composite_fbo == 0)
+        sgl_composite_init(ctx);
+
+    GLint draw_framebuffer;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &draw_framebuffer);
+
+    GLboolean scissor = glIsEnabled(GL_SCISSOR_TEST);
+    if (scissor)
+        glDisable(GL_SCISSOR_TEST);
+
+    /*
+     * rows end up in memory bottom to top, so a flipped
+     * blit puts the top row first
+     */
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, source);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, ctx->composite_fbo);
+    glBlitFramebuffer(
+        0, 0, width, height,
+        0, vflip ? height : 0, width, vflip ? 0 : height,
+        GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+    if (overlay) {
+        struct sgl_pixel_store unpack, tight = { 0, 0, 0, 0, 4 };
+        struct overlay_context *octx = &ctx->overlay_ctx;
+        GLint texture;
+
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture);
+        sgl_pixel_store_save(&unpack, false);
+        sgl_pixel_store_set(&tight, false);
+        glBindTexture(GL_TEXTURE_2D, ctx->overlay_texture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, OVERLAY_IMAGE_WIDTH, OVERLAY_IMAGE_HEIGHT, format, GL_UNSIGNED_BYTE, octx->image);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        sgl_pixel_store_set(&unpack, false);
+
+        /*
+         * the image is uploaded top line first, which is also the
+         * order the composited frame is read back in
+         */
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, ctx->overlay_fbo);
+        for (int i = 0; i < OVERLAY_LINES; i++) {
+            int y0 = i * OVERLAY_LINE_HEIGHT, y1 = y0 + OVERLAY_LINE_HEIGHT;
+            int x1 = octx->line_width[i] < width ? octx->line_width[i] : width;
+            if (y1 > height)
+                break;
+
+            glBlitFramebuffer(
+                0, y0, x1, y1,
+                0, y0, x1, y1,
+                GL_COLOR_BUFFER_BIT, GL_NEAREST);
         }
     }
 
-    overlay_stage2(&overlay_ctx, data, mw, mem_usage);
+    if (scissor)
+        glEnable(GL_SCISSOR_TEST);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, draw_framebuffer);
+
+    return ctx->composite_fbo;
+}
+
+static void sgl_read_pixels_async(struct sgl_host_context *ctx, unsigned int width, unsigned int height, void *data, int format)
+{
+    struct sgl_readback_buffer *current = &ctx->readback[ctx->readback_head];
+
+    if (current->pbo == 0) {
+        glGenBuffers(1, &current->pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, current->pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, (size_t)mw * mh * 4, NULL, GL_STREAM_READ);
+    }
+    else {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, current->pbo);
+    }
+
+    /*
+     * start reading this frame, it is copied out once the
+     * next readback_latency frames were started
+     */
+    glReadPixels(0, 0, width, height, format, GL_UNSIGNED_BYTE, NULL);
+    current->width = width;
+    current->height = height;
+    current->pending = true;
+
+    ctx->readback_head = (ctx->readback_head + 1) % (readback_latency + 1);
+
+    /*
+     * hand out the oldest frame, until the ring fills up it
+     * is kept around so that frames never go backwards
+     */
+    struct sgl_readback_buffer *oldest = NULL;
+    int pending = 0;
+
+    for (int i = 0; i <= readback_latency; i++) {
+        struct sgl_readback_buffer *buffer = &ctx->readback[(ctx->readback_head + i) % (readback_latency + 1)];
+        if (!buffer->pending)
+            continue;
+        if (oldest == NULL)
+            oldest = buffer;
+        pending++;
+    }
+
+    if (pending > readback_latency)
+        oldest->pending = false;
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, oldest->pbo);
+    void *src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (size_t)oldest->width * oldest->height * 4, GL_MAP_READ_BIT);
+    if (src != NULL) {
+        sgl_copy_frame(data, src, oldest->width, oldest->height);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+}
+
+void *sgl_read_pixels(struct sgl_host_context *ctx, unsigned int width, unsigned int height, void *data, int vflip, int format, size_t mem_usage)
+{
+    struct sgl_pixel_store pack;
+    GLint read_framebuffer;
+    bool overlay;
+
+    if (width > mw || height > mh)
+        return data;
+
+    overlay_stage1(&ctx->overlay_ctx);
+    overlay = overlay_stage2(&ctx->overlay_ctx, mem_usage);
+
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &read_framebuffer);
+    if (vflip || overlay)
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, sgl_composite(ctx, read_framebuffer, width, height, vflip, format, overlay));
+
+    sgl_pixel_store_save(&pack, true);
+
+    if (readback_latency > 0) {
+        struct sgl_pixel_store tight = { 0, 0, 0, 0, 4 };
+        sgl_pixel_store_set(&tight, true);
+        sgl_read_pixels_async(ctx, width, height, data, format);
+    }
+    else {
+        struct sgl_pixel_store strided = { 0, mw, 0, 0, 4 };
+        sgl_pixel_store_set(&strided, true);
+        glReadPixels(0, 0, width, height, format, GL_UNSIGNED_BYTE, data); // GL_BGRA
+    }
+
+    sgl_pixel_store_set(&pack, true);
+
+    if (vflip || overlay)
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, read_framebuffer);
 
 #ifdef SGL_DEBUG_EMIT_FRAMES
     SDL_GL_SwapWindow(window);
@@ -6,11 +6,17 @@
 #include <server/processor.h>
 #include <server/overlay.h>
 #include <server/context.h>
+#include <server/programcache.h>
+#include <server/profile.h>
+#include <server/trace.h>
+
+#include <network/fbcodec.h>
 
 #include <unistd.h>
 #include <dirent.h>
 #include <fcntl.h>
 #include <signal.h>
+#include <limits.h>
 
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -24,7 +30,7 @@ static size_t shm_size;
 static int *internal_cmd_ptr;
 
 static const char *usage =
-    "usage: sglrenderer [-h] [-v] [-o] [-n] [-x] [-g MAJOR.MINOR] [-r WIDTHxHEIGHT] [-m SIZE] [-p PORT]\n"
+    "usage: sglrenderer [-h] [-v] [-o] [-n] [-x] [-g MAJOR.MINOR] [-r WIDTHxHEIGHT] [-m SIZE] [-p PORT] [-c COUNT] [-t] [-e MODE] [-s SIZE] [-z LEVEL] [-k FRAMES] [-l FRAMES] [-d DIR] [-b SIZE] [-w FILE] [-f FILE] [-i SECONDS]\n"
     "\n"
     "options:\n"
     "    -h                 display help information\n"
@@ -35,7 +41,19 @@ static const char *usage =
     "    -g [MAJOR.MINOR]   report specific opengl version (default: %d.%d)\n"
     "    -r [WIDTHxHEIGHT]  set max resolution (default: 1920x1080)\n"
     "    -m [SIZE]          max amount of megabytes program may allocate (default: 32mib)\n"
-    "    -p [PORT]          if networking is enabled, specify which port to use (default: 3000)\n";
+    "    -p [PORT]          if networking is enabled, specify which port to use (default: 3000)\n"
+    "    -c [COUNT]         max amount of clients connected at once (default: %d)\n"
+    "    -t                 decode each client on its own thread (shared memory only)\n"
+    "    -e [MODE]          when to check for gl errors: off, submit or command (default: submit)\n"
+    "    -s [SIZE]          if networking is enabled, framebuffer tile size in pixels, %d-%d (default: %d)\n"
+    "    -z [LEVEL]         if networking is enabled, framebuffer compression level, 0-%d (default: %d)\n"
+    "    -k [FRAMES]        if networking is enabled, frames between full framebuffer updates, 0 for never (default: %d)\n"
+    "    -l [FRAMES]        frames of latency to allow when reading back frames, 0-%d, higher is faster (default: 0)\n"
+    "    -d [DIR]           directory to cache linked program binaries in (default: $XDG_CACHE_HOME/sharedgl)\n"
+    "    -b [SIZE]          max megabytes of program binaries to cache, 0 to disable (default: %d)\n"
+    "    -w [FILE]          record every batch clients submit to FILE, for replaying with sglreplay\n"
+    "    -f [FILE]          profile decoding per client and command, written to FILE and the log on SIGUSR1\n"
+    "    -i [SECONDS]       if profiling, also write the profile every SECONDS (default: 0, never)\n";
 
 static void generate_virtual_machine_arguments(size_t m)
 {
@@ -72,9 +90,15 @@ static void term_handler(int sig)
         break;
     }
 
+    sgl_trace_close();
     exit(1);
 }
 
+static void profile_handler(int sig)
+{
+    sgl_profile_request();
+}
+
 static void arg_parser_protector(int sig)
 {
     PRINT_LOG("expected second argument\n");
@@ -91,6 +115,22 @@ int main(int argc, char **argv)
     int major = SGL_DEFAULT_MAJOR;
     int minor = SGL_DEFAULT_MINOR;
 
+    int max_clients = SGL_DEFAULT_SLOTS;
+    bool threaded = false;
+
+    enum sgl_error_check error_check = SGL_ERROR_CHECK_SUBMIT;
+
+    int fb_tile_size = FB_CODEC_DEFAULT_TILE_SIZE;
+    int fb_compression_level = FB_CODEC_DEFAULT_LEVEL;
+    int fb_keyframe_interval = FB_CODEC_DEFAULT_KEYFRAME_INTERVAL;
+
+    char program_cache_directory[PATH_MAX] = { 0 };
+    int program_cache_size = SGL_PROGRAM_CACHE_DEFAULT_SIZE;
+
+    const char *trace_path = NULL;
+    const char *profile_path = NULL;
+    int profile_interval = 0;
+
     shm_size = 32;
 
     signal(SIGSEGV, arg_parser_protector);
@@ -98,7 +138,12 @@ int main(int argc, char **argv)
     for (int i = 1; i < argc; i++) {
         switch (argv[i][1]) {
         case 'h':
-            fprintf(stderr, usage, SGL_DEFAULT_MAJOR, SGL_DEFAULT_MINOR);
+            fprintf(stderr, usage, SGL_DEFAULT_MAJOR, SGL_DEFAULT_MINOR, SGL_DEFAULT_SLOTS,
+                FB_CODEC_MIN_TILE_SIZE, FB_CODEC_MAX_TILE_SIZE, FB_CODEC_DEFAULT_TILE_SIZE,
+                FB_CODEC_MAX_LEVEL, FB_CODEC_DEFAULT_LEVEL,
+                FB_CODEC_DEFAULT_KEYFRAME_INTERVAL,
+                SGL_READBACK_MAX_LATENCY,
+                SGL_PROGRAM_CACHE_DEFAULT_SIZE);
             return 0;
         case 'v':
             print_virtual_machine_arguments = true;
@@ -138,6 +183,90 @@ int main(int argc, char **argv)
             port = atoi(argv[i + 1]);
             i++;
             break;
+        case 'c':
+            max_clients = atoi(argv[i + 1]);
+            if (max_clients < 1 || max_clients > SGL_MAX_SLOTS) {
+                PRINT_LOG("client count must be between 1 and %ld\n", SGL_MAX_SLOTS);
+                return 1;
+            }
+            i++;
+            break;
+        case 't':
+            threaded = true;
+            break;
+        case 'e':
+            if (strcmp(argv[i + 1], "off") == 0)
+                error_check = SGL_ERROR_CHECK_OFF;
+            else if (strcmp(argv[i + 1], "submit") == 0)
+                error_check = SGL_ERROR_CHECK_SUBMIT;
+            else if (strcmp(argv[i + 1], "command") == 0)
+                error_check = SGL_ERROR_CHECK_COMMAND;
+            else
+                PRINT_LOG("unrecognized error check mode '%s'\n", argv[i + 1]);
+            i++;
+            break;
+        case 's':
+            fb_tile_size = atoi(argv[i + 1]);
+            if (fb_tile_size < FB_CODEC_MIN_TILE_SIZE || fb_tile_size > FB_CODEC_MAX_TILE_SIZE) {
+                PRINT_LOG("tile size must be between %d and %d\n", FB_CODEC_MIN_TILE_SIZE, FB_CODEC_MAX_TILE_SIZE);
+                return 1;
+            }
+            i++;
+            break;
+        case 'z':
+            fb_compression_level = atoi(argv[i + 1]);
+            if (fb_compression_level < 0 || fb_compression_level > FB_CODEC_MAX_LEVEL) {
+                PRINT_LOG("compression level must be between 0 and %d\n", FB_CODEC_MAX_LEVEL);
+                return 1;
+            }
+            i++;
+            break;
+        case 'l': {
+            int latency = atoi(argv[i + 1]);
+            if (latency < 0 || latency > SGL_READBACK_MAX_LATENCY) {
+                PRINT_LOG("readback latency must be between 0 and %d\n", SGL_READBACK_MAX_LATENCY);
+                return 1;
+            }
+            sgl_set_readback_latency(latency);
+            i++;
+            break;
+        }
+        case 'd':
+            snprintf(program_cache_directory, sizeof(program_cache_directory), "%s", argv[i + 1]);
+            i++;
+            break;
+        case 'b':
+            program_cache_size = atoi(argv[i + 1]);
+            if (program_cache_size < 0) {
+                PRINT_LOG("program cache size may not be negative\n");
+                return 1;
+            }
+            i++;
+            break;
+        case 'w':
+            trace_path = argv[i + 1];
+            i++;
+            break;
+        case 'f':
+            profile_path = argv[i + 1];
+            i++;
+            break;
+        case 'i':
+            profile_interval = atoi(argv[i + 1]);
+            if (profile_interval < 0) {
+                PRINT_LOG("profile interval may not be negative\n");
+                return 1;
+            }
+            i++;
+            break;
+        case 'k':
+            fb_keyframe_interval = atoi(argv[i + 1]);
+            if (fb_keyframe_interval < 0) {
+                PRINT_LOG("keyframe interval may not be negative\n");
+                return 1;
+            }
+            i++;
+            break;
         default:
             PRINT_LOG("unrecognized command-line option '%s'\n", argv[i]);
         }
@@ -146,6 +275,7 @@ int main(int argc, char **argv)
     signal(SIGINT, term_handler);
     signal(SIGSEGV, term_handler);
     signal(SIGPIPE, SIG_IGN);
+    signal(SIGUSR1, profile_handler);
 
     PRINT_LOG("press CTRL+C to terminate server\n");
 
@@ -190,6 +320,19 @@ int main(int argc, char **argv)
         .gl_major = major,
         .gl_minor = minor,
 
+        .max_clients = max_clients,
+        .threaded = threaded,
+        .error_check = error_check,
+
+        .fb_tile_size = fb_tile_size,
+        .fb_compression_level = fb_compression_level,
+        .fb_keyframe_interval = fb_keyframe_interval,
+
+        .trace_path = trace_path,
+
+        .profile_path = profile_path,
+        .profile_interval = profile_interval,
+
         .internal_cmd_ptr = &internal_cmd_ptr,
     };
 
@@ -198,5 +341,16 @@ int main(int argc, char **argv)
     PRINT_LOG("maximum resolution set to %dx%d\n", mw, mh);
     PRINT_LOG("reporting gl version %d.%d\n", major, minor);
 
+    if (program_cache_directory[0] == '\0') {
+        const char *xdg_cache_home = getenv("XDG_CACHE_HOME");
+        const char *home = getenv("HOME");
+        if (xdg_cache_home != NULL && xdg_cache_home[0] != '\0')
+            snprintf(program_cache_directory, sizeof(program_cache_directory), "%s/sharedgl", xdg_cache_home);
+        else if (home != NULL)
+            snprintf(program_cache_directory, sizeof(program_cache_directory), "%s/.cache/sharedgl", home);
+    }
+
+    sgl_program_cache_init(program_cache_directory[0] != '\0' ? program_cache_directory : NULL, (size_t)program_cache_size * 1024 * 1024);
+
     sgl_cmd_processor_start(args);
 }
\ No newline at end of file
@@ -0,0 +1,274 @@
+#include <server/names.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * names past this are refused rather than growing the table without bound
+ */
+#define SGL_NAMES_MAX (1 << 24)
+
+static GLuint sgl_names_gen_real(enum sgl_name_type type)
+{
+    GLuint real = 0;
+
+    switch (type) {
+    case SGL_NAME_BUFFER:
+        glGenBuffers(1, &real);
+        break;
+    case SGL_NAME_TEXTURE:
+        glGenTextures(1, &real);
+        break;
+    case SGL_NAME_QUERY:
+        glGenQueries(1, &real);
+        break;
+    case SGL_NAME_FRAMEBUFFER:
+        glGenFramebuffers(1, &real);
+        break;
+    case SGL_NAME_RENDERBUFFER:
+        glGenRenderbuffers(1, &real);
+        break;
+    case SGL_NAME_VERTEX_ARRAY:
+        glGenVertexArrays(1, &real);
+        break;
+    default:
+        break;
+    }
+
+    return real;
+}
+
+static GLuint sgl_names_create_real(enum sgl_name_type type, GLenum target)
+{
+    GLuint real = 0;
+
+    switch (type) {
+    case SGL_NAME_BUFFER:
+        glCreateBuffers(1, &real);
+        break;
+    case SGL_NAME_TEXTURE:
+        glCreateTextures(target, 1, &real);
+        break;
+    case SGL_NAME_QUERY:
+        glCreateQueries(target, 1, &real);
+        break;
+    case SGL_NAME_FRAMEBUFFER:
+        glCreateFramebuffers(1, &real);
+        break;
+    case SGL_NAME_RENDERBUFFER:
+        glCreateRenderbuffers(1, &real);
+        break;
+    case SGL_NAME_VERTEX_ARRAY:
+        glCreateVertexArrays(1, &real);
+        break;
+    default:
+        break;
+    }
+
+    return real;
+}
+
+static void sgl_names_delete_real(enum sgl_name_type type, GLuint real)
+{
+    switch (type) {
+    case SGL_NAME_BUFFER:
+        glDeleteBuffers(1, &real);
+        break;
+    case SGL_NAME_TEXTURE:
+        glDeleteTextures(1, &real);
+        break;
+    case SGL_NAME_QUERY:
+        glDeleteQueries(1, &real);
+        break;
+    case SGL_NAME_FRAMEBUFFER:
+        glDeleteFramebuffers(1, &real);
+        break;
+    case SGL_NAME_RENDERBUFFER:
+        glDeleteRenderbuffers(1, &real);
+        break;
+    case SGL_NAME_VERTEX_ARRAY:
+        glDeleteVertexArrays(1, &real);
+        break;
+    default:
+        break;
+    }
+}
+
+/*
+ * client names are handed out densely starting at 1, so the
+ * table is indexed by the client name directly
+ */
+static GLuint *sgl_names_slot(struct sgl_name_table *table, GLuint name)
+{
+    if (name >= SGL_NAMES_MAX)
+        return NULL;
+
+    if (name >= table->size) {
+        GLuint size = table->size ? table->size : 256;
+        while (size <= name)
+            size *= 2;
+
+        GLuint *names = realloc(table->names, size * sizeof(GLuint));
+        if (names == NULL)
+            return NULL;
+
+        memset(names + table->size, 0, (size - table->size) * sizeof(GLuint));
+        table->names = names;
+        table->size = size;
+    }
+
+    return &table->names[name];
+}
+
+void sgl_names_gen(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name)
+{
+    GLuint *slot = name ? sgl_names_slot(&tables[type], name) : NULL;
+
+    if (slot != NULL && *slot == 0)
+        *slot = sgl_names_gen_real(type);
+}
+
+void sgl_names_create(struct sgl_name_table *tables, enum sgl_name_type type, GLenum target, GLuint name)
+{
+    GLuint *slot = name ? sgl_names_slot(&tables[type], name) : NULL;
+
+    if (slot == NULL)
+        return;
+
+    if (*slot != 0)
+        sgl_names_delete_real(type, *slot);
+    *slot = sgl_names_create_real(type, target);
+}
+
+GLuint sgl_names_get(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name)
+{
+    GLuint *slot = name ? sgl_names_slot(&tables[type], name) : NULL;
+
+    if (slot == NULL)
+        return 0;
+
+    if (*slot == 0)
+        *slot = sgl_names_gen_real(type);
+    return *slot;
+}
+
+void sgl_names_get_array(struct sgl_name_table *tables, enum sgl_name_type type, GLsizei n, const GLuint *names, GLuint *real)
+{
+    for (GLsizei i = 0; i < n; i++)
+        real[i] = sgl_names_get(tables, type, names[i]);
+}
+
+GLuint sgl_names_find(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name)
+{
+    struct sgl_name_table *table = &tables[type];
+    return name < table->size ? table->names[name] : 0;
+}
+
+GLuint sgl_names_delete(struct sgl_name_table *tables, enum sgl_name_type type, GLuint name)
+{
+    struct sgl_name_table *table = &tables[type];
+    GLuint real = 0;
+
+    if (name < table->size) {
+        real = table->names[name];
+        table->names[name] = 0;
+    }
+
+    return real;
+}
+
+static bool sgl_names_pname_type(GLenum pname, enum sgl_name_type *type)
+{
+    switch (pname) {
+    case GL_ARRAY_BUFFER_BINDING:
+    case GL_ELEMENT_ARRAY_BUFFER_BINDING:
+    case GL_PIXEL_PACK_BUFFER_BINDING:
+    case GL_PIXEL_UNPACK_BUFFER_BINDING:
+    case GL_UNIFORM_BUFFER_BINDING:
+    case GL_TRANSFORM_FEEDBACK_BUFFER_BINDING:
+    case GL_COPY_READ_BUFFER_BINDING:
+    case GL_COPY_WRITE_BUFFER_BINDING:
+    case GL_DRAW_INDIRECT_BUFFER_BINDING:
+    case GL_DISPATCH_INDIRECT_BUFFER_BINDING:
+    case GL_SHADER_STORAGE_BUFFER_BINDING:
+    case GL_ATOMIC_COUNTER_BUFFER_BINDING:
+    case GL_QUERY_BUFFER_BINDING:
+    case GL_TEXTURE_BUFFER_BINDING:
+    case GL_PARAMETER_BUFFER_BINDING_ARB:
+    case GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING:
+    case GL_TEXTURE_BUFFER_DATA_STORE_BINDING:
+    case GL_VERTEX_ARRAY_BUFFER_BINDING:
+    case GL_NORMAL_ARRAY_BUFFER_BINDING:
+    case GL_COLOR_ARRAY_BUFFER_BINDING:
+    case GL_INDEX_ARRAY_BUFFER_BINDING:
+    case GL_TEXTURE_COORD_ARRAY_BUFFER_BINDING:
+    case GL_EDGE_FLAG_ARRAY_BUFFER_BINDING:
+    case GL_SECONDARY_COLOR_ARRAY_BUFFER_BINDING:
+    case GL_FOG_COORD_ARRAY_BUFFER_BINDING:
+        *type = SGL_NAME_BUFFER;
+        return true;
+    case GL_TEXTURE_BINDING_1D:
+    case GL_TEXTURE_BINDING_2D:
+    case GL_TEXTURE_BINDING_3D:
+    case GL_TEXTURE_BINDING_1D_ARRAY:
+    case GL_TEXTURE_BINDING_2D_ARRAY:
+    case GL_TEXTURE_BINDING_RECTANGLE:
+    case GL_TEXTURE_BINDING_CUBE_MAP:
+    case GL_TEXTURE_BINDING_CUBE_MAP_ARRAY:
+    case GL_TEXTURE_BINDING_BUFFER:
+    case GL_TEXTURE_BINDING_2D_MULTISAMPLE:
+    case GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY:
+    case GL_IMAGE_BINDING_NAME:
+        *type = SGL_NAME_TEXTURE;
+        return true;
+    case GL_CURRENT_QUERY:
+        *type = SGL_NAME_QUERY;
+        return true;
+    case GL_DRAW_FRAMEBUFFER_BINDING:
+    case GL_READ_FRAMEBUFFER_BINDING:
+        *type = SGL_NAME_FRAMEBUFFER;
+        return true;
+    case GL_RENDERBUFFER_BINDING:
+        *type = SGL_NAME_RENDERBUFFER;
+        return true;
+    case GL_VERTEX_ARRAY_BINDING:
+        *type = SGL_NAME_VERTEX_ARRAY;
+        return true;
+    }
+
+    return false;
+}
+
+GLuint sgl_names_reverse(struct sgl_name_table *tables, enum sgl_name_type type, GLuint real)
+{
+    struct sgl_name_table *table = &tables[type];
+
+    if (real == 0)
+        return 0;
+
+    for (GLuint i = 1; i < table->size; i++)
+        if (table->names[i] == real)
+            return i;
+
+    /*
+     * not a name the client knows about, which shouldn't happen
+     */
+    return 0;
+}
+
+void sgl_names_reverse_query(struct sgl_name_table *tables, GLenum pname, GLint *data)
+{
+    enum sgl_name_type type;
+
+    if (sgl_names_pname_type(pname, &type))
+        data[0] = sgl_names_reverse(tables, type, data[0]);
+}
+
+void sgl_names_free(struct sgl_name_table *tables)
+{
+    for (int i = 0; i < SGL_NAME_TYPE_COUNT; i++) {
+        free(tables[i].names);
+        tables[i].names = NULL;
+        tables[i].size = 0;
+    }
+}
\ No newline at end of file
@@ -5,41 +5,30 @@
 
 #include <server/overlay_font.h>
 
-static void overlay_draw_char(int *display, int width, char c, int x, int y, unsigned int fg) 
+/*
+ * glyphs are drawn over an opaque backdrop, a row of a glyph at a time
+ */
+#define OVERLAY_BACKGROUND 0xff000000
+
+static int overlay_draw_text(struct overlay_context *ctx, int line, const char *text, unsigned int fg)
 {
-    int mask[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
-    const unsigned char *gylph = IBM + (int)c * CHAR_HEIGHT;
-
-    unsigned char *color;
-
-    for (int cy = 0; cy < CHAR_HEIGHT; cy++)
-        for (int cx = 0; cx < CHAR_WIDTH; cx++) {
-            /*
-             * darken pixels
-             */
-            color = (unsigned char*)&display[(y + cy) * width + (x + ((CHAR_WIDTH - 1) - cx))];
-            color[0] = color[0] * 120 / 255;
-            color[1] = color[1] * 120 / 255;
-            color[2] = color[2] * 120 / 255;
-            color[3] = color[3] * 120 / 255;
-
-            if (gylph[cy] & mask[cx])
-                display[(y + cy) * width + (x + ((CHAR_WIDTH - 1) - cx))] = fg;
+    int columns = strlen(text);
+    if (columns > OVERLAY_COLUMNS)
+        columns = OVERLAY_COLUMNS;
+
+    for (int cy = 0; cy < CHAR_HEIGHT; cy++) {
+        unsigned int *row = ctx->image[line * CHAR_HEIGHT + cy];
+
+        for (int i = 0; i < columns; i++) {
+            unsigned char bits = IBM[(unsigned char)text[i] * CHAR_HEIGHT + cy];
+            unsigned int *pixel = &row[i * CHAR_WIDTH];
+
+            for (int cx = 0; cx < CHAR_WIDTH; cx++)
+                pixel[cx] = bits & (0x80 >> cx) ? fg : OVERLAY_BACKGROUND;
         }
-}
+    }
 
-static void overlay_draw_text(int *display, int width, char *text, int x, int y, unsigned int fg) 
-{
-    char* c = text;
-    for (int i = x; *c; i += CHAR_WIDTH)
-        overlay_draw_char(
-            display,
-            width,
-            *c++,
-            i,
-            y,
-            fg
-        );
+    return columns * CHAR_WIDTH;
 }
 
 static bool overlay_enabled = false;
@@ -65,10 +54,12 @@ void overlay_stage1(struct overlay_context *ctx)
         ctx->fps = CLOCKS_PER_SEC / ctx->delta_ticks;
 }
 
-void overlay_stage2(struct overlay_context *ctx, int *frame, int width, size_t mem_usage)
+bool overlay_stage2(struct overlay_context *ctx, size_t mem_usage)
 {
+    bool drawn = false;
+
     if (!overlay_enabled)
-        return;
+        return false;
 
     double usage = mem_usage;
     bool is_mb = false;
@@ -82,15 +73,18 @@ void overlay_stage2(struct overlay_context *ctx, int *frame, int width, size_t m
     }
 
     if (ctx->current_ticks) {
-        char str[12];
+        char str[24];
         char mem[24];
-        sprintf(str, "FPS: %ld", ctx->fps);
+        sprintf(str, "FPS: %ld", (long)ctx->fps);
         sprintf(mem, "MEM: %.2f %s", usage, is_mb ? "MB" : "KB");
 
-        overlay_draw_text(frame, width, overlay_string, 0, CHAR_HEIGHT * 0, 0xffffff);
-        overlay_draw_text(frame, width, mem, 0, CHAR_HEIGHT * 1, 0xffffff);
-        overlay_draw_text(frame, width, str, 0, CHAR_HEIGHT * 2, 0xffffff);
+        ctx->line_width[0] = overlay_draw_text(ctx, 0, overlay_string, 0xffffffff);
+        ctx->line_width[1] = overlay_draw_text(ctx, 1, mem, 0xffffffff);
+        ctx->line_width[2] = overlay_draw_text(ctx, 2, str, 0xffffffff);
+        drawn = true;
     }
 
     ctx->current_ticks = clock();
+
+    return drawn;
 }
\ No newline at end of file
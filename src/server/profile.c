@@ -0,0 +1,256 @@
+#define SHAREDGL_HOST
+#include <sharedgl.h>
+#include <sgldebug.h>
+#include <server/profile.h>
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool profiling = false;
+static const char *profile_path = NULL;
+static uint64_t profile_interval_ns;
+static uint64_t profile_last_dump;
+static volatile sig_atomic_t profile_requested = 0;
+
+static struct sgl_profile *profiles = NULL;
+static pthread_mutex_t profile_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void sgl_profile_enable(const char *path, int interval)
+{
+    profiling = true;
+    profile_path = path;
+    profile_interval_ns = (uint64_t)interval * 1000000000;
+    profile_last_dump = sgl_profile_now();
+
+    PRINT_LOG("profiling decoding%s%s\n", path != NULL ? ", writing json to " : "", path != NULL ? path : "");
+}
+
+bool sgl_profile_enabled(void)
+{
+    return profiling;
+}
+
+static int sgl_profile_sort(const struct sgl_profile *profile, int *order);
+static void sgl_profile_log(const struct sgl_profile *profile, const int *order, int count);
+
+struct sgl_profile *sgl_profile_create(int client_id)
+{
+    struct sgl_profile *profile = calloc(1, sizeof(struct sgl_profile));
+    if (profile == NULL) {
+        PRINT_LOG("failed to allocate a profile for client %d, not profiling it\n", client_id);
+        return NULL;
+    }
+
+    profile->client_id = client_id;
+
+    pthread_mutex_lock(&profile_mutex);
+    profile->next = profiles;
+    profiles = profile;
+    pthread_mutex_unlock(&profile_mutex);
+
+    return profile;
+}
+
+void sgl_profile_destroy(struct sgl_profile *profile)
+{
+    if (profile == NULL)
+        return;
+
+    static int order[SGL_CMD_MAX];
+
+    /*
+     * kept for the json until the next dump, which frees it
+     */
+    pthread_mutex_lock(&profile_mutex);
+    profile->exited = true;
+    sgl_profile_log(profile, order, sgl_profile_sort(profile, order));
+    pthread_mutex_unlock(&profile_mutex);
+}
+
+void sgl_profile_request(void)
+{
+    profile_requested = 1;
+}
+
+void sgl_profile_poll(void)
+{
+    if (!profiling)
+        return;
+
+    bool due = profile_interval_ns != 0 && sgl_profile_now() - profile_last_dump >= profile_interval_ns;
+    if (profile_requested || due) {
+        profile_requested = 0;
+        sgl_profile_dump();
+    }
+}
+
+/*
+ * the upper bound of the bucket holding the given fraction of calls
+ */
+static double sgl_profile_percentile_us(const struct sgl_profile_stats *stats, double fraction)
+{
+    uint64_t target = stats->calls * fraction, seen = 0;
+
+    for (int i = 0; i < SGL_PROFILE_BUCKETS; i++) {
+        seen += stats->histogram[i];
+        if (seen > target)
+            return (double)(2ull << i) / 1000.0;
+    }
+
+    return (double)(2ull << (SGL_PROFILE_BUCKETS - 1)) / 1000.0;
+}
+
+static const struct sgl_profile *sort_profile;
+
+static int compare_commands(const void *a, const void *b)
+{
+    uint64_t x = sort_profile->commands[*(const int*)a].ns,
+             y = sort_profile->commands[*(const int*)b].ns;
+    return (x < y) - (x > y);
+}
+
+/*
+ * fills order with the commands the client used, most time first
+ */
+static int sgl_profile_sort(const struct sgl_profile *profile, int *order)
+{
+    int count = 0;
+
+    for (int i = 0; i < SGL_CMD_MAX; i++)
+        if (profile->commands[i].calls > 0)
+            order[count++] = i;
+
+    sort_profile = profile;
+    qsort(order, count, sizeof(int), compare_commands);
+
+    return count;
+}
+
+static void sgl_profile_log(const struct sgl_profile *profile, const int *order, int count)
+{
+    const struct sgl_profile_stats *submits = &profile->submits;
+    uint64_t total = 0;
+
+    for (int i = 0; i < count; i++)
+        total += profile->commands[order[i]].ns;
+
+    PRINT_LOG("--------------------------------------------------------\n");
+    PRINT_LOG("client %d%s: %lu submits, %lu commands, %.1f MiB, %.3f ms decoding\n",
+        profile->client_id, profile->exited ? " (disconnected)" : "",
+        submits->calls, profile->submit_commands, submits->bytes / (1024.0 * 1024.0), submits->ns / 1e6);
+
+    if (submits->calls > 0)
+        PRINT_LOG("submits: mean %.1f us, median < %.1f us, 99th percentile < %.1f us\n",
+            submits->ns / 1e3 / submits->calls, sgl_profile_percentile_us(submits, 0.5), sgl_profile_percentile_us(submits, 0.99));
+
+    PRINT_LOG("%-40s %10s %10s %6s %10s %10s %12s\n", "command", "calls", "ms", "%", "mean us", "p99 us", "bytes");
+    for (int i = 0; i < count && i < SGL_PROFILE_TABLE_ROWS; i++) {
+        const struct sgl_profile_stats *stats = &profile->commands[order[i]];
+        PRINT_LOG("%-40s %10lu %10.3f %6.2f %10.2f %10.1f %12lu\n",
+            sgl_cmd2str(order[i]), stats->calls, stats->ns / 1e6, total > 0 ? stats->ns * 100.0 / total : 0.0,
+            stats->ns / 1e3 / stats->calls, sgl_profile_percentile_us(stats, 0.99), stats->bytes);
+    }
+}
+
+static void sgl_profile_json_stats(FILE *file, const struct sgl_profile_stats *stats)
+{
+    fprintf(file, "\"calls\": %lu, \"bytes\": %lu, \"ns\": %lu, \"histogram\": [", stats->calls, stats->bytes, stats->ns);
+
+    /*
+     * trailing empty buckets are left out
+     */
+    int last = SGL_PROFILE_BUCKETS - 1;
+    while (last > 0 && stats->histogram[last] == 0)
+        last--;
+
+    for (int i = 0; i <= last; i++)
+        fprintf(file, "%s%u", i ? ", " : "", stats->histogram[i]);
+    fprintf(file, "]");
+}
+
+static void sgl_profile_json(FILE *file, const struct sgl_profile *profile, const int *order, int count)
+{
+    fprintf(file, "    {\n");
+    fprintf(file, "      \"client_id\": %d,\n", profile->client_id);
+    fprintf(file, "      \"connected\": %s,\n", profile->exited ? "false" : "true");
+    fprintf(file, "      \"submits\": { \"commands\": %lu, ", profile->submit_commands);
+    sgl_profile_json_stats(file, &profile->submits);
+    fprintf(file, " },\n");
+    fprintf(file, "      \"commands\": [");
+
+    for (int i = 0; i < count; i++) {
+        fprintf(file, "%s\n        { \"command\": \"%s\", \"id\": %d, ", i ? "," : "", sgl_cmd2str(order[i]), order[i]);
+        sgl_profile_json_stats(file, &profile->commands[order[i]]);
+        fprintf(file, " }");
+    }
+
+    fprintf(file, "\n      ]\n");
+    fprintf(file, "    }");
+}
+
+/*
+ * logs every profile and replaces the json with them. the json is
+ * written next to its path first so that readers never see half of it
+ */
+void sgl_profile_dump(void)
+{
+    static int order[SGL_CMD_MAX];
+
+    pthread_mutex_lock(&profile_mutex);
+
+    FILE *file = NULL;
+    char temporary[4096];
+
+    if (profile_path != NULL) {
+        snprintf(temporary, sizeof(temporary), "%s.tmp", profile_path);
+        file = fopen(temporary, "w");
+        if (file == NULL)
+            PRINT_LOG("failed to open '%s', not writing the profile\n", temporary);
+    }
+
+    if (file != NULL) {
+        fprintf(file, "{\n");
+        fprintf(file, "  \"clients\": [");
+    }
+
+    for (struct sgl_profile *profile = profiles; profile; profile = profile->next) {
+        int count = sgl_profile_sort(profile, order);
+
+        sgl_profile_log(profile, order, count);
+
+        if (file != NULL) {
+            fprintf(file, "%s\n", profile != profiles ? "," : "");
+            sgl_profile_json(file, profile, order, count);
+        }
+    }
+
+    if (file != NULL) {
+        fprintf(file, "\n  ]\n");
+        fprintf(file, "}\n");
+        fclose(file);
+
+        if (rename(temporary, profile_path) == -1)
+            PRINT_LOG("failed to replace '%s'\n", profile_path);
+    }
+
+    /*
+     * clients that have left were just dumped for the last time
+     */
+    for (struct sgl_profile **link = &profiles; *link;) {
+        struct sgl_profile *profile = *link;
+        if (profile->exited) {
+            *link = profile->next;
+            free(profile);
+        }
+        else {
+            link = &profile->next;
+        }
+    }
+
+    profile_last_dump = sgl_profile_now();
+
+    pthread_mutex_unlock(&profile_mutex);
+}
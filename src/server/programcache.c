@@ -0,0 +1,757 @@
+#define SHAREDGL_HOST
+#include <sharedgl.h>
+#include <server/programcache.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+#include <sys/time.h>
+
+/*
+ * programs never have more shaders than this attached in practice,
+ * programs with more are linked without the cache
+ */
+#define SGL_PROGRAM_CACHE_MAX_SHADERS 8
+
+#define SGL_PROGRAM_CACHE_MAGIC 0x50474c53 // SGLP
+
+#define SGL_HASH_SEED 0xcbf29ce484222325ull
+#define SGL_HASH_PRIME 0x100000001b3ull
+
+/*
+ * followed by the keys of the program's shaders, then the binary
+ */
+struct sgl_program_cache_header {
+    uint32_t magic;
+    uint32_t format;
+    uint64_t key;
+    uint64_t length;
+    uint32_t shader_count;
+    uint32_t reserved;
+};
+
+struct sgl_program_cache_entry {
+    uint64_t key;
+    size_t size;
+    uint64_t used; /* microseconds */
+};
+
+/*
+ * the index mirrors the directory, every client thread shares it
+ */
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static char *cache_directory = NULL;
+static size_t cache_max_size = 0;
+static size_t cache_size = 0;
+
+static struct sgl_program_cache_entry *entries = NULL;
+static int entry_count = 0, entry_capacity = 0;
+
+static unsigned int cache_hits = 0, cache_misses = 0;
+
+/*
+ * shaders that are known to compile, taken from the binaries. a pending
+ * shader found here reports a successful compile without compiling
+ */
+static uint64_t *known_shaders = NULL;
+static int known_shader_count = 0, known_shader_capacity = 0;
+
+/*
+ * the driver is part of every key, binaries don't survive driver updates
+ */
+static bool driver_known = false;
+static bool driver_supported = false;
+static uint64_t driver_hash = 0;
+
+static uint64_t sgl_hash(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= SGL_HASH_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t sgl_hash_string(uint64_t hash, const char *string)
+{
+    if (string == NULL)
+        return hash;
+    return sgl_hash(hash, string, strlen(string) + 1);
+}
+
+static void sgl_program_cache_path(char *path, size_t size, uint64_t key)
+{
+    snprintf(path, size, "%s/%016" PRIx64 ".bin", cache_directory, key);
+}
+
+static bool sgl_make_directory(const char *directory)
+{
+    char path[PATH_MAX];
+
+    snprintf(path, sizeof(path), "%s", directory);
+    for (char *c = path + 1; *c; c++) {
+        if (*c != '/')
+            continue;
+        *c = '\0';
+        mkdir(path, S_IRWXU);
+        *c = '/';
+    }
+
+    return mkdir(path, S_IRWXU) == 0 || errno == EEXIST;
+}
+
+static uint64_t sgl_microseconds(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static int sgl_program_cache_find(uint64_t key)
+{
+    for (int i = 0; i < entry_count; i++)
+        if (entries[i].key == key)
+            return i;
+    return -1;
+}
+
+/*
+ * expects cache_lock to be held
+ */
+static bool sgl_known_shader_find(uint64_t key)
+{
+    for (int i = 0; i < known_shader_count; i++)
+        if (known_shaders[i] == key)
+            return true;
+    return false;
+}
+
+static void sgl_known_shaders_add(const uint64_t *keys, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (sgl_known_shader_find(keys[i]))
+            continue;
+
+        if (known_shader_count == known_shader_capacity) {
+            int capacity = known_shader_capacity ? known_shader_capacity * 2 : 64;
+            uint64_t *grown = realloc(known_shaders, capacity * sizeof(*grown));
+            if (grown == NULL)
+                return;
+            known_shaders = grown;
+            known_shader_capacity = capacity;
+        }
+
+        known_shaders[known_shader_count++] = keys[i];
+    }
+}
+
+static void sgl_program_cache_add(uint64_t key, size_t size, uint64_t used)
+{
+    if (entry_count == entry_capacity) {
+        int capacity = entry_capacity ? entry_capacity * 2 : 64;
+        struct sgl_program_cache_entry *grown = realloc(entries, capacity * sizeof(*entries));
+        if (grown == NULL)
+            return;
+        entries = grown;
+        entry_capacity = capacity;
+    }
+
+    entries[entry_count++] = (struct sgl_program_cache_entry) {
+        /* key = */ key,
+        /* size = */ size,
+        /* used = */ used
+    };
+    cache_size += size;
+}
+
+/*
+ * expects cache_lock to be held
+ */
+static void sgl_program_cache_remove(int index)
+{
+    char path[PATH_MAX];
+
+    sgl_program_cache_path(path, sizeof(path), entries[index].key);
+    unlink(path);
+
+    cache_size -= entries[index].size;
+    entries[index] = entries[--entry_count];
+}
+
+static void sgl_program_cache_evict(void)
+{
+    while (cache_size > cache_max_size && entry_count > 0) {
+        int oldest = 0;
+        for (int i = 1; i < entry_count; i++)
+            if (entries[i].used < entries[oldest].used)
+                oldest = i;
+        sgl_program_cache_remove(oldest);
+    }
+}
+
+void sgl_program_cache_init(const char *directory, size_t max_size)
+{
+    if (directory == NULL || max_size == 0)
+        return;
+
+    if (!sgl_make_directory(directory)) {
+        PRINT_LOG("failed to create program cache directory '%s', program cache disabled\n", directory);
+        return;
+    }
+
+    DIR *dir = opendir(directory);
+    if (dir == NULL) {
+        PRINT_LOG("failed to open program cache directory '%s', program cache disabled\n", directory);
+        return;
+    }
+
+    cache_directory = strdup(directory);
+    cache_max_size = max_size;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        char path[PATH_MAX];
+        struct stat st;
+        char *end;
+
+        uint64_t key = strtoull(entry->d_name, &end, 16);
+        if (end != entry->d_name + 16 || strcmp(end, ".bin") != 0)
+            continue;
+
+        sgl_program_cache_path(path, sizeof(path), key);
+        if (stat(path, &st) != 0)
+            continue;
+
+        FILE *file = fopen(path, "rb");
+        if (file == NULL)
+            continue;
+
+        struct sgl_program_cache_header header;
+        uint64_t shaders[SGL_PROGRAM_CACHE_MAX_SHADERS];
+
+        if (fread(&header, sizeof(header), 1, file) == 1
+            && header.magic == SGL_PROGRAM_CACHE_MAGIC
+            && header.key == key
+            && header.shader_count <= SGL_PROGRAM_CACHE_MAX_SHADERS
+            && fread(shaders, sizeof(*shaders), header.shader_count, file) == header.shader_count) {
+            sgl_program_cache_add(key, st.st_size, (uint64_t)st.st_mtim.tv_sec * 1000000 + st.st_mtim.tv_nsec / 1000);
+            sgl_known_shaders_add(shaders, header.shader_count);
+        }
+
+        fclose(file);
+    }
+
+    closedir(dir);
+
+    sgl_program_cache_evict();
+
+    PRINT_LOG("caching program binaries in %s, %d cached (%ld KiB)\n", cache_directory, entry_count, cache_size / 1024);
+}
+
+void sgl_program_cache_stats(unsigned int *hits, unsigned int *misses)
+{
+    pthread_mutex_lock(&cache_lock);
+    *hits = cache_hits;
+    *misses = cache_misses;
+    pthread_mutex_unlock(&cache_lock);
+}
+
+static bool sgl_program_cache_usable(void)
+{
+    if (cache_directory == NULL)
+        return false;
+
+    pthread_mutex_lock(&cache_lock);
+    if (!driver_known) {
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+        driver_hash = SGL_HASH_SEED;
+        driver_hash = sgl_hash_string(driver_hash, (const char*)glGetString(GL_VENDOR));
+        driver_hash = sgl_hash_string(driver_hash, (const char*)glGetString(GL_RENDERER));
+        driver_hash = sgl_hash_string(driver_hash, (const char*)glGetString(GL_VERSION));
+        driver_hash = sgl_hash_string(driver_hash, (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION));
+        driver_supported = formats > 0;
+        driver_known = true;
+
+        if (!driver_supported)
+            PRINT_LOG("driver has no program binary formats, program cache disabled\n");
+    }
+    pthread_mutex_unlock(&cache_lock);
+
+    return driver_supported;
+}
+
+static void *sgl_program_cache_load(uint64_t key, GLenum *format, GLsizei *length)
+{
+    char path[PATH_MAX];
+    struct sgl_program_cache_header header;
+    void *binary = NULL;
+
+    pthread_mutex_lock(&cache_lock);
+    int index = sgl_program_cache_find(key);
+    if (index != -1)
+        entries[index].used = sgl_microseconds();
+    pthread_mutex_unlock(&cache_lock);
+
+    if (index == -1)
+        return NULL;
+
+    sgl_program_cache_path(path, sizeof(path), key);
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return NULL;
+
+    if (fread(&header, sizeof(header), 1, file) == 1
+        && header.magic == SGL_PROGRAM_CACHE_MAGIC
+        && header.key == key
+        && header.length > 0 && header.length <= INT_MAX
+        && header.shader_count <= SGL_PROGRAM_CACHE_MAX_SHADERS
+        && fseek(file, header.shader_count * sizeof(uint64_t), SEEK_CUR) == 0) {
+        binary = malloc(header.length);
+        if (binary != NULL && fread(binary, header.length, 1, file) != 1) {
+            free(binary);
+            binary = NULL;
+        }
+    }
+
+    fclose(file);
+
+    if (binary == NULL)
+        return NULL;
+
+    /*
+     * the modification time orders binaries for eviction across restarts
+     */
+    utimes(path, NULL);
+
+    *format = header.format;
+    *length = header.length;
+
+    return binary;
+}
+
+static void sgl_program_cache_store(uint64_t key, const uint64_t *shaders, int shader_count, GLenum format, const void *binary, GLsizei length)
+{
+    char path[PATH_MAX], temporary[PATH_MAX];
+    struct sgl_program_cache_header header = {
+        /* magic = */ SGL_PROGRAM_CACHE_MAGIC,
+        /* format = */ format,
+        /* key = */ key,
+        /* length = */ length,
+        /* shader_count = */ shader_count,
+        /* reserved = */ 0
+    };
+    size_t size = sizeof(header) + shader_count * sizeof(*shaders) + length;
+
+    if (size > cache_max_size)
+        return;
+
+    /*
+     * written aside and renamed into place, so that other threads and
+     * a crash never see half a binary
+     */
+    snprintf(temporary, sizeof(temporary), "%s/tmp.XXXXXX", cache_directory);
+    int fd = mkstemp(temporary);
+    if (fd == -1)
+        return;
+
+    FILE *file = fdopen(fd, "wb");
+    if (file == NULL) {
+        close(fd);
+        unlink(temporary);
+        return;
+    }
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(shaders, sizeof(*shaders), shader_count, file) == (size_t)shader_count
+        && fwrite(binary, length, 1, file) == 1;
+    if (fclose(file) != 0)
+        written = false;
+
+    sgl_program_cache_path(path, sizeof(path), key);
+    if (!written || rename(temporary, path) != 0) {
+        unlink(temporary);
+        return;
+    }
+
+    pthread_mutex_lock(&cache_lock);
+    int index = sgl_program_cache_find(key);
+    if (index != -1) {
+        cache_size += size - entries[index].size;
+        entries[index].size = size;
+        entries[index].used = sgl_microseconds();
+    }
+    else {
+        sgl_program_cache_add(key, size, sgl_microseconds());
+    }
+    sgl_known_shaders_add(shaders, shader_count);
+    sgl_program_cache_evict();
+    pthread_mutex_unlock(&cache_lock);
+}
+
+static void sgl_program_cache_discard(uint64_t key)
+{
+    pthread_mutex_lock(&cache_lock);
+    int index = sgl_program_cache_find(key);
+    if (index != -1)
+        sgl_program_cache_remove(index);
+    pthread_mutex_unlock(&cache_lock);
+}
+
+static uint64_t sgl_shader_key(GLuint shader, uint64_t compiled)
+{
+    GLint type = 0;
+
+    glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+
+    uint64_t key = sgl_hash(driver_hash, &compiled, sizeof(compiled));
+    return sgl_hash(key, &type, sizeof(type));
+}
+
+static struct sgl_tracked_shader *sgl_tracked_shader_find(struct sgl_program_tracker *tracker, GLuint shader)
+{
+    for (int i = 0; i < tracker->shader_count; i++)
+        if (tracker->shaders[i].shader == shader)
+            return &tracker->shaders[i];
+    return NULL;
+}
+
+static void sgl_tracked_shader_forget(struct sgl_program_tracker *tracker, struct sgl_tracked_shader *tracked)
+{
+    *tracked = tracker->shaders[--tracker->shader_count];
+}
+
+static struct sgl_tracked_shader *sgl_tracked_shader_get(struct sgl_program_tracker *tracker, GLuint shader)
+{
+    struct sgl_tracked_shader *tracked = sgl_tracked_shader_find(tracker, shader);
+    if (tracked != NULL)
+        return tracked;
+
+    if (tracker->shader_count == tracker->shader_capacity) {
+        int capacity = tracker->shader_capacity ? tracker->shader_capacity * 2 : 16;
+        struct sgl_tracked_shader *grown = realloc(tracker->shaders, capacity * sizeof(*grown));
+        if (grown == NULL)
+            return NULL;
+        tracker->shaders = grown;
+        tracker->shader_capacity = capacity;
+    }
+
+    tracked = &tracker->shaders[tracker->shader_count++];
+    *tracked = (struct sgl_tracked_shader) {
+        /* shader = */ shader,
+        /* source = */ 0,
+        /* compiled = */ 0,
+        /* pending = */ false,
+        /* deleted = */ false
+    };
+
+    return tracked;
+}
+
+static struct sgl_tracked_program *sgl_tracked_program_find(struct sgl_program_tracker *tracker, GLuint program)
+{
+    for (int i = 0; i < tracker->program_count; i++)
+        if (tracker->programs[i].program == program)
+            return &tracker->programs[i];
+    return NULL;
+}
+
+static struct sgl_tracked_program *sgl_tracked_program_get(struct sgl_program_tracker *tracker, GLuint program)
+{
+    struct sgl_tracked_program *tracked = sgl_tracked_program_find(tracker, program);
+    if (tracked != NULL)
+        return tracked;
+
+    if (tracker->program_count == tracker->program_capacity) {
+        int capacity = tracker->program_capacity ? tracker->program_capacity * 2 : 16;
+        struct sgl_tracked_program *grown = realloc(tracker->programs, capacity * sizeof(*grown));
+        if (grown == NULL)
+            return NULL;
+        tracker->programs = grown;
+        tracker->program_capacity = capacity;
+    }
+
+    tracked = &tracker->programs[tracker->program_count++];
+    *tracked = (struct sgl_tracked_program) {
+        /* program = */ program,
+        /* state = */ SGL_HASH_SEED
+    };
+
+    return tracked;
+}
+
+void sgl_program_cache_shader_source(struct sgl_program_tracker *tracker, GLuint shader, GLsizei count, const char **strings)
+{
+    struct sgl_tracked_shader *tracked = sgl_tracked_shader_find(tracker, shader);
+
+    /*
+     * the name of a deleted shader was handed out again, whatever
+     * was put off for the old shader went away with it
+     */
+    if (tracked != NULL && tracked->deleted)
+        sgl_tracked_shader_forget(tracker, tracked);
+
+    /*
+     * a compile that was put off still has to see the old source
+     */
+    sgl_program_cache_prepare(tracker, shader);
+
+    glShaderSource(shader, count, strings, NULL);
+
+    tracked = sgl_tracked_shader_get(tracker, shader);
+    if (tracked == NULL)
+        return;
+
+    tracked->source = SGL_HASH_SEED;
+    for (int i = 0; i < count; i++)
+        tracked->source = sgl_hash_string(tracked->source, strings[i]);
+}
+
+void sgl_program_cache_compile(struct sgl_program_tracker *tracker, GLuint shader)
+{
+    struct sgl_tracked_shader *tracked = cache_directory != NULL ? sgl_tracked_shader_find(tracker, shader) : NULL;
+
+    if (tracked == NULL) {
+        glCompileShader(shader);
+        return;
+    }
+
+    tracked->compiled = tracked->source;
+    tracked->pending = true;
+}
+
+void sgl_program_cache_prepare(struct sgl_program_tracker *tracker, GLuint shader)
+{
+    struct sgl_tracked_shader *tracked = sgl_tracked_shader_find(tracker, shader);
+
+    if (tracked != NULL && tracked->pending) {
+        tracked->pending = false;
+        glCompileShader(shader);
+
+        if (tracked->deleted)
+            sgl_tracked_shader_forget(tracker, tracked);
+    }
+}
+
+bool sgl_program_cache_shader_query(struct sgl_program_tracker *tracker, GLuint shader, GLenum pname, GLint *value)
+{
+    struct sgl_tracked_shader *tracked = sgl_tracked_shader_find(tracker, shader);
+
+    if (tracked == NULL || !tracked->pending)
+        return false;
+
+    switch (pname) {
+    case GL_SHADER_TYPE:
+    case GL_DELETE_STATUS:
+    case GL_SHADER_SOURCE_LENGTH:
+        glGetShaderiv(shader, pname, value);
+        return true;
+    case GL_COMPILE_STATUS:
+    case GL_INFO_LOG_LENGTH:
+        break;
+    default:
+        return false;
+    }
+
+    if (!sgl_program_cache_usable())
+        return false;
+
+    uint64_t key = sgl_shader_key(shader, tracked->compiled);
+
+    pthread_mutex_lock(&cache_lock);
+    bool known = sgl_known_shader_find(key);
+    pthread_mutex_unlock(&cache_lock);
+
+    if (!known)
+        return false;
+
+    *value = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+    return true;
+}
+
+void sgl_program_cache_delete_shader(struct sgl_program_tracker *tracker, GLuint shader)
+{
+    /*
+     * shaders deleted earlier are gone once no program holds them anymore
+     */
+    for (int i = tracker->shader_count - 1; i >= 0; i--)
+        if (tracker->shaders[i].deleted && !glIsShader(tracker->shaders[i].shader))
+            sgl_tracked_shader_forget(tracker, &tracker->shaders[i]);
+
+    struct sgl_tracked_shader *tracked = sgl_tracked_shader_find(tracker, shader);
+    if (tracked == NULL)
+        return;
+
+    /*
+     * compiling now would undo the link that skipped it. the shader may
+     * still be attached to a program that is yet to be linked though,
+     * so a compile that was put off stays tracked for that link
+     */
+    if (tracked->pending)
+        tracked->deleted = true;
+    else
+        sgl_tracked_shader_forget(tracker, tracked);
+}
+
+void sgl_program_cache_program_state(struct sgl_program_tracker *tracker, GLuint program, const void *data, size_t size)
+{
+    struct sgl_tracked_program *tracked = sgl_tracked_program_get(tracker, program);
+    if (tracked != NULL)
+        tracked->state = sgl_hash(tracked->state, data, size);
+}
+
+static int sgl_attached_shaders(GLuint program, GLuint *shaders)
+{
+    GLint count = 0;
+
+    glGetProgramiv(program, GL_ATTACHED_SHADERS, &count);
+    if (count <= 0 || count > SGL_PROGRAM_CACHE_MAX_SHADERS)
+        return -1;
+
+    glGetAttachedShaders(program, SGL_PROGRAM_CACHE_MAX_SHADERS, &count, shaders);
+
+    return count;
+}
+
+static int sgl_compare_hashes(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * fails for programs holding a shader we don't know the source of.
+ * shader_keys receives the keys of the attached shaders
+ */
+static int sgl_program_cache_key(struct sgl_program_tracker *tracker, GLuint program, uint64_t *key, uint64_t *shader_keys)
+{
+    GLuint shaders[SGL_PROGRAM_CACHE_MAX_SHADERS];
+
+    int count = sgl_attached_shaders(program, shaders);
+    if (count <= 0)
+        return 0;
+
+    for (int i = 0; i < count; i++) {
+        struct sgl_tracked_shader *tracked = sgl_tracked_shader_find(tracker, shaders[i]);
+
+        if (tracked == NULL || tracked->compiled == 0)
+            return 0;
+
+        shader_keys[i] = sgl_shader_key(shaders[i], tracked->compiled);
+    }
+
+    /*
+     * the order shaders were attached in doesn't matter
+     */
+    qsort(shader_keys, count, sizeof(*shader_keys), sgl_compare_hashes);
+
+    struct sgl_tracked_program *tracked = sgl_tracked_program_find(tracker, program);
+    uint64_t state = tracked != NULL ? tracked->state : SGL_HASH_SEED;
+
+    *key = sgl_hash(driver_hash, shader_keys, count * sizeof(*shader_keys));
+    *key = sgl_hash(*key, &state, sizeof(state));
+
+    return count;
+}
+
+static void sgl_program_cache_prepare_attached(struct sgl_program_tracker *tracker, GLuint program)
+{
+    GLuint shaders[SGL_PROGRAM_CACHE_MAX_SHADERS];
+
+    if (tracker->shader_count == 0)
+        return;
+
+    /*
+     * programs with many shaders can't have been put off
+     */
+    int count = sgl_attached_shaders(program, shaders);
+    for (int i = 0; i < count; i++)
+        sgl_program_cache_prepare(tracker, shaders[i]);
+}
+
+void sgl_program_cache_link(struct sgl_program_tracker *tracker, GLuint program)
+{
+    uint64_t key, shader_keys[SGL_PROGRAM_CACHE_MAX_SHADERS];
+    int shader_count = 0;
+
+    if (!sgl_program_cache_usable() || (shader_count = sgl_program_cache_key(tracker, program, &key, shader_keys)) == 0) {
+        sgl_program_cache_prepare_attached(tracker, program);
+        glLinkProgram(program);
+        return;
+    }
+
+    GLenum format;
+    GLsizei length;
+    GLint status = GL_FALSE;
+
+    void *binary = sgl_program_cache_load(key, &format, &length);
+    if (binary != NULL) {
+        glProgramBinary(program, format, binary, length);
+        free(binary);
+
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (status == GL_TRUE) {
+            pthread_mutex_lock(&cache_lock);
+            cache_hits++;
+            pthread_mutex_unlock(&cache_lock);
+            return;
+        }
+
+        /*
+         * the driver refused its own binary, relink and replace it
+         */
+        sgl_program_cache_discard(key);
+    }
+
+    pthread_mutex_lock(&cache_lock);
+    cache_misses++;
+    pthread_mutex_unlock(&cache_lock);
+
+    sgl_program_cache_prepare_attached(tracker, program);
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(program);
+
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE)
+        return;
+
+    length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+
+    binary = malloc(length);
+    if (binary == NULL)
+        return;
+
+    glGetProgramBinary(program, length, &length, &format, binary);
+    if (length > 0)
+        sgl_program_cache_store(key, shader_keys, shader_count, format, binary, length);
+
+    free(binary);
+}
+
+void sgl_program_cache_delete_program(struct sgl_program_tracker *tracker, GLuint program)
+{
+    struct sgl_tracked_program *tracked = sgl_tracked_program_find(tracker, program);
+    if (tracked != NULL)
+        *tracked = tracker->programs[--tracker->program_count];
+}
+
+void sgl_program_cache_free(struct sgl_program_tracker *tracker)
+{
+    free(tracker->shaders);
+    free(tracker->programs);
+    *tracker = (struct sgl_program_tracker) { 0 };
+}
@@ -20,6 +20,14 @@ const char *sgl_cmd2str(int c)
         STRING(SGL_CMD_HELLO_WORLD),
         STRING(SGL_CMD_GOODBYE_WORLD),
         STRING(SGL_CMD_SWAP_BUFFERS),
+        STRING(SGL_CMD_VP_UPLOAD_CHUNK),
+        STRING(SGL_CMD_VP_MAP_WINDOW),
+        STRING(SGL_CMD_VP_FLUSH_WINDOW),
+        STRING(SGL_CMD_VP_UNMAP_WINDOW),
+        STRING(SGL_CMD_VP_CACHE_STORE),
+        STRING(SGL_CMD_VP_CACHE_BIND),
+        STRING(SGL_CMD_VP_CACHE_RELEASE),
+        STRING(SGL_CMD_VP_DRAW_IMMEDIATE),
         STRING(SGL_CMD_CULLFACE),
         STRING(SGL_CMD_FRONTFACE),
         STRING(SGL_CMD_HINT),
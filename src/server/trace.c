@@ -0,0 +1,177 @@
+#define SHAREDGL_HOST
+#include <sharedgl.h>
+#include <server/trace.h>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define SGL_TRACE_ALIGN(x) (((x) + 7) & ~(size_t)7)
+
+/*
+ * batches are written through a large buffer, a full fifo is
+ * usually only a few writes
+ */
+#define SGL_TRACE_BUFFER_SIZE (1024 * 1024)
+
+static FILE *trace_file = NULL;
+static pthread_mutex_t trace_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+bool sgl_trace_open(const char *path, const struct sgl_trace_header *header)
+{
+    trace_file = fopen(path, "wb");
+    if (trace_file == NULL) {
+        PRINT_LOG("failed to open trace '%s', not recording\n", path);
+        return false;
+    }
+
+    setvbuf(trace_file, NULL, _IOFBF, SGL_TRACE_BUFFER_SIZE);
+
+    struct sgl_trace_header written = *header;
+    written.magic = SGL_TRACE_MAGIC;
+    written.version = SGL_TRACE_VERSION;
+    fwrite(&written, sizeof(written), 1, trace_file);
+
+    PRINT_LOG("recording batches to %s\n", path);
+    return true;
+}
+
+bool sgl_trace_recording(void)
+{
+    return trace_file != NULL;
+}
+
+static void sgl_trace_write(const struct sgl_trace_record *record, const void *data, size_t length, bool terminate)
+{
+    static const char padding[8] = { 0 };
+    size_t total = length + (terminate ? sizeof(int) : 0);
+
+    pthread_mutex_lock(&trace_mutex);
+    if (trace_file != NULL) {
+        fwrite(record, sizeof(*record), 1, trace_file);
+        fwrite(data, 1, length, trace_file);
+        if (terminate)
+            fwrite(padding, 1, sizeof(int), trace_file);
+        fwrite(padding, 1, SGL_TRACE_ALIGN(total) - total, trace_file);
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+void sgl_trace_batch(int client_id, const int *words, size_t count, unsigned int commands, unsigned int swaps)
+{
+    struct sgl_trace_record record = {
+        /* type = */        SGL_TRACE_BATCH,
+        /* client_id = */   client_id,
+        /* length = */      (count + 1) * sizeof(int),
+        /* offset = */      0,
+        /* commands = */    commands,
+        /* swaps = */       swaps
+    };
+
+    /*
+     * SGL_CMD_INVALID is 0, the terminator is written as padding
+     */
+    sgl_trace_write(&record, words, count * sizeof(int), true);
+}
+
+void sgl_trace_window(int client_id, size_t offset, const void *data, size_t length)
+{
+    struct sgl_trace_record record = {
+        /* type = */        SGL_TRACE_WINDOW,
+        /* client_id = */   client_id,
+        /* length = */      length,
+        /* offset = */      offset,
+        /* commands = */    0,
+        /* swaps = */       0
+    };
+
+    sgl_trace_write(&record, data, length, false);
+}
+
+/*
+ * called when the server is stopped, which may interrupt a record being
+ * written. the file is left to exit in that case, a record cut short is
+ * dropped when the trace is loaded
+ */
+void sgl_trace_close(void)
+{
+    if (pthread_mutex_trylock(&trace_mutex) != 0)
+        return;
+    if (trace_file != NULL) {
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+    pthread_mutex_unlock(&trace_mutex);
+}
+
+bool sgl_trace_load(struct sgl_trace *trace, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        PRINT_LOG("failed to open trace '%s'\n", path);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < sizeof(struct sgl_trace_header)) {
+        PRINT_LOG("'%s' is not a trace\n", path);
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        PRINT_LOG("failed to map trace '%s'\n", path);
+        return false;
+    }
+
+    const struct sgl_trace_header *header = data;
+    if (header->magic != SGL_TRACE_MAGIC || header->version != SGL_TRACE_VERSION) {
+        PRINT_LOG("'%s' is not a trace, or was recorded by a different version\n", path);
+        munmap(data, st.st_size);
+        return false;
+    }
+
+    madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+    trace->data = data;
+    trace->size = st.st_size;
+    trace->header = header;
+    return true;
+}
+
+const struct sgl_trace_record *sgl_trace_next(const struct sgl_trace *trace, const struct sgl_trace_record *record)
+{
+    size_t offset = sizeof(struct sgl_trace_header);
+    if (record != NULL)
+        offset = (const char*)record - (const char*)trace->data + sizeof(*record) + SGL_TRACE_ALIGN(record->length);
+
+    if (offset + sizeof(struct sgl_trace_record) > trace->size)
+        return NULL;
+
+    const struct sgl_trace_record *next = (const void*)((const char*)trace->data + offset);
+    if (next->length > trace->size - offset - sizeof(*next))
+        return NULL;
+
+    return next;
+}
+
+const void *sgl_trace_data(const struct sgl_trace_record *record)
+{
+    return record + 1;
+}
+
+void sgl_trace_unload(struct sgl_trace *trace)
+{
+    munmap(trace->data, trace->size);
+    trace->data = NULL;
+    trace->size = 0;
+    trace->header = NULL;
+}